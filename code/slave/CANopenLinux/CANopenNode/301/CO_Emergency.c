@@ -27,6 +27,15 @@
     || (CO_CONFIG_EM_ERR_STATUS_BITS_COUNT % 8U) != 0
 #error CO_CONFIG_EM_ERR_STATUS_BITS_COUNT is not correct
 #endif
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONSUMER) == 0
+#error CO_CONFIG_EM_CONSUMER must be enabled.
+#endif
+#if ((CO_EM_CONS_RX_SIZE & (CO_EM_CONS_RX_SIZE - 1U)) != 0) || (CO_EM_CONS_RX_SIZE > 256U)                            \
+    || ((CO_EM_CONS_HIST_SIZE & (CO_EM_CONS_HIST_SIZE - 1U)) != 0) || (CO_EM_CONS_ENTRIES > 255U)
+#error CO_EM_CONS_RX_SIZE, CO_EM_CONS_HIST_SIZE or CO_EM_CONS_ENTRIES is not correct
+#endif
+#endif
 
 /* fifo buffer example for fifoSize = 7 (actual capacity = 6)                 *
  *                                                                            *
@@ -279,6 +288,39 @@ static void
 CO_EM_receive(void* object, void* msg) {
     CO_EM_t* em = (CO_EM_t*)object;
 
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0
+    if (em != NULL) {
+        uint16_t ident = CO_CANrxMsg_readIdent(msg);
+
+        /* ignore sync messages (necessary if sync object is not used) */
+        if (ident != 0x80U) {
+            const uint8_t* data = CO_CANrxMsg_readData(msg);
+            CO_EM_consRx_t* rx = &em->consRx[em->consRxHead];
+
+            /* only queue the message, it is aggregated by CO_EM_process() */
+            if (CO_FLAG_READ(rx->full)) {
+                em->consRxOverflow++;
+                return;
+            }
+            (void)memcpy((void*)(&rx->errorCode), (const void*)(&data[0]), sizeof(rx->errorCode));
+            (void)memcpy((void*)(&rx->infoCode), (const void*)(&data[4]), sizeof(rx->infoCode));
+            rx->errorCode = CO_SWAP_16(rx->errorCode);
+            rx->infoCode = CO_SWAP_32(rx->infoCode);
+            rx->nodeId = (uint8_t)(ident & 0x7FU);
+            rx->errorRegister = data[2];
+            rx->errorBit = data[3];
+            CO_FLAG_SET(rx->full);
+            em->consRxHead = (uint8_t)((em->consRxHead + 1U) & (CO_EM_CONS_RX_SIZE - 1U));
+
+#if ((CO_CONFIG_EM)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
+            /* Optional signal to RTOS, which can resume task, which handles CO_EM_process(). */
+            if (em->pFunctSignalPre != NULL) {
+                em->pFunctSignalPre(em->functSignalObjectPre);
+            }
+#endif
+        }
+    }
+#else
     if ((em != NULL) && (em->pFunctSignalRx != NULL)) {
         uint16_t ident = CO_CANrxMsg_readIdent(msg);
 
@@ -293,9 +335,142 @@ CO_EM_receive(void* object, void* msg) {
             em->pFunctSignalRx(ident, CO_SWAP_16(errorCode), data[2], data[3], CO_SWAP_32(infoCode));
         }
     }
+#endif /* (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE */
 }
 #endif
 
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0
+/* Signal the entry: write history element with all messages not yet signaled and call the callback, then start new
+ * interval */
+static void
+CO_EM_consSignal(CO_EM_t* em, CO_EM_consEntry_t* entry) {
+    CO_EM_consHist_t* hist = &em->consHist[em->consHistCount & (CO_EM_CONS_HIST_SIZE - 1U)];
+    uint32_t count = entry->suppressed;
+
+    hist->time_ms = em->consTime_ms;
+    hist->infoCode = entry->infoCode;
+    hist->errorCode = entry->errorCode;
+    hist->count = (count < 0xFFFFU) ? (uint16_t)count : 0xFFFFU;
+    hist->nodeId = entry->nodeId;
+    hist->errorRegister = entry->errorRegister;
+    hist->errorBit = entry->errorBit;
+    hist->reserved = 0;
+    em->consHistCount++;
+
+    entry->suppressed = 0;
+    entry->signaled_ms = em->consTime_ms;
+
+    if (em->pFunctSignalRx != NULL) {
+        em->pFunctSignalRx((uint16_t)CO_CAN_ID_EMERGENCY + entry->nodeId, entry->errorCode, entry->errorRegister,
+                           entry->errorBit, entry->infoCode);
+    }
+}
+
+/* Apply received message to the aggregation table */
+static void
+CO_EM_consAggregate(CO_EM_t* em, const CO_EM_consRx_t* rx) {
+    CO_EM_consEntry_t* entry = &em->consEntries[em->consLastIdx];
+    CO_EM_consEntry_t* oldest = &em->consEntries[0];
+    uint32_t now = em->consTime_ms;
+
+    /* messages of the storm are usually consecutive, so try the entry of the previous message first */
+    if ((entry->nodeId != rx->nodeId) || (entry->errorCode != rx->errorCode)) {
+        entry = NULL;
+        for (uint8_t i = 0; i < CO_EM_CONS_ENTRIES; i++) {
+            CO_EM_consEntry_t* e = &em->consEntries[i];
+            if (e->nodeId == 0U) {
+                /* entries are used in order and never released, so message is not in the table */
+                oldest = e;
+                break;
+            }
+            if ((e->nodeId == rx->nodeId) && (e->errorCode == rx->errorCode)) {
+                entry = e;
+                em->consLastIdx = i;
+                break;
+            }
+            /* compare age, as time may wrap */
+            if ((now - e->lastSeen_ms) > (now - oldest->lastSeen_ms)) {
+                oldest = e;
+            }
+        }
+    }
+
+    if (entry == NULL) {
+        /* new entry, signal immediately */
+        entry = oldest;
+        em->consLastIdx = (uint8_t)(oldest - &em->consEntries[0]);
+        if (entry->nodeId != 0U) {
+            em->consEvicted++;
+            if (entry->suppressed > 0U) {
+                em->consPending--;
+                CO_EM_consSignal(em, entry);
+            }
+        }
+        entry->count = 1;
+        entry->suppressed = 1;
+        entry->firstSeen_ms = now;
+        entry->lastSeen_ms = now;
+        entry->infoCode = rx->infoCode;
+        entry->errorCode = rx->errorCode;
+        entry->nodeId = rx->nodeId;
+        entry->errorRegister = rx->errorRegister;
+        entry->errorBit = rx->errorBit;
+        CO_EM_consSignal(em, entry);
+        return;
+    }
+
+    if (entry->count < 0xFFFFFFFFU) {
+        entry->count++;
+    }
+    entry->lastSeen_ms = now;
+    entry->infoCode = rx->infoCode;
+    entry->errorRegister = rx->errorRegister;
+    entry->errorBit = rx->errorBit;
+
+    entry->suppressed++;
+
+    if ((now - entry->signaled_ms) >= em->consInterval_ms) {
+        if (entry->suppressed > 1U) {
+            em->consPending--;
+        }
+        CO_EM_consSignal(em, entry);
+    } else if (entry->suppressed == 1U) {
+        /* storm, signal later with summary, see CO_EM_consFlush() */
+        uint32_t deadline = entry->signaled_ms + em->consInterval_ms;
+        if ((em->consPending == 0U) || ((int32_t)(deadline - em->consFlush_ms) < 0)) {
+            em->consFlush_ms = deadline;
+        }
+        em->consPending++;
+    } else { /* MISRA C 2004 14.10 */
+    }
+}
+
+/* Signal entries with suppressed messages, whose interval elapsed, and find the next deadline */
+static void
+CO_EM_consFlush(CO_EM_t* em) {
+    uint32_t now = em->consTime_ms;
+    uint32_t next = 0;
+    uint8_t pending = 0;
+
+    for (uint8_t i = 0; i < CO_EM_CONS_ENTRIES; i++) {
+        CO_EM_consEntry_t* e = &em->consEntries[i];
+        if (e->suppressed > 0U) {
+            uint32_t deadline = e->signaled_ms + em->consInterval_ms;
+            if ((int32_t)(now - deadline) >= 0) {
+                CO_EM_consSignal(em, e);
+            } else {
+                if ((pending == 0U) || ((int32_t)(deadline - next) < 0)) {
+                    next = deadline;
+                }
+                pending++;
+            }
+        }
+    }
+    em->consPending = pending;
+    em->consFlush_ms = next;
+}
+#endif /* (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE */
+
 CO_ReturnError_t
 CO_EM_init(CO_EM_t* em, CO_CANmodule_t* CANdevTx, const OD_entry_t* OD_1001_errReg,
 #if (((CO_CONFIG_EM) & (CO_CONFIG_EM_PRODUCER | CO_CONFIG_EM_HISTORY)) != 0) || defined CO_DOXYGEN
@@ -453,6 +628,10 @@ CO_EM_init(CO_EM_t* em, CO_CANmodule_t* CANdevTx, const OD_entry_t* OD_1001_errR
     (void)OD_extension_init(OD_statusBits, &em->OD_statusBits_extension);
 #endif /* (CO_CONFIG_EM) & CO_CONFIG_EM_STATUS_BITS */
 
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0
+    em->consInterval_ms = CO_EM_CONS_INTERVAL_MS;
+#endif
+
 #if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONSUMER) != 0
     em->pFunctSignalRx = NULL;
     /* configure SDO server CAN reception */
@@ -487,7 +666,7 @@ void
 CO_EM_process(CO_EM_t* em, bool_t NMTisPreOrOperational, uint32_t timeDifference_us, uint32_t* timerNext_us) {
     (void)timerNext_us; /* may be unused */
 
-#if ((CO_CONFIG_EM)&CO_CONFIG_EM_PROD_INHIBIT) == 0
+#if (((CO_CONFIG_EM)&CO_CONFIG_EM_PROD_INHIBIT) == 0) && (((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) == 0)
     (void)timeDifference_us; /* may be unused */
 #endif
 
@@ -554,6 +733,35 @@ CO_EM_process(CO_EM_t* em, bool_t NMTisPreOrOperational, uint32_t timeDifference
     }
     *em->errorRegister = errorRegister;
 
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0
+    /* aggregate received emergency messages, independent of NMT state */
+    em->consTimer_us += timeDifference_us;
+    em->consTime_ms += em->consTimer_us / 1000U;
+    em->consTimer_us %= 1000U;
+
+    CO_EM_consRx_t* rx = &em->consRx[em->consRxTail];
+    while (CO_FLAG_READ(rx->full)) {
+        CO_EM_consAggregate(em, rx);
+        CO_FLAG_CLEAR(rx->full);
+        em->consRxTail = (uint8_t)((em->consRxTail + 1U) & (CO_EM_CONS_RX_SIZE - 1U));
+        rx = &em->consRx[em->consRxTail];
+    }
+
+    if (em->consPending > 0U) {
+        if ((int32_t)(em->consTime_ms - em->consFlush_ms) >= 0) {
+            CO_EM_consFlush(em);
+        }
+#if ((CO_CONFIG_EM)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+        if ((em->consPending > 0U) && (timerNext_us != NULL)) {
+            uint32_t diff = ((em->consFlush_ms - em->consTime_ms) * 1000U) - em->consTimer_us;
+            if (*timerNext_us > diff) {
+                *timerNext_us = diff;
+            }
+        }
+#endif
+    }
+#endif /* (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE */
+
     if (!NMTisPreOrOperational) {
         return;
     }
@@ -84,6 +84,11 @@ extern "C" {
  * ### Emergency consumer
  * If @ref CO_CONFIG_EM has CO_CONFIG_EM_CONSUMER enabled, then callback can be registered by @ref
  * CO_EM_initCallbackRx() function.
+ *
+ * If also CO_CONFIG_EM_CONS_AGGREGATE is enabled, then received emergency messages are only queued by the receive
+ * callback and aggregated later inside CO_EM_process(), see @ref CO_EM_consEntry_t. Emergency storm (the same error
+ * sent by a node repeatedly) then produces one callback and one element in @ref CO_EM_consHist_t on the first message
+ * and at most one more per CO_EM_t::consInterval_ms, which summarizes the repeated messages.
  */
 
 /**
@@ -253,6 +258,73 @@ typedef struct {
 } CO_EM_fifo_t;
 #endif
 
+#if (((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0) || defined CO_DOXYGEN
+/** Number of elements in CO_EM_t::consRx, must be power of 2, 256 or less */
+#ifndef CO_EM_CONS_RX_SIZE
+#define CO_EM_CONS_RX_SIZE 16U
+#endif
+/** Number of elements in CO_EM_t::consEntries, number of different (node-ID, error code) pairs tracked */
+#ifndef CO_EM_CONS_ENTRIES
+#define CO_EM_CONS_ENTRIES 16U
+#endif
+/** Number of elements in CO_EM_t::consHist, must be power of 2 */
+#ifndef CO_EM_CONS_HIST_SIZE
+#define CO_EM_CONS_HIST_SIZE 32U
+#endif
+/** Default value for CO_EM_t::consInterval_ms */
+#ifndef CO_EM_CONS_INTERVAL_MS
+#define CO_EM_CONS_INTERVAL_MS 1000U
+#endif
+
+/**
+ * Received emergency message, waiting in the receive queue for CO_EM_process().
+ */
+typedef struct {
+    volatile void* full;   /**< Indication if this element of the receive queue is used */
+    uint32_t infoCode;     /**< Bytes 4..7 of the message */
+    uint16_t errorCode;    /**< Bytes 0..1 of the message */
+    uint8_t nodeId;        /**< Node-ID of the producer, from CAN-ID */
+    uint8_t errorRegister; /**< Byte 2 of the message */
+    uint8_t errorBit;      /**< Byte 3 of the message */
+} CO_EM_consRx_t;
+
+/**
+ * Aggregated emergency messages with the same node-ID and the same error code.
+ *
+ * Entry is created by the first message. If table is full, then entry, which was not received for the longest time, is
+ * reused (evicted), after its suppressed messages are signaled.
+ */
+typedef struct {
+    uint32_t count;        /**< Number of received messages, saturates at 0xFFFFFFFF */
+    uint32_t suppressed;   /**< Number of messages not yet signaled */
+    uint32_t firstSeen_ms; /**< CO_EM_t::consTime_ms of the first message */
+    uint32_t lastSeen_ms;  /**< CO_EM_t::consTime_ms of the last message */
+    uint32_t signaled_ms;  /**< CO_EM_t::consTime_ms of the last signal (callback and history element) */
+    uint32_t infoCode;     /**< Info code from the last message */
+    uint16_t errorCode;    /**< Error code, @ref CO_EM_errorCode_t */
+    uint8_t nodeId;        /**< Node-ID of the producer, 0 if entry is not used */
+    uint8_t errorRegister; /**< Error register from the last message */
+    uint8_t errorBit;      /**< Error status bit from the last message */
+} CO_EM_consEntry_t;
+
+/**
+ * Element of the emergency consumer history, 16 bytes.
+ *
+ * History is a ring buffer: element with sequence number 'seq' is stored at consHist[seq % CO_EM_CONS_HIST_SIZE].
+ * Available are elements from (consHistCount - CO_EM_CONS_HIST_SIZE) to (consHistCount - 1), older are overwritten.
+ */
+typedef struct {
+    uint32_t time_ms;      /**< CO_EM_t::consTime_ms of the signal */
+    uint32_t infoCode;     /**< Info code from the last message */
+    uint16_t errorCode;    /**< Error code, @ref CO_EM_errorCode_t */
+    uint16_t count;        /**< Number of messages summarized by this element, saturates at 0xFFFF */
+    uint8_t nodeId;        /**< Node-ID of the producer */
+    uint8_t errorRegister; /**< Error register from the last message */
+    uint8_t errorBit;      /**< Error status bit from the last message */
+    uint8_t reserved;      /**< Reserved, zero */
+} CO_EM_consHist_t;
+#endif /* (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE */
+
 /**
  * Emergency object.
  */
@@ -307,6 +379,28 @@ typedef struct {
                            const uint8_t errorBit, const uint32_t infoCode); /**< From CO_EM_initCallbackRx() or NULL */
 #endif
 
+#if (((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) != 0) || defined CO_DOXYGEN
+    uint32_t consInterval_ms;                          /**< Minimum time between two signals of the same entry,
+                                                          CO_EM_CONS_INTERVAL_MS by default. May be changed by
+                                                          application. */
+    uint32_t consTimer_us;                             /**< Time in microseconds, not yet added to consTime_ms */
+    uint32_t consTime_ms;                              /**< Time base of the emergency consumer in milliseconds */
+    uint32_t consFlush_ms;                             /**< Earliest consTime_ms, when entry with suppressed messages
+                                                          must be signaled */
+    uint32_t consRxOverflow;                           /**< Number of messages lost because of full receive queue,
+                                                          written by receive callback */
+    uint32_t consEvicted;                              /**< Number of entries reused, because table was full */
+    uint32_t consHistCount;                            /**< Number of all elements written into consHist */
+    uint8_t consPending;                               /**< Number of entries with suppressed messages */
+    uint8_t consLastIdx;                               /**< Index of the entry of the previous message */
+    uint8_t consRxHead;                                /**< Write position in the receive queue, used by receive
+                                                          callback only */
+    uint8_t consRxTail;                                /**< Read position in the receive queue */
+    CO_EM_consRx_t consRx[CO_EM_CONS_RX_SIZE];         /**< Receive queue */
+    CO_EM_consEntry_t consEntries[CO_EM_CONS_ENTRIES]; /**< Aggregated messages, see @ref CO_EM_consEntry_t */
+    CO_EM_consHist_t consHist[CO_EM_CONS_HIST_SIZE];   /**< History, see @ref CO_EM_consHist_t */
+#endif
+
 #if (((CO_CONFIG_EM)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0) || defined CO_DOXYGEN
     void (*pFunctSignalPre)(void* object); /**< From CO_EM_initCallbackPre() or NULL */
     void* functSignalObjectPre;            /**< From CO_EM_initCallbackPre() or NULL */
@@ -388,7 +482,9 @@ void CO_EM_initCallbackPre(CO_EM_t* em, void* object, void (*pFunctSignal)(void*
  * sent from this device.
  *
  * @remark Depending on the CAN driver implementation, this function is called inside an ISR or inside a mainline. Must
- * be thread safe.
+ * be thread safe. If CO_CONFIG_EM_CONS_AGGREGATE is enabled, then callback is always called from CO_EM_process(). For
+ * received messages it is called on the first message of each entry and then at most once per CO_EM_t::consInterval_ms
+ * with arguments from the last message, see @ref CO_EM_consEntry_t.
  *
  * @param em This object.
  * @param pFunctSignalRx Pointer to the callback function. Not called if NULL.
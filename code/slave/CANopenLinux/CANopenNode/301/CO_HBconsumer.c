@@ -28,6 +28,9 @@
 #error CO_CONFIG_HB_CONS_CALLBACK_CHANGE and CO_CONFIG_HB_CONS_CALLBACK_MULTI cannot be set simultaneously!
 #endif
 
+/* Position in the deadline heap for the node, which is not in the heap */
+#define CO_HBCONS_HEAP_NONE 0xFFU
+
 /*
  * Read received message from CAN module.
  *
@@ -41,9 +44,31 @@ CO_HBcons_receive(void* object, void* msg) {
     const uint8_t* data = CO_CANrxMsg_readData(msg);
 
     if (DLC == 1U) {
+        CO_HBconsumer_t* HBcons = HBconsNode->HBcons;
+
         /* copy data and set 'new message' flag. */
-        HBconsNode->NMTstate = (CO_NMT_internalState_t)data[0];
+        HBconsNode->NMTstateRx = (CO_NMT_internalState_t)data[0];
         CO_FLAG_SET(HBconsNode->CANrxNew);
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+        if ((data[0] == (uint8_t)CO_NMT_INITIALIZING) && (HBconsNode->nodeId < 128U)) {
+            HBcons->netRx[HBconsNode->nodeId].bootupRx++;
+        }
+#endif
+
+        /* Put the node into the receive queue, if not already there. Node is removed from the queue only inside
+         * CO_HBconsumer_process(), so queue never contains more elements than there are monitored nodes. */
+        if (!CO_FLAG_READ(HBconsNode->rxQueued)) {
+            CO_HBconsNode_t* slot = &HBcons->monitoredNodes[HBcons->rxQueueHead];
+            if (!CO_FLAG_READ(slot->rxQueueFull)) {
+                slot->rxQueueIdx = (uint8_t)(HBconsNode - HBcons->monitoredNodes);
+                CO_FLAG_SET(HBconsNode->rxQueued);
+                CO_FLAG_SET(slot->rxQueueFull);
+                HBcons->rxQueueHead++;
+                if (HBcons->rxQueueHead >= HBcons->numberOfMonitoredNodes) {
+                    HBcons->rxQueueHead = 0;
+                }
+            }
+        }
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
         /* Optional signal to RTOS, which can resume task, which handles HBcons. */
         if (HBconsNode->pFunctSignalPre != NULL) {
@@ -53,6 +78,277 @@ CO_HBcons_receive(void* object, void* msg) {
     }
 }
 
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+/*
+ * Read received message from CAN module, Heartbeat from any node, which is not monitored.
+ *
+ * Message is stored and node-ID is put into the receive queue. Network state table is updated later inside
+ * CO_HBconsumer_process().
+ */
+static void
+CO_HBcons_receiveNet(void* object, void* msg) {
+    CO_HBconsumer_t* HBcons = object;
+    uint8_t DLC = CO_CANrxMsg_readDLC(msg);
+    const uint8_t* data = CO_CANrxMsg_readData(msg);
+    uint16_t nodeId = CO_CANrxMsg_readIdent(msg) - (uint16_t)CO_CAN_ID_HEARTBEAT;
+
+    if ((DLC == 1U) && (nodeId >= 1U) && (nodeId <= 127U)) {
+        CO_HBconsumer_netRx_t* netRx = &HBcons->netRx[nodeId];
+
+        netRx->NMTstateRx = data[0];
+        if (data[0] == (uint8_t)CO_NMT_INITIALIZING) {
+            netRx->bootupRx++;
+        }
+        if (!CO_FLAG_READ(netRx->rxQueued)) {
+            CO_HBconsumer_netRx_t* slot = &HBcons->netRx[HBcons->netRxQueueHead];
+            if (!CO_FLAG_READ(slot->rxQueueFull)) {
+                slot->rxQueueNodeId = (uint8_t)nodeId;
+                CO_FLAG_SET(netRx->rxQueued);
+                CO_FLAG_SET(slot->rxQueueFull);
+                HBcons->netRxQueueHead = (HBcons->netRxQueueHead + 1U) & 0x7FU;
+            }
+        }
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
+        /* Optional signal to RTOS, the same callback is configured for all monitored nodes. */
+        if ((HBcons->numberOfMonitoredNodes > 0U) && (HBcons->monitoredNodes[0].pFunctSignalPre != NULL)) {
+            HBcons->monitoredNodes[0].pFunctSignalPre(HBcons->monitoredNodes[0].functSignalObjectPre);
+        }
+#endif
+    }
+}
+
+/* Get network state table for writing, start the update (odd sequence), if not started yet. */
+static CO_HBconsumer_netTable_t*
+CO_HBcons_netWrite(CO_HBconsumer_t* HBcons) {
+    CO_HBconsumer_netTable_t* netTable = HBcons->netTable;
+
+    if ((netTable != NULL) && ((netTable->sequence & 1U) == 0U)) {
+        netTable->sequence++;
+    }
+    return netTable;
+}
+
+/* Write event into the log of network state table */
+static void
+CO_HBcons_netLog(CO_HBconsumer_netTable_t* netTable, uint8_t nodeId, CO_HBconsumer_netEvent_t event) {
+    CO_HBconsumer_netNode_t* netNode = &netTable->nodes[nodeId];
+    CO_HBconsumer_netLog_t* log = &netTable->log[netTable->logCount & (CO_HBCONS_NET_LOG_SIZE - 1U)];
+
+    log->time_ms = netTable->time_ms;
+    log->nodeId = nodeId;
+    log->event = (uint8_t)event;
+    log->NMTstate = netNode->NMTstate;
+    log->HBstate = netNode->HBstate;
+    netTable->logCount++;
+}
+
+/* Apply received message to network state table */
+static void
+CO_HBcons_netReceived(CO_HBconsumer_t* HBcons, uint8_t nodeId, uint8_t NMTstate) {
+    CO_HBconsumer_netTable_t* netTable = CO_HBcons_netWrite(HBcons);
+
+    if ((netTable == NULL) || (nodeId < 1U) || (nodeId > 127U)) {
+        return;
+    }
+    CO_HBconsumer_netNode_t* netNode = &netTable->nodes[nodeId];
+    CO_HBconsumer_netRx_t* netRx = &HBcons->netRx[nodeId];
+    uint16_t bootups = netRx->bootupRx - netRx->bootupRxProcessed;
+
+    netNode->lastSeen_ms = netTable->time_ms;
+    if (netNode->NMTstate != NMTstate) {
+        netNode->NMTstate = NMTstate;
+        if (netNode->changeCount < 0xFFFFU) {
+            netNode->changeCount++;
+        }
+        CO_HBcons_netLog(netTable, nodeId, CO_HBconsumer_NET_NMT_CHANGED);
+    }
+    if (bootups != 0U) {
+        netNode->bootupCount += bootups;
+        netRx->bootupRxProcessed += bootups;
+        CO_HBcons_netLog(netTable, nodeId, CO_HBconsumer_NET_BOOTUP);
+    }
+}
+
+/* Apply heartbeat state of the monitored node to network state table */
+static void
+CO_HBcons_netHBstate(CO_HBconsumer_t* HBcons, uint8_t nodeId, CO_HBconsumer_state_t HBstate) {
+    CO_HBconsumer_netTable_t* netTable = HBcons->netTable;
+
+    if ((netTable == NULL) || (nodeId < 1U) || (nodeId > 127U) || (netTable->nodes[nodeId].HBstate == HBstate)) {
+        return;
+    }
+    netTable = CO_HBcons_netWrite(HBcons);
+    CO_HBconsumer_netNode_t* netNode = &netTable->nodes[nodeId];
+
+    netNode->HBstate = (uint8_t)HBstate;
+    if (HBstate == CO_HBconsumer_ACTIVE) {
+        CO_HBcons_netLog(netTable, nodeId, CO_HBconsumer_NET_HB_STARTED);
+    } else if (HBstate == CO_HBconsumer_TIMEOUT) {
+        netNode->NMTstate = (uint8_t)CO_NMT_UNKNOWN;
+        netNode->timeoutCount++;
+        CO_HBcons_netLog(netTable, nodeId, CO_HBconsumer_NET_TIMEOUT);
+    } else { /* MISRA C 2004 14.10 */
+    }
+}
+#endif /* (CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE */
+
+/*
+ * Take the next node from the receive queue and its message
+ *
+ * @param HBcons This object.
+ * @param [out] idx Index of the monitored node or CO_HBCONS_HEAP_NONE, if message was discarded or node is not
+ * monitored.
+ * @param [out] NMTstate NMT state from the message.
+ * @return false, if queue is empty.
+ */
+static bool_t
+CO_HBcons_rxQueueGet(CO_HBconsumer_t* HBcons, uint8_t* idx, CO_NMT_internalState_t* NMTstate) {
+    CO_HBconsNode_t* slot = &HBcons->monitoredNodes[HBcons->rxQueueTail];
+
+    if (!CO_FLAG_READ(slot->rxQueueFull)) {
+        return false;
+    }
+    uint8_t i = slot->rxQueueIdx;
+    CO_FLAG_CLEAR(slot->rxQueueFull);
+    HBcons->rxQueueTail++;
+    if (HBcons->rxQueueTail >= HBcons->numberOfMonitoredNodes) {
+        HBcons->rxQueueTail = 0;
+    }
+
+    CO_HBconsNode_t* const monitoredNode = &HBcons->monitoredNodes[i];
+    /* Clear flags before reading the message. Message received after that is queued again. */
+    CO_FLAG_CLEAR(monitoredNode->rxQueued);
+    if (!CO_FLAG_READ(monitoredNode->CANrxNew) || (monitoredNode->HBstate == CO_HBconsumer_UNCONFIGURED)) {
+        *idx = CO_HBCONS_HEAP_NONE;
+    } else {
+        CO_FLAG_CLEAR(monitoredNode->CANrxNew);
+        *idx = i;
+        *NMTstate = monitoredNode->NMTstateRx;
+    }
+    return true;
+}
+
+/* Deadline of the node at heap position 'a' is before deadline of the node at heap position 'b' (overflow safe) */
+static inline bool_t
+CO_HBcons_heapBefore(const CO_HBconsNode_t* nodes, uint8_t a, uint8_t b) {
+    return (int32_t)(nodes[nodes[a].heapIdx].deadline_us - nodes[nodes[b].heapIdx].deadline_us) < 0;
+}
+
+/* Exchange two elements of the deadline heap */
+static void
+CO_HBcons_heapSwap(CO_HBconsNode_t* nodes, uint8_t a, uint8_t b) {
+    uint8_t idx = nodes[a].heapIdx;
+    nodes[a].heapIdx = nodes[b].heapIdx;
+    nodes[b].heapIdx = idx;
+    nodes[nodes[a].heapIdx].heapPos = a;
+    nodes[nodes[b].heapIdx].heapPos = b;
+}
+
+/* Restore heap order after the deadline of the element at position 'pos' has changed */
+static void
+CO_HBcons_heapFix(CO_HBconsumer_t* HBcons, uint8_t pos) {
+    CO_HBconsNode_t* nodes = HBcons->monitoredNodes;
+
+    while ((pos > 0U) && CO_HBcons_heapBefore(nodes, pos, (uint8_t)((pos - 1U) / 2U))) {
+        uint8_t parent = (uint8_t)((pos - 1U) / 2U);
+        CO_HBcons_heapSwap(nodes, pos, parent);
+        pos = parent;
+    }
+    for (;;) {
+        uint16_t child = ((uint16_t)pos * 2U) + 1U;
+        if (child >= HBcons->heapCount) {
+            break;
+        }
+        if (((child + 1U) < HBcons->heapCount) && CO_HBcons_heapBefore(nodes, (uint8_t)(child + 1U), (uint8_t)child)) {
+            child++;
+        }
+        if (!CO_HBcons_heapBefore(nodes, (uint8_t)child, pos)) {
+            break;
+        }
+        CO_HBcons_heapSwap(nodes, pos, (uint8_t)child);
+        pos = (uint8_t)child;
+    }
+}
+
+/* Insert the node into the deadline heap or move it after its deadline has changed */
+static void
+CO_HBcons_schedule(CO_HBconsumer_t* HBcons, uint8_t idx) {
+    CO_HBconsNode_t* nodes = HBcons->monitoredNodes;
+    uint8_t pos = nodes[idx].heapPos;
+
+    if (pos == CO_HBCONS_HEAP_NONE) {
+        pos = HBcons->heapCount;
+        HBcons->heapCount++;
+        nodes[pos].heapIdx = idx;
+        nodes[idx].heapPos = pos;
+    }
+    CO_HBcons_heapFix(HBcons, pos);
+}
+
+/* Remove the node from the deadline heap, if it is there */
+static void
+CO_HBcons_unschedule(CO_HBconsumer_t* HBcons, uint8_t idx) {
+    CO_HBconsNode_t* nodes = HBcons->monitoredNodes;
+    uint8_t pos = nodes[idx].heapPos;
+
+    if (pos == CO_HBCONS_HEAP_NONE) {
+        return;
+    }
+    HBcons->heapCount--;
+    if (pos < HBcons->heapCount) {
+        CO_HBcons_heapSwap(nodes, pos, HBcons->heapCount);
+        CO_HBcons_heapFix(HBcons, pos);
+    }
+    nodes[idx].heapPos = CO_HBCONS_HEAP_NONE;
+}
+
+/* Set heartbeat state of the configured node and update the counter */
+static void
+CO_HBcons_setHBstate(CO_HBconsumer_t* HBcons, CO_HBconsNode_t* monitoredNode, CO_HBconsumer_state_t HBstate) {
+    if (monitoredNode->HBstate == CO_HBconsumer_ACTIVE) {
+        HBcons->countActive--;
+    }
+    if (HBstate == CO_HBconsumer_ACTIVE) {
+        HBcons->countActive++;
+    }
+    monitoredNode->HBstate = HBstate;
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+    CO_HBcons_netHBstate(HBcons, monitoredNode->nodeId, HBstate);
+#endif
+}
+
+/* Set NMT state of the configured node, update the counter and signal the change */
+static void
+CO_HBcons_setNMTstate(CO_HBconsumer_t* HBcons, uint8_t idx, CO_NMT_internalState_t NMTstate) {
+    CO_HBconsNode_t* const monitoredNode = &HBcons->monitoredNodes[idx];
+
+    if (monitoredNode->NMTstate == CO_NMT_OPERATIONAL) {
+        HBcons->countOperational--;
+    }
+    if (NMTstate == CO_NMT_OPERATIONAL) {
+        HBcons->countOperational++;
+    }
+    monitoredNode->NMTstate = NMTstate;
+
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0)                                                     \
+    || (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0)
+    /* Verify, if NMT state of monitored node changed */
+    if (monitoredNode->NMTstate != monitoredNode->NMTstatePrev) {
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0
+        if (HBcons->pFunctSignalNmtChanged != NULL) {
+            HBcons->pFunctSignalNmtChanged(monitoredNode->nodeId, idx, monitoredNode->NMTstate,
+                                           HBcons->pFunctSignalObjectNmtChanged);
+#else
+        if (monitoredNode->pFunctSignalNmtChanged != NULL) {
+            monitoredNode->pFunctSignalNmtChanged(monitoredNode->nodeId, idx, monitoredNode->NMTstate,
+                                                  monitoredNode->pFunctSignalObjectNmtChanged);
+#endif
+        }
+        monitoredNode->NMTstatePrev = monitoredNode->NMTstate;
+    }
+#endif
+}
+
 /*
  * Initialize one Heartbeat consumer entry
  *
@@ -124,6 +420,16 @@ CO_HBconsumer_init(CO_HBconsumer_t* HBcons, CO_EM_t* em, CO_HBconsNode_t* monito
                                          ? (OD_1016_HBcons->subEntriesCount - 1U)
                                          : monitoredNodesCount;
 
+    for (uint8_t i = 0; i < HBcons->numberOfMonitoredNodes; i++) {
+        CO_HBconsNode_t* const monitoredNode = &monitoredNodes[i];
+        monitoredNode->HBcons = HBcons;
+        monitoredNode->HBstate = CO_HBconsumer_UNCONFIGURED;
+        monitoredNode->NMTstate = CO_NMT_UNKNOWN;
+        monitoredNode->heapPos = CO_HBCONS_HEAP_NONE;
+        CO_FLAG_CLEAR(monitoredNode->rxQueued);
+        CO_FLAG_CLEAR(monitoredNode->rxQueueFull);
+    }
+
     for (uint8_t i = 0; i < HBcons->numberOfMonitoredNodes; i++) {
         uint32_t val;
         odRet = OD_get_u32(OD_1016_HBcons, i + 1U, &val, true);
@@ -189,6 +495,17 @@ CO_HBconsumer_initEntry(CO_HBconsumer_t* HBcons, uint8_t idx, uint8_t nodeId, ui
         uint16_t COB_ID;
 
         CO_HBconsNode_t* monitoredNode = &HBcons->monitoredNodes[idx];
+
+        /* remove previous configuration from the counters and from the deadline heap */
+        if (monitoredNode->HBstate != CO_HBconsumer_UNCONFIGURED) {
+            CO_HBcons_setHBstate(HBcons, monitoredNode, CO_HBconsumer_UNCONFIGURED);
+            if (monitoredNode->NMTstate == CO_NMT_OPERATIONAL) {
+                HBcons->countOperational--;
+            }
+            HBcons->countConfigured--;
+        }
+        CO_HBcons_unschedule(HBcons, idx);
+
         monitoredNode->nodeId = nodeId;
         monitoredNode->time_us = (uint32_t)consumerTime_ms * 1000U;
         monitoredNode->NMTstate = CO_NMT_UNKNOWN;
@@ -202,6 +519,10 @@ CO_HBconsumer_initEntry(CO_HBconsumer_t* HBcons, uint8_t idx, uint8_t nodeId, ui
         if ((monitoredNode->nodeId != 0U) && (monitoredNode->time_us != 0U)) {
             COB_ID = monitoredNode->nodeId + (uint16_t)CO_CAN_ID_HEARTBEAT;
             monitoredNode->HBstate = CO_HBconsumer_UNKNOWN;
+            HBcons->countConfigured++;
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+            CO_HBcons_netHBstate(HBcons, monitoredNode->nodeId, CO_HBconsumer_UNKNOWN);
+#endif
         } else {
             COB_ID = 0;
             monitoredNode->time_us = 0;
@@ -228,6 +549,44 @@ CO_HBconsumer_initCallbackPre(CO_HBconsumer_t* HBcons, void* object, void (*pFun
 }
 #endif
 
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+CO_ReturnError_t
+CO_HBconsumer_initNetTable(CO_HBconsumer_t* HBcons, CO_HBconsumer_netTable_t* netTable, CO_CANmodule_t* CANdevRx,
+                           uint16_t CANdevRxIdx) {
+    if ((HBcons == NULL) || (netTable == NULL) || (CANdevRx == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    if ((netTable->magic != CO_HBCONS_NET_MAGIC) || (netTable->version != CO_HBCONS_NET_VERSION)
+        || (netTable->logSize != CO_HBCONS_NET_LOG_SIZE)) {
+        (void)memset(netTable, 0, sizeof(CO_HBconsumer_netTable_t));
+        netTable->magic = CO_HBCONS_NET_MAGIC;
+        netTable->version = CO_HBCONS_NET_VERSION;
+        netTable->logSize = CO_HBCONS_NET_LOG_SIZE;
+        for (uint8_t i = 0; i < 128U; i++) {
+            netTable->nodes[i].NMTstate = (uint8_t)CO_NMT_UNKNOWN;
+        }
+    }
+
+    /* update the state of monitored nodes */
+    netTable->sequence |= 1U;
+    for (uint8_t i = 0; i < 128U; i++) {
+        netTable->nodes[i].HBstate = (uint8_t)CO_HBconsumer_UNCONFIGURED;
+    }
+    for (uint8_t i = 0; i < HBcons->numberOfMonitoredNodes; i++) {
+        const CO_HBconsNode_t* monitoredNode = &HBcons->monitoredNodes[i];
+        if ((monitoredNode->HBstate != CO_HBconsumer_UNCONFIGURED) && (monitoredNode->nodeId < 128U)) {
+            netTable->nodes[monitoredNode->nodeId].HBstate = (uint8_t)monitoredNode->HBstate;
+        }
+    }
+    netTable->sequence++;
+    HBcons->netTable = netTable;
+
+    return CO_CANrxBufferInit(CANdevRx, CANdevRxIdx, CO_CAN_ID_HEARTBEAT, 0x780, false, (void*)HBcons,
+                              CO_HBcons_receiveNet);
+}
+#endif
+
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0
 void
 CO_HBconsumer_initCallbackNmtChanged(CO_HBconsumer_t* HBcons, uint8_t idx, void* object,
@@ -307,104 +666,93 @@ CO_HBconsumer_process(CO_HBconsumer_t* HBcons, bool_t NMTisPreOrOperational, uin
 
     bool_t allMonitoredActiveCurrent = true;
     bool_t allMonitoredOperationalCurrent = true;
+    CO_HBconsNode_t* const nodes = HBcons->monitoredNodes;
 
     if (NMTisPreOrOperational && HBcons->NMTisPreOrOperationalPrev) {
-        for (uint8_t i = 0; i < HBcons->numberOfMonitoredNodes; i++) {
-            uint32_t timeDifference_us_copy = timeDifference_us;
-            CO_HBconsNode_t* const monitoredNode = &HBcons->monitoredNodes[i];
+        HBcons->timer_us += timeDifference_us;
+
+        /* Nodes from the receive queue. Limit the loop, if messages are received concurrently. */
+        for (uint8_t n = 0; n < HBcons->numberOfMonitoredNodes; n++) {
+            uint8_t i;
+            CO_NMT_internalState_t NMTstate;
 
-            if (monitoredNode->HBstate == CO_HBconsumer_UNCONFIGURED) {
-                /* continue, if node is not monitored */
+            if (!CO_HBcons_rxQueueGet(HBcons, &i, &NMTstate)) {
+                break;
+            }
+            if (i == CO_HBCONS_HEAP_NONE) {
                 continue;
             }
+            CO_HBconsNode_t* const monitoredNode = &nodes[i];
+
             /* Verify if received message is heartbeat or bootup */
-            if (CO_FLAG_READ(monitoredNode->CANrxNew)) {
-                if (monitoredNode->NMTstate == CO_NMT_INITIALIZING) {
-                    /* bootup message */
+            if (NMTstate == CO_NMT_INITIALIZING) {
+                /* bootup message */
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0
-                    if (monitoredNode->pFunctSignalRemoteReset != NULL) {
-                        monitoredNode->pFunctSignalRemoteReset(monitoredNode->nodeId, i,
-                                                               monitoredNode->functSignalObjectRemoteReset);
-                    }
+                if (monitoredNode->pFunctSignalRemoteReset != NULL) {
+                    monitoredNode->pFunctSignalRemoteReset(monitoredNode->nodeId, i,
+                                                           monitoredNode->functSignalObjectRemoteReset);
+                }
 #endif
-                    if (monitoredNode->HBstate == CO_HBconsumer_ACTIVE) {
-                        CO_errorReport(HBcons->em, CO_EM_HB_CONSUMER_REMOTE_RESET, CO_EMC_HEARTBEAT, i);
-                    }
-                    monitoredNode->HBstate = CO_HBconsumer_UNKNOWN;
+                if (monitoredNode->HBstate == CO_HBconsumer_ACTIVE) {
+                    CO_errorReport(HBcons->em, CO_EM_HB_CONSUMER_REMOTE_RESET, CO_EMC_HEARTBEAT, i);
+                }
+                CO_HBcons_setHBstate(HBcons, monitoredNode, CO_HBconsumer_UNKNOWN);
+                CO_HBcons_unschedule(HBcons, i);
 
-                } else {
-                    /* heartbeat message */
+            } else {
+                /* heartbeat message */
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0
-                    if (monitoredNode->HBstate != CO_HBconsumer_ACTIVE
-                        && monitoredNode->pFunctSignalHbStarted != NULL) {
-                        monitoredNode->pFunctSignalHbStarted(monitoredNode->nodeId, i,
-                                                             monitoredNode->functSignalObjectHbStarted);
-                    }
-#endif
-                    monitoredNode->HBstate = CO_HBconsumer_ACTIVE;
-                    /* reset timer */
-                    monitoredNode->timeoutTimer = 0;
-                    timeDifference_us_copy = 0;
+                if (monitoredNode->HBstate != CO_HBconsumer_ACTIVE && monitoredNode->pFunctSignalHbStarted != NULL) {
+                    monitoredNode->pFunctSignalHbStarted(monitoredNode->nodeId, i,
+                                                         monitoredNode->functSignalObjectHbStarted);
                 }
-                CO_FLAG_CLEAR(monitoredNode->CANrxNew);
+#endif
+                CO_HBcons_setHBstate(HBcons, monitoredNode, CO_HBconsumer_ACTIVE);
+                /* reschedule timeout */
+                monitoredNode->deadline_us = HBcons->timer_us + monitoredNode->time_us;
+                CO_HBcons_schedule(HBcons, i);
             }
-
-            /* Verify timeout */
-            if (monitoredNode->HBstate == CO_HBconsumer_ACTIVE) {
-                monitoredNode->timeoutTimer += timeDifference_us_copy;
-
-                if (monitoredNode->timeoutTimer >= monitoredNode->time_us) {
-                    /* timeout expired */
-#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0
-                    if (monitoredNode->pFunctSignalTimeout != NULL) {
-                        monitoredNode->pFunctSignalTimeout(monitoredNode->nodeId, i,
-                                                           monitoredNode->functSignalObjectTimeout);
-                    }
+            CO_HBcons_setNMTstate(HBcons, i, NMTstate);
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+            CO_HBcons_netReceived(HBcons, monitoredNode->nodeId, (uint8_t)NMTstate);
 #endif
-                    CO_errorReport(HBcons->em, CO_EM_HEARTBEAT_CONSUMER, CO_EMC_HEARTBEAT, i);
-                    monitoredNode->NMTstate = CO_NMT_UNKNOWN;
-                    monitoredNode->HBstate = CO_HBconsumer_TIMEOUT;
-                }
+        }
+
+        /* Nodes with expired deadline, the earliest one is on the top of the heap */
+        while (HBcons->heapCount > 0U) {
+            uint8_t i = nodes[0].heapIdx;
+            CO_HBconsNode_t* const monitoredNode = &nodes[i];
+            uint32_t diff = monitoredNode->deadline_us - HBcons->timer_us;
 
+            if ((int32_t)diff > 0) {
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_FLAG_TIMERNEXT) != 0
-                else if (timerNext_us != NULL) {
-                    /* Calculate timerNext_us for next timeout checking. */
-                    uint32_t diff = monitoredNode->time_us - monitoredNode->timeoutTimer;
-                    if (*timerNext_us > diff) {
-                        *timerNext_us = diff;
-                    }
+                /* Calculate timerNext_us for next timeout checking. */
+                if ((timerNext_us != NULL) && (*timerNext_us > diff)) {
+                    *timerNext_us = diff;
                 }
 #endif
+                break;
             }
 
-            if (monitoredNode->HBstate != CO_HBconsumer_ACTIVE) {
-                allMonitoredActiveCurrent = false;
-            }
-            if (monitoredNode->NMTstate != CO_NMT_OPERATIONAL) {
-                allMonitoredOperationalCurrent = false;
-            }
-#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0)                                                     \
-    || (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0)
-            /* Verify, if NMT state of monitored node changed */
-            if (monitoredNode->NMTstate != monitoredNode->NMTstatePrev) {
-#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0
-                if (HBcons->pFunctSignalNmtChanged != NULL) {
-                    HBcons->pFunctSignalNmtChanged(monitoredNode->nodeId, i, monitoredNode->NMTstate,
-                                                   HBcons->pFunctSignalObjectNmtChanged);
-#else
-                if (monitoredNode->pFunctSignalNmtChanged != NULL) {
-                    monitoredNode->pFunctSignalNmtChanged(monitoredNode->nodeId, i, monitoredNode->NMTstate,
-                                                          monitoredNode->pFunctSignalObjectNmtChanged);
-#endif
-                }
-                monitoredNode->NMTstatePrev = monitoredNode->NMTstate;
+            /* timeout expired */
+            CO_HBcons_unschedule(HBcons, i);
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0
+            if (monitoredNode->pFunctSignalTimeout != NULL) {
+                monitoredNode->pFunctSignalTimeout(monitoredNode->nodeId, i, monitoredNode->functSignalObjectTimeout);
             }
 #endif
+            CO_errorReport(HBcons->em, CO_EM_HEARTBEAT_CONSUMER, CO_EMC_HEARTBEAT, i);
+            CO_HBcons_setHBstate(HBcons, monitoredNode, CO_HBconsumer_TIMEOUT);
+            CO_HBcons_setNMTstate(HBcons, i, CO_NMT_UNKNOWN);
         }
+
+        allMonitoredActiveCurrent = HBcons->countActive == HBcons->countConfigured;
+        allMonitoredOperationalCurrent = HBcons->countOperational == HBcons->countConfigured;
     } else if (NMTisPreOrOperational || HBcons->NMTisPreOrOperationalPrev) {
-        /* (pre)operational state changed, clear variables */
+        /* (pre)operational state changed, clear variables. Nodes, which remain in the receive queue, have cleared
+         * CANrxNew flag and will be ignored. */
         for (uint8_t i = 0; i < HBcons->numberOfMonitoredNodes; i++) {
-            CO_HBconsNode_t* const monitoredNode = &HBcons->monitoredNodes[i];
+            CO_HBconsNode_t* const monitoredNode = &nodes[i];
             monitoredNode->NMTstate = CO_NMT_UNKNOWN;
 #if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0)                                                     \
     || (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_MULTI) != 0)
@@ -413,13 +761,64 @@ CO_HBconsumer_process(CO_HBconsumer_t* HBcons, bool_t NMTisPreOrOperational, uin
             CO_FLAG_CLEAR(monitoredNode->CANrxNew);
             if (monitoredNode->HBstate != CO_HBconsumer_UNCONFIGURED) {
                 monitoredNode->HBstate = CO_HBconsumer_UNKNOWN;
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+                CO_HBcons_netHBstate(HBcons, monitoredNode->nodeId, CO_HBconsumer_UNKNOWN);
+#endif
             }
+            monitoredNode->heapPos = CO_HBCONS_HEAP_NONE;
         }
+        HBcons->heapCount = 0;
+        HBcons->countActive = 0;
+        HBcons->countOperational = 0;
         allMonitoredActiveCurrent = false;
         allMonitoredOperationalCurrent = false;
     } else { /* MISRA C 2004 14.10 */
     }
 
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+    CO_HBconsumer_netTable_t* netTable = HBcons->netTable;
+    if (netTable != NULL) {
+        HBcons->netTimer_us += timeDifference_us;
+        netTable->time_ms += HBcons->netTimer_us / 1000U;
+        HBcons->netTimer_us %= 1000U;
+
+        /* If heartbeat consumer is not working, apply messages from monitored nodes only to the table. */
+        if (!NMTisPreOrOperational || !HBcons->NMTisPreOrOperationalPrev) {
+            for (uint8_t n = 0; n < HBcons->numberOfMonitoredNodes; n++) {
+                uint8_t i;
+                CO_NMT_internalState_t NMTstate;
+
+                if (!CO_HBcons_rxQueueGet(HBcons, &i, &NMTstate)) {
+                    break;
+                }
+                if (i != CO_HBCONS_HEAP_NONE) {
+                    CO_HBcons_netReceived(HBcons, nodes[i].nodeId, (uint8_t)NMTstate);
+                }
+            }
+        }
+
+        /* Messages from nodes, which are not monitored */
+        for (uint8_t n = 0; n < 128U; n++) {
+            CO_HBconsumer_netRx_t* slot = &HBcons->netRx[HBcons->netRxQueueTail];
+            if (!CO_FLAG_READ(slot->rxQueueFull)) {
+                break;
+            }
+            uint8_t nodeId = slot->rxQueueNodeId;
+            CO_FLAG_CLEAR(slot->rxQueueFull);
+            HBcons->netRxQueueTail = (HBcons->netRxQueueTail + 1U) & 0x7FU;
+
+            CO_HBconsumer_netRx_t* netRx = &HBcons->netRx[nodeId];
+            CO_FLAG_CLEAR(netRx->rxQueued);
+            CO_HBcons_netReceived(HBcons, nodeId, netRx->NMTstateRx);
+        }
+
+        /* finish the update */
+        if ((netTable->sequence & 1U) != 0U) {
+            netTable->sequence++;
+        }
+    }
+#endif
+
     /* Clear emergencies when all monitored nodes becomes active.
      * We only have one emergency index for all monitored nodes! */
     if (!HBcons->allMonitoredActive && allMonitoredActiveCurrent) {
@@ -50,6 +50,11 @@ extern "C" {
  * _allMonitoredOperational_ inside CO_HBconsumer_t is set to true. Monitoring starts after the reception of the first
  * HeartBeat (not bootup).
  *
+ * Processing is event driven, so its cost does not depend on the number of monitored nodes. Receive callback puts the
+ * node into the receive queue. Each active node has a deadline, nodes are sorted by deadlines in binary heap.
+ * CO_HBconsumer_process() only handles nodes from the receive queue and nodes with expired deadline. Queue and heap are
+ * stored inside the array of monitored nodes, so no additional memory has to be provided.
+ *
  * Heartbeat set up is done by writing to the OD registers 0x1016. To setup heartbeat consumer by application, use
  * @code ODR_t odRet = OD_set_u32(entry, subIndex, val, false); @endcode
  *
@@ -70,12 +75,21 @@ typedef enum {
  * One monitored node inside CO_HBconsumer_t.
  */
 typedef struct {
-    uint8_t nodeId;                  /**< Node Id of the monitored node */
-    CO_NMT_internalState_t NMTstate; /**< NMT state of the remote node (Heartbeat payload) */
-    CO_HBconsumer_state_t HBstate;   /**< Current heartbeat monitoring state of the remote node */
-    uint32_t timeoutTimer;           /**< Time since last heartbeat received */
-    uint32_t time_us;                /**< Consumer heartbeat time from OD */
-    volatile void* CANrxNew;         /**< Indication if new Heartbeat message received from the CAN bus */
+    uint8_t nodeId;                    /**< Node Id of the monitored node */
+    CO_NMT_internalState_t NMTstate;   /**< NMT state of the remote node (Heartbeat payload), as processed */
+    CO_HBconsumer_state_t HBstate;     /**< Current heartbeat monitoring state of the remote node */
+    uint32_t deadline_us;              /**< Heartbeat timeout time, compared with CO_HBconsumer_t::timer_us */
+    uint32_t time_us;                  /**< Consumer heartbeat time from OD */
+    volatile void* CANrxNew;           /**< Indication if new Heartbeat message received from the CAN bus */
+    CO_NMT_internalState_t NMTstateRx; /**< NMT state from the last received Heartbeat message */
+    volatile void* rxQueued;           /**< Indication if node is inside the receive queue */
+    void* HBcons;                      /**< CO_HBconsumer_t object, which contains this node */
+    /* Elements of the receive queue and of the deadline heap. They belong to the CO_HBconsumer_t object and have no
+     * relation to this node, array of monitored nodes is just used as storage. */
+    volatile void* rxQueueFull; /**< Indication if this element of the receive queue is used */
+    uint8_t rxQueueIdx;         /**< Index of the queued node */
+    uint8_t heapIdx;            /**< Index of the node at this position in the deadline heap */
+    uint8_t heapPos;            /**< Position of this node in the deadline heap or 0xFF, if not there */
 #if (((CO_CONFIG_HB_CONS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0) || defined CO_DOXYGEN
     void (*pFunctSignalPre)(void* object); /**< From CO_HBconsumer_initCallbackPre() or NULL */
     void* functSignalObjectPre;            /**< From CO_HBconsumer_initCallbackPre() or NULL */
@@ -101,6 +115,90 @@ typedef struct {
 #endif
 } CO_HBconsNode_t;
 
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0) || defined CO_DOXYGEN
+/** Number of elements in CO_HBconsumer_netTable_t::log, must be power of 2 */
+#ifndef CO_HBCONS_NET_LOG_SIZE
+#define CO_HBCONS_NET_LOG_SIZE 64U
+#endif
+
+#define CO_HBCONS_NET_MAGIC   0x424E4F43UL /**< "CONB" in little-endian, see CO_HBconsumer_netTable_t::magic */
+#define CO_HBCONS_NET_VERSION 1U           /**< See CO_HBconsumer_netTable_t::version */
+
+/**
+ * Event in the log of the network state table
+ */
+typedef enum {
+    CO_HBconsumer_NET_NMT_CHANGED = 0x01U, /**< NMT state from the received message changed (also the first message) */
+    CO_HBconsumer_NET_BOOTUP = 0x02U,      /**< Bootup message received */
+    CO_HBconsumer_NET_HB_STARTED = 0x03U,  /**< Monitored node became CO_HBconsumer_ACTIVE */
+    CO_HBconsumer_NET_TIMEOUT = 0x04U,     /**< Heartbeat consumer timeout of the monitored node */
+} CO_HBconsumer_netEvent_t;
+
+/**
+ * State of one node in the network state table, 12 bytes.
+ */
+typedef struct {
+    uint8_t NMTstate;      /**< CO_NMT_internalState_t from the last message, 0xFF (CO_NMT_UNKNOWN) if unknown */
+    uint8_t HBstate;       /**< CO_HBconsumer_state_t, CO_HBconsumer_UNCONFIGURED if node is not monitored */
+    uint16_t bootupCount;  /**< Number of received bootup messages */
+    uint16_t timeoutCount; /**< Number of heartbeat consumer timeouts */
+    uint16_t changeCount;  /**< Number of NMT state changes, zero if node was never seen, saturates at 0xFFFF */
+    uint32_t lastSeen_ms;  /**< CO_HBconsumer_netTable_t::time_ms, when the last message was received */
+} CO_HBconsumer_netNode_t;
+
+/**
+ * Element of the log of changes in the network state table, 8 bytes.
+ */
+typedef struct {
+    uint32_t time_ms; /**< CO_HBconsumer_netTable_t::time_ms of the event */
+    uint8_t nodeId;   /**< Node-ID of the remote node */
+    uint8_t event;    /**< CO_HBconsumer_netEvent_t */
+    uint8_t NMTstate; /**< New NMT state, see CO_HBconsumer_netNode_t */
+    uint8_t HBstate;  /**< New heartbeat state, see CO_HBconsumer_netNode_t */
+} CO_HBconsumer_netLog_t;
+
+/**
+ * Network state table, non-standard.
+ *
+ * Table contains state of all nodes in the network, indexed by node-ID. It is updated from Heartbeat (or bootup)
+ * messages of monitored nodes and from all other Heartbeat messages received on the CAN bus. Messages are received
+ * in receive callbacks and applied to the table inside CO_HBconsumer_process(), so table is always written by the same
+ * thread. Table also contains a ring buffer with log of changes. Each element of the log has sequence number: element
+ * with sequence number 'seq' is stored at log[seq % CO_HBCONS_NET_LOG_SIZE]. Available are log elements from
+ * (logCount - CO_HBCONS_NET_LOG_SIZE) to (logCount - 1), older are overwritten. Client remembers logCount and later
+ * reads new elements.
+ *
+ * Structure contains no pointers and has fixed layout with little-endian values (on little-endian machine), so copy of
+ * it can be exported to other programs, for example via shared memory. Reader in other thread must use
+ * CO_HBconsumer_netTable_t::sequence: read it (retry if odd), copy the table, then read it again and retry, if it
+ * changed.
+ */
+typedef struct {
+    uint32_t magic;                                     /**< CO_HBCONS_NET_MAGIC */
+    uint16_t version;                                   /**< CO_HBCONS_NET_VERSION */
+    uint16_t logSize;                                   /**< CO_HBCONS_NET_LOG_SIZE */
+    volatile uint32_t sequence;                         /**< Incremented before and after each update of the table */
+    volatile uint32_t time_ms;                          /**< Current time in milliseconds, not covered by sequence */
+    uint32_t logCount;                                  /**< Number of all events written into log */
+    uint32_t reserved;                                  /**< Reserved, zero */
+    CO_HBconsumer_netNode_t nodes[128];                 /**< State of nodes, indexed by node-ID, element 0 is unused */
+    CO_HBconsumer_netLog_t log[CO_HBCONS_NET_LOG_SIZE]; /**< Log of changes, see description above */
+} CO_HBconsumer_netTable_t;
+
+/**
+ * Message from the node, which is not monitored, waiting to be applied to network state table. Used internally inside
+ * CO_HBconsumer_t, indexed by node-ID.
+ */
+typedef struct {
+    volatile void* rxQueued;    /**< Indication if node is inside the receive queue */
+    volatile void* rxQueueFull; /**< Element of the receive queue: indication if used */
+    uint16_t bootupRx;          /**< Number of bootup messages, counted by receive callbacks */
+    uint16_t bootupRxProcessed; /**< Number of bootup messages, already applied to the table */
+    uint8_t NMTstateRx;         /**< NMT state from the last received message */
+    uint8_t rxQueueNodeId;      /**< Element of the receive queue: node-ID */
+} CO_HBconsumer_netRx_t;
+#endif /* (CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE */
+
 /**
  * Heartbeat consumer object.
  *
@@ -116,11 +214,25 @@ typedef struct {
     bool_t allMonitoredOperational;   /**< True, if all monitored nodes are NMT operational or no node is monitored. Can
                                          be read by the application */
     bool_t NMTisPreOrOperationalPrev; /**< previous state of the variable */
+    uint32_t timer_us;                /**< Sum of timeDifference_us, time base for deadlines of monitored nodes */
+    uint8_t countConfigured;          /**< Number of monitored nodes, which are not CO_HBconsumer_UNCONFIGURED */
+    uint8_t countActive;              /**< Number of monitored nodes, which are CO_HBconsumer_ACTIVE */
+    uint8_t countOperational;         /**< Number of monitored nodes, which are CO_NMT_OPERATIONAL */
+    uint8_t heapCount;                /**< Number of nodes in the deadline heap */
+    uint8_t rxQueueHead;              /**< Write position in the receive queue, used by receive callback only */
+    uint8_t rxQueueTail;              /**< Read position in the receive queue */
     CO_CANmodule_t* CANdevRx;         /**< From CO_HBconsumer_init() */
     uint16_t CANdevRxIdxStart;        /**< From CO_HBconsumer_init() */
 #if (((CO_CONFIG_HB_CONS)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
     OD_extension_t OD_1016_extension; /**< Extension for OD object */
 #endif
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0) || defined CO_DOXYGEN
+    CO_HBconsumer_netTable_t* netTable; /**< From CO_HBconsumer_initNetTable() or NULL */
+    uint32_t netTimer_us;               /**< Time in microseconds, which is not yet added to netTable->time_ms */
+    uint8_t netRxQueueHead;             /**< Write position in the receive queue, used by receive callback only */
+    uint8_t netRxQueueTail;             /**< Read position in the receive queue */
+    CO_HBconsumer_netRx_t netRx[128];   /**< Received messages and receive queue for the network table */
+#endif
 #if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_CALLBACK_CHANGE) != 0) || defined CO_DOXYGEN
     /** Callback for remote NMT changed event.  From CO_HBconsumer_initCallbackNmtChanged() or NULL. */
     void (*pFunctSignalNmtChanged)(uint8_t nodeId, uint8_t idx, CO_NMT_internalState_t NMTstate, void* object);
@@ -226,10 +338,31 @@ void CO_HBconsumer_initCallbackRemoteReset(CO_HBconsumer_t* HBcons, uint8_t idx,
                                            void (*pFunctSignal)(uint8_t nodeId, uint8_t idx, void* object));
 #endif /* (CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_CALLBACK_MULTI */
 
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize network state table, non-standard.
+ *
+ * Function must be called after CO_HBconsumer_init(). It configures CAN receive buffer for Heartbeat messages from all
+ * nodes, which are not monitored. That buffer must be after all other receive buffers, which may receive the same CAN
+ * identifiers (Heartbeat consumer, Node guarding master, gateway subscriptions). If table does not contain valid data
+ * (magic), it is cleared. Otherwise counters and log are preserved, for example after communication reset.
+ *
+ * @param HBcons This object.
+ * @param netTable Network state table, must exist permanently.
+ * @param CANdevRx CAN device for Heartbeat reception.
+ * @param CANdevRxIdx Index of receive buffer in the above CAN device.
+ *
+ * @return @ref CO_ReturnError_t CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_HBconsumer_initNetTable(CO_HBconsumer_t* HBcons, CO_HBconsumer_netTable_t* netTable,
+                                            CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx);
+#endif
+
 /**
  * Process Heartbeat consumer object.
  *
- * Function must be called cyclically.
+ * Function must be called cyclically. It processes only nodes with received Heartbeat message and nodes with expired
+ * Heartbeat consumer time.
  *
  * @param HBcons This object.
  * @param NMTisPreOrOperational True if this node is NMT_PRE_OPERATIONAL or NMT_OPERATIONAL.
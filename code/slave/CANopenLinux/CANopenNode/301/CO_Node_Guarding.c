@@ -231,14 +231,18 @@ CO_nodeGuardingSlave_process(CO_nodeGuardingSlave_t* ngs, CO_NMT_internalState_t
 #endif /* (CO_CONFIG_NODE_GUARDING) & CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE */
 
 #if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_ENABLE) != 0
+
+/* Position in the deadline heap for the node, which is not in the heap */
+#define CO_NGM_HEAP_NONE 0xFFU
+
 /*
  * Read received message from CAN module.
  *
  * Function will be called (by CAN receive interrupt) every time, when CAN message with correct identifier
  * will be received. For more information and description of parameters see file CO_driver.h.
  *
- * Function receives messages from CAN identifier from 0x700 to 0x7FF. It
- * searches matching node->ident from nodes array.
+ * Function receives messages from CAN identifier from 0x700 to 0x7FF. Monitored node is found from nodeSlot table,
+ * indexed by Node Id.
  */
 static void
 CO_ngm_receive(void* object, void* msg) {
@@ -247,24 +251,162 @@ CO_ngm_receive(void* object, void* msg) {
     uint8_t DLC = CO_CANrxMsg_readDLC(msg);
     const uint8_t* data = CO_CANrxMsg_readData(msg);
     uint16_t ident = CO_CANrxMsg_readIdent(msg);
-    CO_nodeGuardingMasterNode_t* node = &ngm->nodes[0];
-
-    if (DLC == 1) {
-        for (uint8_t i = 0; i < CO_CONFIG_NODE_GUARDING_MASTER_COUNT; i++) {
-            if (ident == node->ident) {
-                uint8_t toggle = data[0] & 0x80;
-                if (toggle == node->toggle) {
-                    node->responseRecived = true;
-                    node->NMTstate = (CO_NMT_internalState_t)(data[0] & 0x7F);
-                    node->toggle = (toggle != 0) ? 0x00 : 0x80;
+    uint8_t slot = ngm->nodeSlot[ident & 0x7FU];
+
+    if ((DLC == 1U) && (slot != 0U)) {
+        CO_nodeGuardingMasterNode_t* node = &ngm->nodes[slot - 1U];
+        uint8_t toggle = data[0] & 0x80U;
+
+        if ((ident == node->ident) && (toggle == node->toggle)) {
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+            if (ngm->pFunctClock_us != NULL) {
+                node->rxTime_us = (uint32_t)ngm->pFunctClock_us(ngm->functClockObject);
+            }
+#endif
+            node->responseRecived = true;
+            node->NMTstateRx = (CO_NMT_internalState_t)(data[0] & 0x7FU);
+            node->toggle = (toggle != 0U) ? 0x00U : 0x80U;
+            CO_FLAG_SET(node->CANrxNew);
+
+            /* Put the node into the receive queue, if not already there. Node is removed from the queue only inside
+             * CO_nodeGuardingMaster_process(), so queue never contains more elements than there are nodes. */
+            if (!CO_FLAG_READ(node->rxQueued)) {
+                CO_nodeGuardingMasterNode_t* queueSlot = &ngm->nodes[ngm->rxQueueHead];
+                if (!CO_FLAG_READ(queueSlot->rxQueueFull)) {
+                    queueSlot->rxQueueIdx = (uint8_t)(slot - 1U);
+                    CO_FLAG_SET(node->rxQueued);
+                    CO_FLAG_SET(queueSlot->rxQueueFull);
+                    ngm->rxQueueHead++;
+                    if (ngm->rxQueueHead >= CO_CONFIG_NODE_GUARDING_MASTER_COUNT) {
+                        ngm->rxQueueHead = 0;
+                    }
                 }
-                break;
             }
-            node++;
         }
     }
 }
 
+/* Deadline of the node at heap position 'a' is before deadline of the node at heap position 'b' (overflow safe) */
+static inline bool_t
+CO_ngm_heapBefore(const CO_nodeGuardingMasterNode_t* nodes, uint8_t a, uint8_t b) {
+    return (int32_t)(nodes[nodes[a].heapIdx].deadline_us - nodes[nodes[b].heapIdx].deadline_us) < 0;
+}
+
+/* Exchange two elements of the deadline heap */
+static void
+CO_ngm_heapSwap(CO_nodeGuardingMasterNode_t* nodes, uint8_t a, uint8_t b) {
+    uint8_t idx = nodes[a].heapIdx;
+    nodes[a].heapIdx = nodes[b].heapIdx;
+    nodes[b].heapIdx = idx;
+    nodes[nodes[a].heapIdx].heapPos = a;
+    nodes[nodes[b].heapIdx].heapPos = b;
+}
+
+/* Restore heap order after the deadline of the element at position 'pos' has changed */
+static void
+CO_ngm_heapFix(CO_nodeGuardingMaster_t* ngm, uint8_t pos) {
+    CO_nodeGuardingMasterNode_t* nodes = ngm->nodes;
+
+    while ((pos > 0U) && CO_ngm_heapBefore(nodes, pos, (uint8_t)((pos - 1U) / 2U))) {
+        uint8_t parent = (uint8_t)((pos - 1U) / 2U);
+        CO_ngm_heapSwap(nodes, pos, parent);
+        pos = parent;
+    }
+    for (;;) {
+        uint16_t child = ((uint16_t)pos * 2U) + 1U;
+        if (child >= ngm->heapCount) {
+            break;
+        }
+        if (((child + 1U) < ngm->heapCount) && CO_ngm_heapBefore(nodes, (uint8_t)(child + 1U), (uint8_t)child)) {
+            child++;
+        }
+        if (!CO_ngm_heapBefore(nodes, (uint8_t)child, pos)) {
+            break;
+        }
+        CO_ngm_heapSwap(nodes, pos, (uint8_t)child);
+        pos = (uint8_t)child;
+    }
+}
+
+/* Insert the node into the deadline heap or move it after its deadline has changed */
+static void
+CO_ngm_schedule(CO_nodeGuardingMaster_t* ngm, uint8_t idx) {
+    CO_nodeGuardingMasterNode_t* nodes = ngm->nodes;
+    uint8_t pos = nodes[idx].heapPos;
+
+    if (pos == CO_NGM_HEAP_NONE) {
+        pos = ngm->heapCount;
+        ngm->heapCount++;
+        nodes[pos].heapIdx = idx;
+        nodes[idx].heapPos = pos;
+    }
+    CO_ngm_heapFix(ngm, pos);
+}
+
+/* Remove the node from the deadline heap, if it is there */
+static void
+CO_ngm_unschedule(CO_nodeGuardingMaster_t* ngm, uint8_t idx) {
+    CO_nodeGuardingMasterNode_t* nodes = ngm->nodes;
+    uint8_t pos = nodes[idx].heapPos;
+
+    if (pos == CO_NGM_HEAP_NONE) {
+        return;
+    }
+    ngm->heapCount--;
+    if (pos < ngm->heapCount) {
+        CO_ngm_heapSwap(nodes, pos, ngm->heapCount);
+        CO_ngm_heapFix(ngm, pos);
+    }
+    nodes[idx].heapPos = CO_NGM_HEAP_NONE;
+}
+
+/* Set monitoringActive of the monitored node and update the counter */
+static void
+CO_ngm_setActive(CO_nodeGuardingMaster_t* ngm, CO_nodeGuardingMasterNode_t* node, bool_t active) {
+    if (node->monitoringActive) {
+        ngm->countActive--;
+    }
+    if (active) {
+        ngm->countActive++;
+    }
+    node->monitoringActive = active;
+}
+
+/* Set NMT state of the monitored node and update the counter */
+static void
+CO_ngm_setNMTstate(CO_nodeGuardingMaster_t* ngm, CO_nodeGuardingMasterNode_t* node, CO_NMT_internalState_t NMTstate) {
+    if (node->NMTstate == CO_NMT_OPERATIONAL) {
+        ngm->countOperational--;
+    }
+    if (NMTstate == CO_NMT_OPERATIONAL) {
+        ngm->countOperational++;
+    }
+    node->NMTstate = NMTstate;
+}
+
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+/* Update round-trip statistics with the received response */
+static void
+CO_ngm_statResponse(CO_nodeGuardingMaster_t* ngm, CO_nodeGuardingMasterNode_t* node) {
+    CO_nodeGuardingMasterStatistics_t* stat = &node->stat;
+
+    stat->responses++;
+    if (ngm->pFunctClock_us != NULL) {
+        uint32_t rtt = node->rxTime_us - node->txTime_us;
+
+        stat->rttLast_us = rtt;
+        if ((stat->rttMin_us == 0U) || (rtt < stat->rttMin_us)) {
+            stat->rttMin_us = rtt;
+        }
+        if (rtt > stat->rttMax_us) {
+            stat->rttMax_us = rtt;
+        }
+        node->rttAcc = (node->rttAcc == 0U) ? (rtt << 4) : (node->rttAcc - (node->rttAcc >> 4) + rtt);
+        stat->rttAvg_us = node->rttAcc >> 4;
+    }
+}
+#endif
+
 CO_ReturnError_t
 CO_nodeGuardingMaster_init(CO_nodeGuardingMaster_t* ngm, CO_EM_t* em, CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx,
                            CO_CANmodule_t* CANdevTx, uint16_t CANdevTxIdx) {
@@ -280,6 +422,9 @@ CO_nodeGuardingMaster_init(CO_nodeGuardingMaster_t* ngm, CO_EM_t* em, CO_CANmodu
 
     /* Configure object variables */
     ngm->em = em;
+    for (uint8_t i = 0; i < CO_CONFIG_NODE_GUARDING_MASTER_COUNT; i++) {
+        ngm->nodes[i].heapPos = CO_NGM_HEAP_NONE;
+    }
 
     /* configure CAN reception. One buffer will receive all messages from CAN-id 0x700 to 0x7FF. */
     ret = CO_CANrxBufferInit(CANdevRx, CANdevRxIdx, CO_CAN_ID_HEARTBEAT, 0x780, false, (void*)ngm, CO_ngm_receive);
@@ -306,14 +451,42 @@ CO_nodeGuardingMaster_initNode(CO_nodeGuardingMaster_t* ngm, uint8_t index, uint
 
     CO_nodeGuardingMasterNode_t* node = &ngm->nodes[index];
 
+    /* remove previous configuration from the counters, from the deadline heap and from the nodeSlot table */
+    if (node->guardTime_us > 0U && node->ident > CO_CAN_ID_HEARTBEAT) {
+        CO_ngm_setActive(ngm, node, false);
+        CO_ngm_setNMTstate(ngm, node, CO_NMT_UNKNOWN);
+        ngm->countMonitored--;
+    }
+    CO_ngm_unschedule(ngm, index);
+    if (node->ident > CO_CAN_ID_HEARTBEAT && ngm->nodeSlot[node->ident & 0x7FU] == (index + 1U)) {
+        ngm->nodeSlot[node->ident & 0x7FU] = 0;
+    }
+
     node->guardTime_us = (uint32_t)guardTime_ms * 1000;
-    node->guardTimer = 0;
     node->ident = CO_CAN_ID_HEARTBEAT + nodeId;
     node->NMTstate = CO_NMT_UNKNOWN; /* for the first time */
     node->toggle = false;
     node->responseRecived = true; /* for the first time */
     node->CANtxWasBusy = false;
     node->monitoringActive = false;
+    CO_FLAG_CLEAR(node->CANrxNew);
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+    node->rttAcc = 0;
+    (void)memset(&node->stat, 0, sizeof(node->stat));
+#endif
+
+    if (node->guardTime_us > 0U) {
+        /* Delay the first rtr message for a fraction of the guard time, which is the index with reversed bit order
+         * divided by 128. Consecutive indexes are then spread evenly across the guard time. */
+        uint8_t phase = 0;
+        for (uint8_t bit = 0; bit < 7U; bit++) {
+            phase = (uint8_t)((uint8_t)(phase << 1) | ((index >> bit) & 1U));
+        }
+        node->deadline_us = ngm->timer_us + (uint32_t)(((uint64_t)node->guardTime_us * phase) >> 7);
+        CO_ngm_schedule(ngm, index);
+        ngm->countMonitored++;
+    }
+    ngm->nodeSlot[nodeId] = (uint8_t)(index + 1U);
 
 #if CO_CONFIG_NODE_GUARDING_MASTER_COUNT == 1
     ngm->CANtxBuff = CO_CANtxBufferInit(ngm->CANdevTx, ngm->CANdevTxIdx, node->ident, true, 1, 0);
@@ -322,67 +495,110 @@ CO_nodeGuardingMaster_initNode(CO_nodeGuardingMaster_t* ngm, uint8_t index, uint
     return CO_ERROR_NO;
 }
 
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+void
+CO_nodeGuardingMaster_initClock(CO_nodeGuardingMaster_t* ngm, void* object, uint64_t (*pFunctClock_us)(void* object)) {
+    if (ngm != NULL) {
+        ngm->functClockObject = object;
+        ngm->pFunctClock_us = pFunctClock_us;
+    }
+}
+#endif
+
 void
 CO_nodeGuardingMaster_process(CO_nodeGuardingMaster_t* ngm, uint32_t timeDifference_us, uint32_t* timerNext_us) {
     (void)timerNext_us; /* may be unused */
-    bool_t allMonitoredActiveCurrent = true;
-    bool_t allMonitoredOperationalCurrent = true;
-    CO_nodeGuardingMasterNode_t* node = &ngm->nodes[0];
+    CO_nodeGuardingMasterNode_t* const nodes = ngm->nodes;
 
-    for (uint8_t i = 0; i < CO_CONFIG_NODE_GUARDING_MASTER_COUNT; i++) {
-        if (node->guardTime_us > 0 && node->ident > CO_CAN_ID_HEARTBEAT) {
-            if (timeDifference_us < node->guardTimer) {
-                node->guardTimer -= timeDifference_us;
-#if ((CO_CONFIG_NMT)&CO_CONFIG_FLAG_TIMERNEXT) != 0
-                /* Calculate, when timeout expires */
-                if (timerNext_us != NULL && *timerNext_us > node->guardTimer) {
-                    *timerNext_us = node->guardTimer;
-                }
-#endif
-            } else {
-                /* it is time to send new rtr, but first verify last response */
-                if (!node->CANtxWasBusy) {
-                    if (!node->responseRecived) {
-                        node->monitoringActive = false;
-                        /* error bit is shared with HB consumer */
-                        CO_errorReport(ngm->em, CO_EM_HEARTBEAT_CONSUMER, CO_EMC_HEARTBEAT, node->ident & 0x7F);
-                    } else if (node->NMTstate != CO_NMT_UNKNOWN) {
-                        node->monitoringActive = true;
-                        CO_errorReset(ngm->em, CO_EM_HEARTBEAT_CONSUMER, node->ident & 0x7F);
-                    }
-                }
+    ngm->timer_us += timeDifference_us;
 
-                if (ngm->CANtxBuff->bufferFull) {
-                    node->guardTimer = 0;
-                    node->CANtxWasBusy = true;
-                } else {
-#if CO_CONFIG_NODE_GUARDING_MASTER_COUNT > 1
-                    ngm->CANtxBuff = CO_CANtxBufferInit(ngm->CANdevTx, ngm->CANdevTxIdx, node->ident, true, 1, 0);
+    /* Nodes from the receive queue. Limit the loop, if messages are received concurrently. */
+    for (uint8_t n = 0; n < CO_CONFIG_NODE_GUARDING_MASTER_COUNT; n++) {
+        CO_nodeGuardingMasterNode_t* queueSlot = &nodes[ngm->rxQueueTail];
+        if (!CO_FLAG_READ(queueSlot->rxQueueFull)) {
+            break;
+        }
+        CO_nodeGuardingMasterNode_t* node = &nodes[queueSlot->rxQueueIdx];
+        CO_FLAG_CLEAR(queueSlot->rxQueueFull);
+        ngm->rxQueueTail++;
+        if (ngm->rxQueueTail >= CO_CONFIG_NODE_GUARDING_MASTER_COUNT) {
+            ngm->rxQueueTail = 0;
+        }
+
+        /* Clear flags before reading the message. Message received after that is queued again. */
+        CO_FLAG_CLEAR(node->rxQueued);
+        if (!CO_FLAG_READ(node->CANrxNew) || node->guardTime_us == 0U) {
+            /* message was discarded or node is not monitored */
+            continue;
+        }
+        CO_FLAG_CLEAR(node->CANrxNew);
+        CO_ngm_setNMTstate(ngm, node, node->NMTstateRx);
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+        CO_ngm_statResponse(ngm, node);
 #endif
-                    (void)CO_CANsend(ngm->CANdevTx, ngm->CANtxBuff);
-                    node->CANtxWasBusy = false;
-                    node->responseRecived = false;
-                    node->guardTimer = node->guardTime_us;
-                }
+    }
+
+    /* Nodes with expired guard time, the earliest one is on the top of the heap */
+    while (ngm->heapCount > 0U) {
+        uint8_t i = nodes[0].heapIdx;
+        CO_nodeGuardingMasterNode_t* node = &nodes[i];
+        uint32_t diff = node->deadline_us - ngm->timer_us;
+
+        if ((int32_t)diff > 0) {
+#if ((CO_CONFIG_NMT)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+            /* Calculate, when the next rtr message is due */
+            if (timerNext_us != NULL && *timerNext_us > diff) {
+                *timerNext_us = diff;
             }
+#endif
+            break;
+        }
 
-            if (allMonitoredActiveCurrent) {
-                if (node->monitoringActive) {
-                    if (node->NMTstate != CO_NMT_OPERATIONAL) {
-                        allMonitoredOperationalCurrent = false;
-                    }
-                } else {
-                    allMonitoredActiveCurrent = false;
-                    allMonitoredOperationalCurrent = false;
-                }
+        /* it is time to send new rtr, but first verify last response */
+        if (!node->CANtxWasBusy) {
+            if (!node->responseRecived) {
+                CO_ngm_setActive(ngm, node, false);
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+                node->stat.missing++;
+#endif
+                /* error bit is shared with HB consumer */
+                CO_errorReport(ngm->em, CO_EM_HEARTBEAT_CONSUMER, CO_EMC_HEARTBEAT, node->ident & 0x7F);
+            } else if (node->NMTstate != CO_NMT_UNKNOWN) {
+                CO_ngm_setActive(ngm, node, true);
+                CO_errorReset(ngm->em, CO_EM_HEARTBEAT_CONSUMER, node->ident & 0x7F);
+            } else { /* MISRA C 2004 14.10 */
             }
-        } /* if node enabled */
+        }
 
-        node++;
-    } /* for */
+        if (ngm->CANtxBuff->bufferFull) {
+            /* Node stays on the top of the heap and is tried again in the next call, other nodes wait for it. */
+            node->CANtxWasBusy = true;
+            break;
+        }
+#if CO_CONFIG_NODE_GUARDING_MASTER_COUNT > 1
+        ngm->CANtxBuff = CO_CANtxBufferInit(ngm->CANdevTx, ngm->CANdevTxIdx, node->ident, true, 1, 0);
+#endif
+#if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0
+        if (ngm->pFunctClock_us != NULL) {
+            node->txTime_us = (uint32_t)ngm->pFunctClock_us(ngm->functClockObject);
+        }
+        node->stat.requests++;
+#endif
+        (void)CO_CANsend(ngm->CANdevTx, ngm->CANtxBuff);
+        node->CANtxWasBusy = false;
+        node->responseRecived = false;
+
+        /* Keep the schedule, so nodes remain spread across the guard time. If processing was late for more than the
+         * guard time, start the new schedule from now. */
+        node->deadline_us += node->guardTime_us;
+        if ((int32_t)(node->deadline_us - ngm->timer_us) <= 0) {
+            node->deadline_us = ngm->timer_us + node->guardTime_us;
+        }
+        CO_ngm_heapFix(ngm, 0);
+    }
 
-    ngm->allMonitoredActive = allMonitoredActiveCurrent;
-    ngm->allMonitoredOperational = allMonitoredOperationalCurrent;
+    ngm->allMonitoredActive = ngm->countActive == ngm->countMonitored;
+    ngm->allMonitoredOperational = ngm->allMonitoredActive && (ngm->countOperational == ngm->countMonitored);
 
     return;
 }
@@ -161,18 +161,49 @@ extern "C" {
  * @{
  */
 
+/**
+ * Node Guarding master - round-trip statistics of the monitored node
+ *
+ * Round-trip time is measured from transmission of rtr message to reception of the response, only if clock is
+ * configured with CO_nodeGuardingMaster_initClock(). Statistics are reset by CO_nodeGuardingMaster_initNode().
+ */
+typedef struct {
+    uint32_t requests;   /**< Number of transmitted rtr messages */
+    uint32_t responses;  /**< Number of received responses with correct toggle bit */
+    uint32_t missing;    /**< Number of rtr messages without response within guard time */
+    uint32_t rttLast_us; /**< Last measured round-trip time */
+    uint32_t rttMin_us;  /**< Minimum measured round-trip time */
+    uint32_t rttMax_us;  /**< Maximum measured round-trip time */
+    uint32_t rttAvg_us;  /**< Average round-trip time, exponential with factor 1/16 */
+} CO_nodeGuardingMasterStatistics_t;
+
 /**
  * Node Guarding master - monitored node
  */
 typedef struct {
-    uint32_t guardTime_us;           /**< Guard time in microseconds */
-    uint32_t guardTimer;             /**< Guard timer in microseconds, counting down */
-    uint16_t ident;                  /**< CAN identifier (CO_CAN_ID_HEARTBEAT + Node Id) */
-    CO_NMT_internalState_t NMTstate; /**< NMT operating state */
-    uint8_t toggle;                  /**< toggle bit7, expected from the next received message */
-    bool_t responseRecived;          /**< True, if response was received since last rtr message */
-    bool_t CANtxWasBusy;             /**< True, if CANtxBuff was busy since last processing */
-    bool_t monitoringActive;         /**< True, if monitoring is active (response within time). */
+    uint32_t guardTime_us;             /**< Guard time in microseconds */
+    uint32_t deadline_us;              /**< Time of the next rtr message, compared with master timer_us */
+    uint16_t ident;                    /**< CAN identifier (CO_CAN_ID_HEARTBEAT + Node Id) */
+    CO_NMT_internalState_t NMTstate;   /**< NMT operating state, as processed */
+    uint8_t toggle;                    /**< toggle bit7, expected from the next received message */
+    bool_t responseRecived;            /**< True, if response was received since last rtr message */
+    bool_t CANtxWasBusy;               /**< True, if CANtxBuff was busy since last processing */
+    bool_t monitoringActive;           /**< True, if monitoring is active (response within time). */
+    volatile void* CANrxNew;           /**< Indication if new response was received from the CAN bus */
+    CO_NMT_internalState_t NMTstateRx; /**< NMT state from the last received response */
+    volatile void* rxQueued;           /**< Indication if node is inside the receive queue */
+    uint8_t heapPos;                   /**< Position of this node in the deadline heap or 0xFF, if not there */
+    /* Elements of the receive queue and of the deadline heap. They belong to the CO_nodeGuardingMaster_t object and
+     * have no relation to this node, array of monitored nodes is just used as storage. */
+    volatile void* rxQueueFull; /**< Indication if this element of the receive queue is used */
+    uint8_t rxQueueIdx;         /**< Index of the queued node */
+    uint8_t heapIdx;            /**< Index of the node at this position in the deadline heap */
+#if (((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0) || defined CO_DOXYGEN
+    uint32_t txTime_us;                     /**< Clock at transmission of the last rtr message */
+    uint32_t rxTime_us;                     /**< Clock at reception of the last response */
+    uint32_t rttAcc;                        /**< Accumulator for CO_nodeGuardingMasterStatistics_t::rttAvg_us */
+    CO_nodeGuardingMasterStatistics_t stat; /**< Round-trip statistics, can be read by the application */
+#endif
 } CO_nodeGuardingMasterNode_t;
 
 /**
@@ -187,6 +218,18 @@ typedef struct {
                                   application */
     bool_t allMonitoredOperational; /**< True, if all monitored nodes are NMT operational or no node is monitored. Can
                                        be read by the application */
+    uint32_t timer_us;              /**< Sum of timeDifference_us, time base for deadlines of monitored nodes */
+    uint8_t countMonitored;         /**< Number of nodes with guard time configured */
+    uint8_t countActive;            /**< Number of monitored nodes with monitoringActive */
+    uint8_t countOperational;       /**< Number of monitored nodes in CO_NMT_OPERATIONAL */
+    uint8_t heapCount;              /**< Number of nodes in the deadline heap */
+    uint8_t rxQueueHead;            /**< Write position in the receive queue, used by receive callback only */
+    uint8_t rxQueueTail;            /**< Read position in the receive queue */
+    uint8_t nodeSlot[0x80];         /**< Index + 1 of the slot in nodes array for each Node Id, 0 if not monitored */
+#if (((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0) || defined CO_DOXYGEN
+    uint64_t (*pFunctClock_us)(void* object); /**< From CO_nodeGuardingMaster_initClock() or NULL */
+    void* functClockObject;                    /**< From CO_nodeGuardingMaster_initClock() or NULL */
+#endif
     CO_nodeGuardingMasterNode_t nodes[CO_CONFIG_NODE_GUARDING_MASTER_COUNT]; /**< Array of monitored nodes */
 } CO_nodeGuardingMaster_t;
 
@@ -211,6 +254,8 @@ CO_ReturnError_t CO_nodeGuardingMaster_init(CO_nodeGuardingMaster_t* ngm, CO_EM_
  * Initialize node inside Node Guarding master object.
  *
  * Function may be called any time after CO_nodeGuardingMaster_init(). It configures monitoring of the remote node.
+ * Node Id may be configured in one slot only. First rtr message is delayed for a part of the guard time, which depends
+ * on the index, so nodes with the same guard time are requested evenly across the guard time and not in a burst.
  *
  * @param ngm Node Guarding master object.
  * @param index Index of the slot, which will be configured. 0 <= index < CO_CONFIG_NODE_GUARDING_MASTER_COUNT.
@@ -222,10 +267,28 @@ CO_ReturnError_t CO_nodeGuardingMaster_init(CO_nodeGuardingMaster_t* ngm, CO_EM_
 CO_ReturnError_t CO_nodeGuardingMaster_initNode(CO_nodeGuardingMaster_t* ngm, uint8_t index, uint8_t nodeId,
                                                 uint16_t guardTime_ms);
 
+#if (((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize clock for round-trip time measurement.
+ *
+ * Function may be called after CO_nodeGuardingMaster_init(). Clock is read before transmission of rtr message and
+ * inside receive callback, so it must be fast and thread safe. Without clock only the number of requests, responses
+ * and missing responses is counted.
+ *
+ * @param ngm Node Guarding master object.
+ * @param object Pointer to object, which will be passed to pFunctClock_us(). Can be NULL
+ * @param pFunctClock_us Pointer to function, which returns monotonic time in microseconds. Can be NULL.
+ */
+void CO_nodeGuardingMaster_initClock(CO_nodeGuardingMaster_t* ngm, void* object,
+                                     uint64_t (*pFunctClock_us)(void* object));
+#endif
+
 /**
  * Process Node Guarding master.
  *
- * Function must be called cyclically.
+ * Function must be called cyclically. Monitored nodes are sorted by the time of the next rtr message, so function
+ * only handles nodes with received response and nodes with expired guard time. Its duration does not depend on the
+ * number of monitored nodes.
  *
  * @param ngm This object.
  * @param timeDifference_us Time difference from previous function call in microseconds.
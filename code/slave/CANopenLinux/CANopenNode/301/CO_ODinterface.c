@@ -62,6 +62,18 @@ OD_readOriginal(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* coun
     return returnCode;
 }
 
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+/* From OD_initCallbackWritten() */
+static void (*OD_pFunctWritten)(void* object, const void* addr, OD_size_t len) = NULL;
+static void* OD_functWrittenObject = NULL;
+
+void
+OD_initCallbackWritten(void* object, void (*pFunctWritten)(void* object, const void* addr, OD_size_t len)) {
+    OD_functWrittenObject = object;
+    OD_pFunctWritten = pFunctWritten;
+}
+#endif
+
 ODR_t
 OD_writeOriginal(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
     if ((stream == NULL) || (buf == NULL) || (countWritten == NULL)) {
@@ -112,6 +124,12 @@ OD_writeOriginal(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_
         return ODR_DEV_INCOMPAT;
     }
 
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+    if (OD_pFunctWritten != NULL) {
+        OD_pFunctWritten(OD_functWrittenObject, dataOrig, dataLenToCopy);
+    }
+#endif
+
     *countWritten = dataLenToCopy;
     return returnCode;
 }
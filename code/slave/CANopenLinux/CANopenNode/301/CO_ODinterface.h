@@ -224,6 +224,11 @@ typedef struct {
      * "write" function must always copy all available data from buf. If OD variable expect more data, then
      * "*returnCode" must return 'ODR_PARTIAL'.
      *
+     * Exception is the last part of data, which function is not able to process at the moment (for example data are
+     * being stored in background). Then it may return 'ODR_PARTIAL' with "*countWritten" set to zero. SDO server then
+     * repeats the call with the same data, before it sends the response. Repeated calls are triggered by the SDO timer
+     * or by the SDO signal callback, so function should signal, when it gets ready.
+     *
      * @warning Do not use @ref CO_LOCK_OD() and @ref CO_UNLOCK_OD() macros inside the write() function. See also @ref
      * CO_critical_sections.
      *
@@ -304,6 +309,20 @@ ODR_t OD_readOriginal(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t
  */
 ODR_t OD_writeOriginal(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten);
 
+#if (((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize callback, which is called after @ref OD_writeOriginal() copies data into OD variable
+ *
+ * Used by data storage for tracking of changed (dirty) regions of auto stored data. Callback is common for all Object
+ * Dictionaries. It is called from the thread, which writes OD variable, usually inside @ref CO_LOCK_OD(). Data written
+ * by application directly into OD variables are not reported.
+ *
+ * @param object Pointer to object, which will be passed to pFunctWritten(). Can be NULL.
+ * @param pFunctWritten Pointer to the callback function with address and length of written data. Not called if NULL.
+ */
+void OD_initCallbackWritten(void* object, void (*pFunctWritten)(void* object, const void* addr, OD_size_t len));
+#endif
+
 /**
  * Find OD entry in Object Dictionary
  *
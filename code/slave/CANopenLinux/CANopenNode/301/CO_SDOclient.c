@@ -237,6 +237,9 @@ CO_SDOclient_init(CO_SDOclient_t* SDO_C, OD_t* OD, OD_entry_t* OD_1280_SDOcliPar
     SDO_C->pFunctSignal = NULL;
     SDO_C->functSignalObject = NULL;
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+    SDO_C->nodeStat = NULL;
+#endif
 
     /* prepare circular fifo buffer */
     CO_fifo_init(&SDO_C->bufFifo, SDO_C->buf, CO_CONFIG_SDO_CLI_BUFFER_SIZE + 1U);
@@ -293,6 +296,153 @@ CO_SDOclient_initCallbackPre(CO_SDOclient_t* SDOclient, void* object, void (*pFu
 }
 #endif
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+void
+CO_SDOclient_initNodeStat(CO_SDOclient_t* SDO_C, CO_SDOclient_nodeStat_t* nodeStat) {
+    if (SDO_C != NULL) {
+        SDO_C->nodeStat = nodeStat;
+    }
+}
+
+/* Get statistics of the current SDO server or NULL */
+static CO_SDOclient_nodeStat_t*
+nodeStat_get(CO_SDOclient_t* SDO_C) {
+    uint8_t id = SDO_C->nodeIDOfTheSDOServer;
+    if ((SDO_C->nodeStat == NULL) || (id < 1U) || (id > CO_SDO_CLI_NODE_STAT_COUNT)) {
+        return NULL;
+    }
+    return &SDO_C->nodeStat[id - 1U];
+}
+
+/* Is SDO client waiting for direct response to its last request */
+static bool_t
+nodeStat_isRsp(CO_SDO_state_t state) {
+    switch (state) {
+        case CO_SDO_ST_DOWNLOAD_INITIATE_RSP:
+        case CO_SDO_ST_DOWNLOAD_SEGMENT_RSP:
+        case CO_SDO_ST_DOWNLOAD_BLK_INITIATE_RSP:
+        case CO_SDO_ST_DOWNLOAD_BLK_SUBBLOCK_RSP:
+        case CO_SDO_ST_DOWNLOAD_BLK_END_RSP:
+        case CO_SDO_ST_UPLOAD_INITIATE_RSP:
+        case CO_SDO_ST_UPLOAD_SEGMENT_RSP:
+        case CO_SDO_ST_UPLOAD_BLK_INITIATE_RSP: return true;
+        default: return false;
+    }
+}
+
+/* Set SDO timeout for new transfer from measured round trip time: srtt + 4 * rttvar, limited between the timeout
+ * given by application and eight times its value. */
+static void
+nodeStat_adaptTimeout(CO_SDOclient_t* SDO_C) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+
+    SDO_C->SDOtimeoutTimeMin_us = SDO_C->SDOtimeoutTime_us;
+    if ((stat != NULL) && (stat->srtt_us != 0U)) {
+        uint32_t timeout = stat->srtt_us + (4U * stat->rttvar_us);
+        uint32_t timeoutMax = SDO_C->SDOtimeoutTimeMin_us * 8U;
+        if (timeout > timeoutMax) {
+            timeout = timeoutMax;
+        }
+        if (timeout > SDO_C->SDOtimeoutTime_us) {
+            SDO_C->SDOtimeoutTime_us = timeout;
+        }
+    }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
+    SDO_C->block_SDOtimeoutTime_us = (SDO_C->SDOtimeoutTime_us / 10U) * 7U;
+#endif
+}
+
+/* Update round trip time estimate with new measurement (integer version of RFC 6298) */
+static void
+nodeStat_rttSample(CO_SDOclient_t* SDO_C, uint32_t rtt_us) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+
+    if ((stat == NULL) || !nodeStat_isRsp(SDO_C->state)) {
+        return;
+    }
+    if (rtt_us == 0U) {
+        rtt_us = 1U;
+    }
+    if (stat->srtt_us == 0U) {
+        stat->srtt_us = rtt_us;
+        stat->rttvar_us = rtt_us / 2U;
+    } else {
+        uint32_t err = (rtt_us > stat->srtt_us) ? (rtt_us - stat->srtt_us) : (stat->srtt_us - rtt_us);
+        stat->rttvar_us = ((3U * stat->rttvar_us) + err) / 4U;
+        stat->srtt_us = ((7U * stat->srtt_us) + rtt_us) / 8U;
+    }
+}
+
+/* Server did not respond in time. Increase estimate, so next timeout is doubled, up to the limit. */
+static void
+nodeStat_timeout(CO_SDOclient_t* SDO_C) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+
+    if ((stat != NULL) && nodeStat_isRsp(SDO_C->state) && (stat->srtt_us < SDO_C->SDOtimeoutTime_us)) {
+        stat->srtt_us = SDO_C->SDOtimeoutTime_us;
+        stat->rttvar_us = SDO_C->SDOtimeoutTime_us / 4U;
+    }
+}
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
+#define NODE_STAT_BLKSIZE_MIN  4U
+#define NODE_STAT_BLKSIZE_STEP 4U
+
+/* Limit blksize for block upload. If segmentsLost, then halve the limit, otherwise increase it slowly. */
+static size_t
+nodeStat_blksize(CO_SDOclient_t* SDO_C, size_t count, bool_t feedback, bool_t segmentsLost) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+
+    if (stat == NULL) {
+        return count;
+    }
+    if (stat->blksize == 0U) {
+        stat->blksize = 127;
+    }
+    if (feedback) {
+        if (segmentsLost) {
+            stat->blksize /= 2U;
+            if (stat->blksize < NODE_STAT_BLKSIZE_MIN) {
+                stat->blksize = NODE_STAT_BLKSIZE_MIN;
+            }
+        } else if (stat->blksize <= (127U - NODE_STAT_BLKSIZE_STEP)) {
+            stat->blksize += NODE_STAT_BLKSIZE_STEP;
+        } else {
+            stat->blksize = 127;
+        }
+    }
+    return (count > stat->blksize) ? stat->blksize : count;
+}
+
+/* Server refused block initiate with "command specifier not valid". Remember, that node does not support block
+ * transfer and continue with segmented/expedited transfer instead of ending with abort. */
+static bool_t
+nodeStat_blockRefused(CO_SDOclient_t* SDO_C, CO_SDO_abortCode_t abortCode) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+
+    if ((stat == NULL) || (abortCode != CO_SDO_AB_CMD)) {
+        return false;
+    }
+    if (SDO_C->state == CO_SDO_ST_DOWNLOAD_BLK_INITIATE_RSP) {
+        SDO_C->state = CO_SDO_ST_DOWNLOAD_INITIATE_REQ;
+    } else if (SDO_C->state == CO_SDO_ST_UPLOAD_BLK_INITIATE_RSP) {
+        SDO_C->state = CO_SDO_ST_UPLOAD_INITIATE_REQ;
+    } else {
+        return false;
+    }
+    stat->noBlock = true;
+    return true;
+}
+
+/* Block transfer is not used for nodes, which refused it before */
+static bool_t
+nodeStat_blockEnable(CO_SDOclient_t* SDO_C, bool_t blockEnable) {
+    CO_SDOclient_nodeStat_t* stat = nodeStat_get(SDO_C);
+    return blockEnable && ((stat == NULL) || !stat->noBlock);
+}
+#endif
+#endif /* (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ADAPTIVE */
+
 #if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_LOCAL) != 0) && defined CO_BIG_ENDIAN
 static inline void
 reverseBytes(void* start, OD_size_t size) {
@@ -377,6 +527,12 @@ CO_SDOclientDownloadInitiate(CO_SDOclient_t* SDO_C, uint16_t index, uint8_t subI
     SDO_C->SDOtimeoutTime_us = (uint32_t)SDOtimeoutTime_ms * 1000U;
     SDO_C->timeoutTimer = 0;
     CO_fifo_reset(&SDO_C->bufFifo);
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+    nodeStat_adaptTimeout(SDO_C);
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
+    blockEnable = nodeStat_blockEnable(SDO_C, blockEnable);
+#endif
+#endif
 
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_LOCAL) != 0
     /* if node-ID of the SDO server is the same as node-ID of this node, then transfer data within this node */
@@ -439,6 +595,9 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_LOCAL) != 0
     /* Transfer data locally */
     else if ((SDO_C->state == CO_SDO_ST_DOWNLOAD_LOCAL_TRANSFER) && !send_abort) {
+        bool_t writePending = false;
+        (void)writePending; /* may be unused */
+
         /* search object dictionary in first pass */
         if (SDO_C->OD_IO.write == NULL) {
             ODR_t odRet;
@@ -465,6 +624,8 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
             size_t count = CO_fifo_getOccupied(&SDO_C->bufFifo);
             uint8_t buf[CO_CONFIG_SDO_CLI_BUFFER_SIZE + 2U];
 
+            size_t countRead = count;
+
             (void)CO_fifo_read(&SDO_C->bufFifo, buf, count, NULL);
             SDO_C->sizeTran += count;
 
@@ -541,6 +702,18 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
                     abortCode = CO_SDO_AB_DATA_LONG;
                     ret = CO_SDO_RT_endedWithClientAbort;
                 }
+                /* OD variable can not accept the last data yet, return them into the buffer and write again later */
+                else if (!bufferPartial && (odRet == ODR_PARTIAL) && (countWritten == 0U)) {
+#ifdef CO_BIG_ENDIAN
+                    if ((SDO_C->OD_IO.stream.attribute & ODA_MB) != 0) {
+                        reverseBytes(buf, countRead);
+                    }
+#endif
+                    SDO_C->sizeTran -= count;
+                    (void)CO_fifo_write(&SDO_C->bufFifo, buf, countRead, NULL);
+                    writePending = true;
+                    ret = CO_SDO_RT_waitingLocalTransfer;
+                }
                 /* is end of transfer? */
                 else if (!bufferPartial) {
                     /* error if OD variable was not written completely, but SDO download finished */
@@ -562,8 +735,8 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
             SDO_C->state = CO_SDO_ST_IDLE;
         }
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_FLAG_TIMERNEXT) != 0
-        /* Inform OS to call this function again without delay. */
-        else if (timerNext_us != NULL) {
+        /* Inform OS to call this function again without delay. If OD variable is not ready, it signals itself. */
+        else if ((timerNext_us != NULL) && !writePending) {
             *timerNext_us = 0;
         } else { /* MISRA C 2004 14.10 */
         }
@@ -572,13 +745,24 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
 #endif /* CO_CONFIG_SDO_CLI_LOCAL */
     /* CAN data received */
     else if (CO_FLAG_READ(SDO_C->CANrxNew)) {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+        nodeStat_rttSample(SDO_C, SDO_C->timeoutTimer + timeDifference_us);
+#endif
         /* is SDO abort */
         if (SDO_C->CANrxData[0] == 0x80U) {
             uint32_t code;
             (void)memcpy((void*)(&code), (const void*)(&SDO_C->CANrxData[4]), sizeof(code));
             abortCode = (CO_SDO_abortCode_t)CO_SWAP_32(code);
-            SDO_C->state = CO_SDO_ST_IDLE;
-            ret = CO_SDO_RT_endedWithServerAbort;
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0)
+            if (nodeStat_blockRefused(SDO_C, abortCode)) {
+                /* retry with segmented transfer */
+                abortCode = CO_SDO_AB_NONE;
+            } else
+#endif
+            {
+                SDO_C->state = CO_SDO_ST_IDLE;
+                ret = CO_SDO_RT_endedWithServerAbort;
+            }
         } else if (send_abort) {
             abortCode = (SDOabortCode != NULL) ? *SDOabortCode : CO_SDO_AB_DEVICE_INCOMPAT;
             SDO_C->state = CO_SDO_ST_ABORT;
@@ -776,6 +960,9 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
             SDO_C->timeoutTimer += timeDifference_us;
         }
         if (SDO_C->timeoutTimer >= SDO_C->SDOtimeoutTime_us) {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+            nodeStat_timeout(SDO_C);
+#endif
             abortCode = CO_SDO_AB_TIMEOUT;
             SDO_C->state = CO_SDO_ST_ABORT;
         }
@@ -1060,6 +1247,12 @@ CO_SDOclientUploadInitiate(CO_SDOclient_t* SDO_C, uint16_t index, uint8_t subInd
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
     SDO_C->block_SDOtimeoutTime_us = (uint32_t)SDOtimeoutTime_ms * 700U;
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+    nodeStat_adaptTimeout(SDO_C);
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
+    blockEnable = nodeStat_blockEnable(SDO_C, blockEnable);
+#endif
+#endif
 
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_LOCAL) != 0
     /* if node-ID of the SDO server is the same as node-ID of this node, then transfer data within this node */
@@ -1202,13 +1395,24 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
 #endif /* CO_CONFIG_SDO_CLI_LOCAL */
     /* CAN data received */
     else if (CO_FLAG_READ(SDO_C->CANrxNew)) {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+        nodeStat_rttSample(SDO_C, SDO_C->timeoutTimer + timeDifference_us);
+#endif
         /* is SDO abort */
         if (SDO_C->CANrxData[0] == 0x80U) {
             uint32_t code;
             (void)memcpy((void*)(&code), (const void*)(&SDO_C->CANrxData[4]), sizeof(code));
             abortCode = (CO_SDO_abortCode_t)CO_SWAP_32(code);
-            SDO_C->state = CO_SDO_ST_IDLE;
-            ret = CO_SDO_RT_endedWithServerAbort;
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0)
+            if (nodeStat_blockRefused(SDO_C, abortCode)) {
+                /* retry with segmented transfer */
+                abortCode = CO_SDO_AB_NONE;
+            } else
+#endif
+            {
+                SDO_C->state = CO_SDO_ST_IDLE;
+                ret = CO_SDO_RT_endedWithServerAbort;
+            }
         } else if (send_abort) {
             abortCode = (SDOabortCode != NULL) ? *SDOabortCode : CO_SDO_AB_DEVICE_INCOMPAT;
             SDO_C->state = CO_SDO_ST_ABORT;
@@ -1485,6 +1689,9 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 /* application didn't empty buffer */
                 abortCode = CO_SDO_AB_GENERAL;
             } else {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+                nodeStat_timeout(SDO_C);
+#endif
                 abortCode = CO_SDO_AB_TIMEOUT;
             }
             SDO_C->state = CO_SDO_ST_ABORT;
@@ -1585,6 +1792,9 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                     break;
                 } else { /* MISRA C 2004 14.10 */
                 }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+                count = nodeStat_blksize(SDO_C, count, false, false);
+#endif
                 SDO_C->block_blksize = (uint8_t)count;
                 SDO_C->CANtxBuff->data[4] = SDO_C->block_blksize;
                 SDO_C->CANtxBuff->data[5] = CO_CONFIG_SDO_CLI_PST;
@@ -1655,6 +1865,10 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                     } else { /* MISRA C 2004 14.10 */
                     }
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+                    /* sub-block ended before blksize segments, so some were lost */
+                    count = nodeStat_blksize(SDO_C, count, true, SDO_C->block_seqno != SDO_C->block_blksize);
+#endif
                     SDO_C->block_blksize = (uint8_t)count;
                     SDO_C->block_seqno = 0;
                     /* Block segments will be received in different thread. Make
@@ -145,6 +145,23 @@ write_SDO(CO_SDOclient_t* SDO_C, uint8_t nodeId, uint16_t index, uint8_t subInde
  * @see @ref CO_SDOserver
  */
 
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) || defined CO_DOXYGEN
+/**
+ * Number of entries in array of #CO_SDOclient_nodeStat_t, one for each node-ID from 1 to 127.
+ */
+#define CO_SDO_CLI_NODE_STAT_COUNT 127U
+
+/**
+ * Statistics of SDO communication with one remote node, used for adaptive timeout and blksize.
+ */
+typedef struct {
+    uint32_t srtt_us;   /**< Smoothed round trip time between request and response, 0 if not measured yet */
+    uint32_t rttvar_us; /**< Smoothed mean deviation of the round trip time */
+    uint8_t blksize;    /**< Maximum blksize for block upload, 0 if not determined yet */
+    bool_t noBlock;     /**< True, if node refused block transfer, so segmented transfer is used instead */
+} CO_SDOclient_nodeStat_t;
+#endif
+
 /**
  * SDO client object
  */
@@ -202,6 +219,10 @@ typedef struct {
     uint8_t block_dataUploadLast[7];  /**< Last 7 bytes of data at block upload */
     uint16_t block_crc;               /**< Calculated CRC checksum */
 #endif
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    CO_SDOclient_nodeStat_t* nodeStat; /**< From CO_SDOclient_initNodeStat() or NULL */
+    uint32_t SDOtimeoutTimeMin_us;     /**< Timeout time from last initiate function, lower limit for adaptive timeout */
+#endif
 } CO_SDOclient_t;
 
 /**
@@ -244,6 +265,30 @@ CO_ReturnError_t CO_SDOclient_init(CO_SDOclient_t* SDO_C, OD_t* OD, OD_entry_t*
 void CO_SDOclient_initCallbackPre(CO_SDOclient_t* SDOclient, void* object, void (*pFunctSignal)(void* object));
 #endif
 
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize statistics of remote nodes for adaptive SDO communication.
+ *
+ * SDO client measures the time between each request and its response and keeps smoothed round trip time (srtt) and
+ * its deviation (rttvar) for each remote node. At each initiate function timeout time is then calculated as
+ * srtt + 4 * rttvar. Timeout time argument of the initiate function is the lower limit, eight times its value is the
+ * upper limit. If SDO transfer times out, estimate for that node is increased, so next transfer waits longer. Nodes
+ * behind slow or lossy gateways this way get longer timeouts, without configuring the worst case for all nodes.
+ *
+ * In block upload blksize is reduced to half on each sub-block with missing segments and increased slowly on each
+ * complete sub-block. Last value is remembered for the node. If node refuses block initiate with abort code
+ * CO_SDO_AB_CMD, transfer continues as segmented (or expedited) and block transfer is not tried again for that node. So
+ * blockEnable argument can be always set: block transfer is then used for larger objects on nodes, which support it.
+ *
+ * Array may be shared between multiple SDO clients, if they are processed from the same thread.
+ *
+ * @param SDO_C This object.
+ * @param nodeStat Array of @ref CO_SDO_CLI_NODE_STAT_COUNT elements, index is node-ID - 1. It must be zeroed before
+ * first use. If NULL, adaptive behaviour is disabled.
+ */
+void CO_SDOclient_initNodeStat(CO_SDOclient_t* SDO_C, CO_SDOclient_nodeStat_t* nodeStat);
+#endif
+
 /**
  * Setup SDO client object.
  *
@@ -469,10 +469,11 @@ validateAndWriteToOD(CO_SDOserver_t* SDO, CO_SDO_abortCode_t* abortCode, uint8_t
 
     /* write data */
     OD_size_t countWritten = 0;
+    OD_size_t count = SDO->bufOffsetWr;
     ODR_t odRet;
 
     CO_LOCK_OD(SDO->CANdevTx);
-    odRet = SDO->OD_IO.write(&SDO->OD_IO.stream, SDO->buf, SDO->bufOffsetWr, &countWritten);
+    odRet = SDO->OD_IO.write(&SDO->OD_IO.stream, SDO->buf, count, &countWritten);
     CO_UNLOCK_OD(SDO->CANdevTx);
 
     SDO->bufOffsetWr = 0;
@@ -482,6 +483,10 @@ validateAndWriteToOD(CO_SDOserver_t* SDO, CO_SDO_abortCode_t* abortCode, uint8_t
         *abortCode = (CO_SDO_abortCode_t)OD_getSDOabCode(odRet);
         SDO->state = CO_SDO_ST_ABORT;
         return false;
+    } else if (SDO->finished && (odRet == ODR_PARTIAL) && (countWritten == 0U) && (count > 0U)) {
+        /* OD variable can not accept the last data yet, keep them and write again before response */
+        SDO->bufOffsetWr = count;
+        SDO->writePending = true;
     } else if (SDO->finished && (odRet == ODR_PARTIAL)) {
         /* OD variable was not written completely, but SDO download finished */
         *abortCode = CO_SDO_AB_DATA_SHORT;
@@ -616,6 +621,9 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
     else if (isNew) {
         if (SDO->state == CO_SDO_ST_IDLE) { /* new SDO communication? */
             bool_t upload = false;
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_SEGMENTED) != 0
+            SDO->writePending = false;
+#endif
 
             if ((SDO->CANrxData[0] & 0xF0U) == 0x20U) {
                 SDO->state = CO_SDO_ST_DOWNLOAD_INITIATE_REQ;
@@ -750,6 +758,15 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
                         odRet = SDO->OD_IO.write(&SDO->OD_IO.stream, buf, dataSizeToWrite, &countWritten);
                         CO_UNLOCK_OD(SDO->CANdevTx);
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_SEGMENTED) != 0
+                        if ((odRet == ODR_PARTIAL) && (countWritten == 0U)) {
+                            /* OD variable can not accept data yet, keep them and write again before response */
+                            (void)memcpy(SDO->buf, buf, dataSizeToWrite);
+                            SDO->bufOffsetWr = dataSizeToWrite;
+                            SDO->writePending = true;
+                            odRet = ODR_OK;
+                        }
+#endif
                         if (odRet != ODR_OK) {
                             abortCode = (CO_SDO_abortCode_t)OD_getSDOabCode(odRet);
                             SDO->state = CO_SDO_ST_ABORT;
@@ -1117,8 +1134,34 @@ CO_SDOserver_process(CO_SDOserver_t* SDO, bool_t NMTisPreOrOperational, uint32_t
     }
 #endif /* (CO_CONFIG_SDO_SRV) & CO_CONFIG_SDO_SRV_SEGMENTED */
 
+#if ((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_SEGMENTED) != 0
+    /* Repeat writing of the last data, which OD variable was not able to accept yet. Response is delayed until then,
+     * OD extension may use signal callback (see CO_SDOserver_initCallbackPre()) when it is ready. */
+    if ((ret == CO_SDO_RT_waitingResponse) && SDO->writePending && (SDO->state != CO_SDO_ST_ABORT)) {
+        OD_size_t countWritten = 0;
+        ODR_t odRet;
+
+        CO_LOCK_OD(SDO->CANdevTx);
+        odRet = SDO->OD_IO.write(&SDO->OD_IO.stream, SDO->buf, SDO->bufOffsetWr, &countWritten);
+        CO_UNLOCK_OD(SDO->CANdevTx);
+
+        if ((odRet != ODR_PARTIAL) || (countWritten != 0U)) {
+            SDO->writePending = false;
+            SDO->bufOffsetWr = 0;
+            if (odRet != ODR_OK) {
+                abortCode = (odRet == ODR_PARTIAL) ? CO_SDO_AB_DATA_SHORT
+                                                   : (CO_SDO_abortCode_t)OD_getSDOabCode(odRet);
+                SDO->state = CO_SDO_ST_ABORT;
+            }
+        }
+    }
+
+    /* Transmit CAN data ******************************************************/
+    if ((ret == CO_SDO_RT_waitingResponse) && !SDO->writePending) {
+#else
     /* Transmit CAN data ******************************************************/
     if (ret == CO_SDO_RT_waitingResponse) {
+#endif
         /* clear response buffer */
         (void)memset(SDO->CANtxBuff->data, 0, sizeof(SDO->CANtxBuff->data));
 
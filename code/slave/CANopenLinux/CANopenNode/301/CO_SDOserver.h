@@ -393,6 +393,8 @@ typedef struct {
                                                         block transfer + byte for '\0' */
     OD_size_t bufOffsetWr; /**< Offset of next free data byte available for write in the buffer. */
     OD_size_t bufOffsetRd; /**< Offset of first data available for read in the buffer */
+    bool_t writePending;   /**< OD write function did not accept the last data yet (ODR_PARTIAL, nothing written),
+                              data are in buffer and write is repeated before the response is sent */
 #endif
 #if (((CO_CONFIG_SDO_SRV)&CO_CONFIG_SDO_SRV_BLOCK) != 0) || defined CO_DOXYGEN
     uint32_t block_SDOtimeoutTime_us; /**< Timeout time for SDO sub-block download, half of #SDOtimeoutTime_us */
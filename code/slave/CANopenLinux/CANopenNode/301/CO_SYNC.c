@@ -122,6 +122,9 @@ OD_write_1005(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
     if (isProducer) {
         SYNC->counter = 0;
         SYNC->timer = 0;
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+        SYNC->txTime_us = 0;
+#endif
     }
 #endif /* CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER */
 
@@ -170,6 +173,100 @@ OD_write_1019(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
 #endif /* (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER */
 #endif /* (CO_CONFIG_SYNC) & CO_CONFIG_FLAG_OD_DYNAMIC */
 
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+/* Update statistics of SYNC producer with time of transmitted SYNC message */
+static void
+CO_SYNC_statUpdate(CO_SYNC_t* SYNC, uint64_t time_us) {
+    CO_SYNC_statistics_t* stat = &SYNC->stat;
+
+    if (stat->count < 0xFFFFFFFFU) {
+        stat->count++;
+    }
+
+    if ((SYNC->txTime_us != 0U) && (time_us > SYNC->txTime_us)) {
+        uint64_t diff = time_us - SYNC->txTime_us;
+        uint32_t period = (diff < 0xFFFFFFFFU) ? (uint32_t)diff : 0xFFFFFFFFU;
+        uint32_t nominal = *SYNC->OD_1006_period;
+        uint32_t jitter = (period > nominal) ? (period - nominal) : (nominal - period);
+
+        if ((stat->periodMin_us == 0U) || (period < stat->periodMin_us)) {
+            stat->periodMin_us = period;
+        }
+        if (period > stat->periodMax_us) {
+            stat->periodMax_us = period;
+        }
+        if (jitter > stat->jitterMax_us) {
+            stat->jitterMax_us = jitter;
+        }
+        if (jitter > 0x0FFFFFFFU) {
+            jitter = 0x0FFFFFFFU;
+        }
+        SYNC->jitterAcc = SYNC->jitterAcc - (SYNC->jitterAcc >> 4) + jitter;
+        stat->periodLast_us = period;
+        stat->jitterAvg_us = SYNC->jitterAcc >> 4;
+    }
+    SYNC->txTime_us = time_us;
+}
+
+/*
+ * Custom functions for reading and writing OD object "SYNC producer statistics"
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_read_syncStat(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
+    if ((stream == NULL) || (buf == NULL) || (countRead == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    CO_SYNC_t* SYNC = stream->object;
+    const CO_SYNC_statistics_t* stat = &SYNC->stat;
+    uint32_t value;
+
+    switch (stream->subIndex) {
+        case 0:
+            if (count < sizeof(uint8_t)) {
+                return ODR_DEV_INCOMPAT;
+            }
+            *countRead = CO_setUint8(buf, 6);
+            return ODR_OK;
+        case 1: value = stat->count; break;
+        case 2: value = stat->periodLast_us; break;
+        case 3: value = stat->periodMin_us; break;
+        case 4: value = stat->periodMax_us; break;
+        case 5: value = stat->jitterMax_us; break;
+        case 6: value = stat->jitterAvg_us; break;
+        default: return ODR_SUB_NOT_EXIST;
+    }
+    if (count < sizeof(uint32_t)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    *countRead = CO_setUint32(buf, value);
+    return ODR_OK;
+}
+
+static ODR_t
+OD_write_syncStat(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    if ((stream == NULL) || (buf == NULL) || (countWritten == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex != 1U) {
+        return ODR_READONLY;
+    }
+    if ((count != sizeof(uint32_t)) || (CO_getUint32(buf) != 0U)) {
+        return ODR_INVALID_VALUE;
+    }
+
+    CO_SYNC_t* SYNC = stream->object;
+    (void)memset(&SYNC->stat, 0, sizeof(SYNC->stat));
+    SYNC->jitterAcc = 0;
+    SYNC->txTime_us = 0;
+
+    *countWritten = count;
+    return ODR_OK;
+}
+#endif /* (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE */
+
 CO_ReturnError_t
 CO_SYNC_init(CO_SYNC_t* SYNC, CO_EM_t* em, OD_entry_t* OD_1005_cobIdSync, OD_entry_t* OD_1006_commCyclePeriod,
              OD_entry_t* OD_1007_syncWindowLen, OD_entry_t* OD_1019_syncCounterOvf, CO_CANmodule_t* CANdevRx,
@@ -309,6 +406,41 @@ CO_SYNC_initCallbackPre(CO_SYNC_t* SYNC, void* object, void (*pFunctSignalPre)(v
 }
 #endif
 
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+void
+CO_SYNC_initStatistics(CO_SYNC_t* SYNC, OD_entry_t* OD_syncStat) {
+    if ((SYNC != NULL) && (OD_syncStat != NULL)) {
+        SYNC->OD_stat_extension.object = SYNC;
+        SYNC->OD_stat_extension.read = OD_read_syncStat;
+        SYNC->OD_stat_extension.write = OD_write_syncStat;
+        (void)OD_extension_init(OD_syncStat, &SYNC->OD_stat_extension);
+    }
+}
+
+void
+CO_SYNC_setExternalTimer(CO_SYNC_t* SYNC, bool_t enable) {
+    if ((SYNC != NULL) && (SYNC->extTimer != enable)) {
+        SYNC->extTimer = enable;
+        SYNC->txDeadline = false;
+        /* time bases of both timers are not related */
+        SYNC->txTime_us = 0;
+    }
+}
+
+CO_ReturnError_t
+CO_SYNC_sendDeadline(CO_SYNC_t* SYNC, uint64_t time_us) {
+    if ((SYNC == NULL) || !SYNC->isProducer) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    CO_ReturnError_t ret = CO_SYNCsend(SYNC);
+    CO_SYNC_statUpdate(SYNC, time_us);
+    SYNC->txDeadline = true;
+
+    return ret;
+}
+#endif
+
 CO_SYNC_status_t
 CO_SYNC_process(CO_SYNC_t* SYNC, bool_t NMTisPreOrOperational, uint32_t timeDifference_us, uint32_t* timerNext_us) {
     (void)timerNext_us; /* may be unused */
@@ -329,18 +461,44 @@ CO_SYNC_process(CO_SYNC_t* SYNC, bool_t NMTisPreOrOperational, uint32_t timeDiff
             CO_FLAG_CLEAR(SYNC->CANrxNew);
         }
 
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+        SYNC->time_us += timeDifference_us;
+
+        /* was SYNC just transmitted by CO_SYNC_sendDeadline() */
+        if (SYNC->txDeadline) {
+            SYNC->timer = 0;
+            syncStatus = CO_SYNC_RX_TX;
+            SYNC->txDeadline = false;
+        }
+#endif
+
         uint32_t OD_1006_period = (SYNC->OD_1006_period != NULL) ? *SYNC->OD_1006_period : 0U;
 
         if (OD_1006_period > 0U) {
 #if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER) != 0
             if (SYNC->isProducer) {
-                if (SYNC->timer >= OD_1006_period) {
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+                bool_t ownTimer = !SYNC->extTimer;
+#else
+                bool_t ownTimer = true;
+#endif
+                if (ownTimer && (SYNC->timer >= OD_1006_period)) {
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+                    uint32_t late = SYNC->timer - OD_1006_period;
+#endif
                     syncStatus = CO_SYNC_RX_TX;
                     (void)CO_SYNCsend(SYNC);
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+                    CO_SYNC_statUpdate(SYNC, SYNC->time_us);
+                    /* keep nominal schedule, unless more than one period is lost */
+                    if (late < OD_1006_period) {
+                        SYNC->timer = late;
+                    }
+#endif
                 }
 #if ((CO_CONFIG_SYNC)&CO_CONFIG_FLAG_TIMERNEXT) != 0
                 /* Calculate when next SYNC needs to be sent */
-                if (timerNext_us != NULL) {
+                if (ownTimer && (timerNext_us != NULL)) {
                     uint32_t diff = OD_1006_period - SYNC->timer;
                     if (*timerNext_us > diff) {
                         *timerNext_us = diff;
@@ -396,6 +554,10 @@ CO_SYNC_process(CO_SYNC_t* SYNC, bool_t NMTisPreOrOperational, uint32_t timeDiff
         SYNC->receiveError = 0;
         SYNC->counter = 0;
         SYNC->timer = 0;
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+        SYNC->txDeadline = false;
+        SYNC->txTime_us = 0;
+#endif
     }
 
     if (syncStatus == CO_SYNC_RX_TX) {
@@ -59,8 +59,47 @@ extern "C" {
  * there is a double receive buffer for each synchronous RPDO. At the moment, when SYNC is received or transmitted,
  * internal variable CANrxToggle toggles. That variable is then used by synchronous RPDO to determine, which of the two
  * buffers is used for RPDO reception and which for RPDO processing.
+ *
+ * ####SYNC producer timing
+ * By default SYNC producer accumulates timeDifference_us from CO_SYNC_process() calls and transmits SYNC, when
+ * _Communication cycle period_ (0x1006) expires. Each SYNC is then late for the latency of the processing call and the
+ * delay accumulates from period to period. With CO_CONFIG_SYNC_PRODUCER_DEADLINE the late part is carried into the
+ * next period, so SYNC messages keep the nominal schedule. Target may also provide own absolute timer (CANopenLinux
+ * uses timerfd with TFD_TIMER_ABSTIME) and transmit each SYNC with CO_SYNC_sendDeadline(), see
+ * CO_SYNC_setExternalTimer().
+ *
+ * Producer also measures period between transmitted SYNC messages. Statistics are available in @ref
+ * CO_SYNC_statistics_t and optionally in Object Dictionary, see @ref OD_INDEX_SYNC_STATISTICS.
  */
 
+#if (((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0) || defined CO_DOXYGEN
+/**
+ * Index of optional "SYNC producer statistics" object in Object Dictionary, RECORD:
+ * - sub 0: Highest sub-index supported, UNSIGNED8 = 6
+ * - sub 1: Number of transmitted SYNC messages, UNSIGNED32, rw. Writing 0 resets statistics.
+ * - sub 2: Last measured period in microseconds, UNSIGNED32, ro
+ * - sub 3: Minimum measured period in microseconds, UNSIGNED32, ro
+ * - sub 4: Maximum measured period in microseconds, UNSIGNED32, ro
+ * - sub 5: Maximum jitter (absolute difference to 0x1006) in microseconds, UNSIGNED32, ro
+ * - sub 6: Average jitter in microseconds (exponential, factor 1/16), UNSIGNED32, ro
+ */
+#ifndef OD_INDEX_SYNC_STATISTICS
+#define OD_INDEX_SYNC_STATISTICS 0x2110
+#endif
+
+/**
+ * Statistics of SYNC producer, measured between consecutive transmitted SYNC messages.
+ */
+typedef struct {
+    uint32_t count;         /**< Number of transmitted SYNC messages since reset of statistics */
+    uint32_t periodLast_us; /**< Last measured period */
+    uint32_t periodMin_us;  /**< Minimum measured period */
+    uint32_t periodMax_us;  /**< Maximum measured period */
+    uint32_t jitterMax_us;  /**< Maximum absolute difference between measured period and _Communication cycle period_ */
+    uint32_t jitterAvg_us;  /**< Average absolute difference, exponential with factor 1/16 */
+} CO_SYNC_statistics_t;
+#endif
+
 /**
  * SYNC producer and consumer object.
  */
@@ -84,6 +123,15 @@ typedef struct {
                                  from Object dictionary(index 0x1005).*/
     CO_CANmodule_t* CANdevTx; /**< From CO_SYNC_init() */
     CO_CANtx_t* CANtxBuff;    /**< CAN transmit buffer inside CANdevTx */
+#if (((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0) || defined CO_DOXYGEN
+    bool_t extTimer;                  /**< From CO_SYNC_setExternalTimer() */
+    bool_t txDeadline;                /**< Set by CO_SYNC_sendDeadline(), cleared by CO_SYNC_process() */
+    uint64_t time_us;                 /**< Sum of timeDifference_us from CO_SYNC_process() calls */
+    uint64_t txTime_us;               /**< Time of the last transmitted SYNC, 0 if period is not measured yet */
+    uint32_t jitterAcc;               /**< 16 * CO_SYNC_statistics_t.jitterAvg_us, with fractional part */
+    CO_SYNC_statistics_t stat;        /**< Statistics of SYNC producer */
+    OD_extension_t OD_stat_extension; /**< Extension for OD object "SYNC producer statistics" */
+#endif
 #endif
 
 #if ((CO_CONFIG_SYNC)&CO_CONFIG_FLAG_OD_DYNAMIC) || defined CO_DOXYGEN
@@ -179,6 +227,45 @@ CO_SYNCsend(CO_SYNC_t* SYNC) {
 }
 #endif
 
+#if (((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize optional OD object "SYNC producer statistics".
+ *
+ * Function must be called after CO_SYNC_init(), see @ref OD_INDEX_SYNC_STATISTICS for the object description.
+ *
+ * @param SYNC This object.
+ * @param OD_syncStat OD entry for "SYNC producer statistics", may be NULL.
+ */
+void CO_SYNC_initStatistics(CO_SYNC_t* SYNC, OD_entry_t* OD_syncStat);
+
+/**
+ * Enable or disable external timer for SYNC producer.
+ *
+ * If enabled, CO_SYNC_process() does not transmit SYNC messages by its own timer. Instead, target calls
+ * CO_SYNC_sendDeadline() at each absolute deadline, which is calculated from _Communication cycle period_ and must not
+ * drift. If target can not keep the deadlines anymore, for example after NMT state change or change of the period, it
+ * must disable the external timer.
+ *
+ * @param SYNC This object.
+ * @param enable True to enable external timer.
+ */
+void CO_SYNC_setExternalTimer(CO_SYNC_t* SYNC, bool_t enable);
+
+/**
+ * Transmit SYNC message at absolute deadline.
+ *
+ * Function sends SYNC message, updates statistics and signals SYNC to the next CO_SYNC_process() call, which then
+ * returns CO_SYNC_RX_TX, so synchronous PDOs are processed. It must be called only for SYNC producer in NMT
+ * pre-operational or operational state, from the same thread and with the same locking as CO_SYNC_process().
+ *
+ * @param SYNC This object.
+ * @param time_us Current time in microseconds, used for statistics.
+ *
+ * @return Same as CO_CANsend().
+ */
+CO_ReturnError_t CO_SYNC_sendDeadline(CO_SYNC_t* SYNC, uint64_t time_us);
+#endif
+
 /**
  * Process SYNC communication.
  *
@@ -38,6 +38,11 @@ CO_TIME_receive(void* object, void* msg) {
 
     if (DLC == CO_TIME_MSG_LENGTH) {
         (void)memcpy(TIME->timeStamp, data, sizeof(TIME->timeStamp));
+#if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0
+        if (TIME->pFunctClock_us != NULL) {
+            TIME->rxClock_us = TIME->pFunctClock_us(TIME->functClockObject);
+        }
+#endif
         CO_FLAG_SET(TIME->CANrxNew);
 
 #if ((CO_CONFIG_TIME)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
@@ -151,6 +156,109 @@ CO_TIME_initCallbackPre(CO_TIME_t* TIME, void* object, void (*pFunctSignalPre)(v
 }
 #endif
 
+#if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0
+#define CO_TIME_MS_PER_DAY ((uint64_t)1000U * 60U * 60U * 24U)
+
+/* Offset of network time to the local clock at time clock_us, extrapolated with the estimated drift */
+static int64_t
+CO_TIME_offset(const CO_TIME_discipline_t* d, uint64_t clock_us) {
+    int64_t dt = (int64_t)(clock_us - d->refClock_us);
+    return d->offset_us + ((dt * d->drift_ppb) / 1000000000);
+}
+
+/* Set ms, days and residual_us from time in microseconds since January 1, 1984 */
+static void
+CO_TIME_setFromClock(CO_TIME_t* TIME, uint64_t time_us) {
+    uint64_t ms = time_us / 1000U;
+    TIME->residual_us = (uint16_t)(time_us % 1000U);
+    TIME->days = (uint16_t)(ms / CO_TIME_MS_PER_DAY);
+    TIME->ms = (uint32_t)(ms % CO_TIME_MS_PER_DAY);
+}
+
+/* Update PI filter with received network time, sampled at local clock TIME->rxClock_us */
+static void
+CO_TIME_disciplineUpdate(CO_TIME_t* TIME, uint64_t net_us) {
+    CO_TIME_discipline_t* d = &TIME->discipline;
+    uint64_t clock_us = TIME->rxClock_us;
+    int64_t offset = CO_TIME_offset(d, clock_us);
+    int64_t err = (int64_t)(net_us - clock_us) - offset;
+    bool_t step = !d->synchronized;
+    int64_t limit = (int64_t)d->jitter_us * 8;
+
+    if (limit < CO_TIME_OUTLIER_MIN_US) {
+        limit = CO_TIME_OUTLIER_MIN_US;
+    }
+    if (!step && ((err > limit) || (err < -limit))) {
+        TIME->outlierCount++;
+        if (TIME->outlierCount < CO_TIME_STEP_OUTLIERS) {
+            d->outliers++;
+            return;
+        }
+        step = true;
+    }
+    TIME->outlierCount = 0;
+
+    if (step) {
+        /* set time directly, keep the estimated drift */
+        d->offset_us = (int64_t)(net_us - clock_us);
+        d->error_us = 0;
+        d->synchronized = true;
+    } else {
+        int64_t dt = (int64_t)(clock_us - d->refClock_us);
+        uint32_t errAbs = (uint32_t)((err < 0) ? -err : err);
+
+        d->offset_us = offset + (err / 4);
+        if (dt > 0) {
+            int64_t drift = d->drift_ppb + ((err * 1000000000) / dt) / 16;
+            if (drift > CO_TIME_DRIFT_MAX_PPB) {
+                drift = CO_TIME_DRIFT_MAX_PPB;
+            } else if (drift < -CO_TIME_DRIFT_MAX_PPB) {
+                drift = -CO_TIME_DRIFT_MAX_PPB;
+            } else { /* MISRA C 2004 14.10 */
+            }
+            d->drift_ppb = (int32_t)drift;
+        }
+        d->error_us = (int32_t)err;
+        TIME->jitterAcc = TIME->jitterAcc - (TIME->jitterAcc >> 4) + errAbs;
+        d->jitter_us = TIME->jitterAcc >> 4;
+    }
+    d->refClock_us = clock_us;
+    d->samples++;
+}
+
+void
+CO_TIME_initClock(CO_TIME_t* TIME, void* object, uint64_t (*pFunctClock_us)(void* object), uint32_t rxDelay_us) {
+    if (TIME != NULL) {
+        TIME->functClockObject = object;
+        TIME->pFunctClock_us = pFunctClock_us;
+        TIME->rxDelay_us = rxDelay_us;
+        (void)memset(&TIME->discipline, 0, sizeof(TIME->discipline));
+        TIME->outlierCount = 0;
+        TIME->jitterAcc = 0;
+    }
+}
+
+bool_t
+CO_TIME_getNetworkTime(CO_TIME_t* TIME, uint64_t* time_us) {
+    if ((TIME == NULL) || (time_us == NULL) || (TIME->pFunctClock_us == NULL)) {
+        return false;
+    }
+
+    uint64_t clock_us = TIME->pFunctClock_us(TIME->functClockObject);
+
+    if (TIME->isProducer) {
+        *time_us = clock_us;
+        return true;
+    }
+    if (!TIME->discipline.synchronized) {
+        *time_us = clock_us;
+        return false;
+    }
+    *time_us = (uint64_t)((int64_t)clock_us + CO_TIME_offset(&TIME->discipline, clock_us));
+    return true;
+}
+#endif /* (CO_CONFIG_TIME) & CO_CONFIG_TIME_DISCIPLINE */
+
 bool_t
 CO_TIME_process(CO_TIME_t* TIME, bool_t NMTisPreOrOperational, uint32_t timeDifference_us) {
     bool_t timestampReceived = false;
@@ -164,6 +272,12 @@ CO_TIME_process(CO_TIME_t* TIME, bool_t NMTisPreOrOperational, uint32_t timeDiff
             TIME->days = CO_SWAP_16(days_swapped);
             TIME->residual_us = 0;
             timestampReceived = true;
+#if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0
+            if ((TIME->pFunctClock_us != NULL) && !TIME->isProducer) {
+                CO_TIME_disciplineUpdate(TIME, ((uint64_t)TIME->days * CO_TIME_MS_PER_DAY * 1000U)
+                                                   + ((uint64_t)TIME->ms * 1000U) + TIME->rxDelay_us);
+            }
+#endif
 
             CO_FLAG_CLEAR(TIME->CANrxNew);
         }
@@ -183,6 +297,12 @@ CO_TIME_process(CO_TIME_t* TIME, bool_t NMTisPreOrOperational, uint32_t timeDiff
             TIME->days += 1U;
         }
     }
+#if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0
+    uint64_t networkTime_us;
+    if (CO_TIME_getNetworkTime(TIME, &networkTime_us)) {
+        CO_TIME_setFromClock(TIME, networkTime_us);
+    }
+#endif
 
 #if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_PRODUCER) != 0
     if (NMTisPreOrOperational && TIME->isProducer && TIME->producerInterval_ms > 0) {
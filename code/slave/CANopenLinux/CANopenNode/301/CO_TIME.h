@@ -57,10 +57,48 @@ extern "C" {
  *
  * Current time can be set with @ref CO_TIME_set() function, which is necessary at least once, if time producer. If
  * configured, time stamp message is send from @ref CO_TIME_process() in intervals specified by @ref CO_TIME_set()
+ *
+ * ####Disciplined time
+ * With CO_CONFIG_TIME_DISCIPLINE target may provide own clock with @ref CO_TIME_initClock(), for example realtime clock
+ * of the operating system. Producer then sends time from that clock. Consumer takes clock value at reception of each
+ * TIME message and compares it with the received time. Offset and drift of the local clock are estimated with PI
+ * filter: offset is corrected with gain 1/4, frequency with gain 1/16 of the measured frequency error. Filter does not
+ * step the time with each message, so jitter of the message reception is averaged out. Outliers are ignored, after
+ * several consecutive outliers (or on the first message) time is set directly. Result is available from @ref
+ * CO_TIME_getNetworkTime(), also between the TIME messages. Filter state is in @ref CO_TIME_discipline_t.
  */
 
 #define CO_TIME_MSG_LENGTH 6U /**< Length of the TIME message */
 
+#if (((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0) || defined CO_DOXYGEN
+#ifndef CO_TIME_OUTLIER_MIN_US
+/** Sample is outlier, if its error is larger than eight times average jitter, but at least this value */
+#define CO_TIME_OUTLIER_MIN_US 1000
+#endif
+#ifndef CO_TIME_STEP_OUTLIERS
+/** Number of consecutive outliers, after which time is set directly from received TIME message */
+#define CO_TIME_STEP_OUTLIERS 3U
+#endif
+#ifndef CO_TIME_DRIFT_MAX_PPB
+/** Limit of estimated frequency error of the local clock in parts per billion */
+#define CO_TIME_DRIFT_MAX_PPB 500000
+#endif
+
+/**
+ * State of the clock discipline in TIME consumer.
+ */
+typedef struct {
+    bool_t synchronized;  /**< True, if at least one TIME message is received and time is valid */
+    uint32_t samples;     /**< Number of received TIME messages used by the filter */
+    uint32_t outliers;    /**< Number of ignored TIME messages */
+    int32_t error_us;     /**< Last measured error between received and disciplined time */
+    uint32_t jitter_us;   /**< Average absolute error, exponential with factor 1/16 */
+    int32_t drift_ppb;    /**< Estimated frequency error of the local clock in parts per billion */
+    int64_t offset_us;    /**< Offset of network time to the local clock at refClock_us */
+    uint64_t refClock_us; /**< Local clock at the last filter update */
+} CO_TIME_discipline_t;
+#endif
+
 /**
  * TIME producer and consumer object.
  */
@@ -87,6 +125,15 @@ typedef struct {
 #if (((CO_CONFIG_TIME)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
     OD_extension_t OD_1012_extension; /**< Extension for OD object */
 #endif
+#if (((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0) || defined CO_DOXYGEN
+    uint64_t (*pFunctClock_us)(void* object); /**< From CO_TIME_initClock() or NULL */
+    void* functClockObject;                   /**< From CO_TIME_initClock() or NULL */
+    uint32_t rxDelay_us;                      /**< From CO_TIME_initClock() */
+    uint64_t rxClock_us;                      /**< Local clock at reception of the timeStamp */
+    uint8_t outlierCount;                     /**< Number of consecutive outliers */
+    uint32_t jitterAcc;                       /**< 16 * CO_TIME_discipline_t.jitter_us, with fractional part */
+    CO_TIME_discipline_t discipline;          /**< State of the clock discipline */
+#endif
 } CO_TIME_t;
 
 /**
@@ -125,6 +172,37 @@ CO_ReturnError_t CO_TIME_init(CO_TIME_t* TIME, OD_entry_t* OD_1012_cobIdTimeStam
 void CO_TIME_initCallbackPre(CO_TIME_t* TIME, void* object, void (*pFunctSignalPre)(void* object));
 #endif
 
+#if (((CO_CONFIG_TIME)&CO_CONFIG_TIME_DISCIPLINE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize local clock for TIME producer and consumer.
+ *
+ * Function may be called after CO_TIME_init(). Clock function is called from the CAN receive context and from
+ * CO_TIME_process(), it must be thread safe and fast. Without clock (pFunctClock_us is NULL), TIME object works with
+ * internal counters as before.
+ *
+ * @param TIME This object.
+ * @param object Pointer to object, which will be passed to pFunctClock_us().
+ * @param pFunctClock_us Pointer to the function, which returns local time in microseconds since January 1, 1984.
+ * @param rxDelay_us Constant delay between time sampling in producer and reception in consumer, for example duration
+ * of the CAN frame. It is added to each received time.
+ */
+void CO_TIME_initClock(CO_TIME_t* TIME, void* object, uint64_t (*pFunctClock_us)(void* object), uint32_t rxDelay_us);
+
+/**
+ * Get disciplined network time
+ *
+ * For producer this is the local clock. For consumer this is the local clock corrected with the estimated offset and
+ * drift, see @ref CO_TIME_discipline_t. Function must be called from the same thread as CO_TIME_process() or inside
+ * @ref CO_LOCK_OD.
+ *
+ * @param TIME This object.
+ * @param [out] time_us Network time in microseconds since January 1, 1984.
+ *
+ * @return True, if time is valid: clock is initialized and device is producer or consumer is synchronized.
+ */
+bool_t CO_TIME_getNetworkTime(CO_TIME_t* TIME, uint64_t* time_us);
+#endif
+
 /**
  * Set current time
  *
@@ -157,6 +157,10 @@ extern "C" {
  *   CO_HBconsumer_initCallbackRemoteReset() functions.
  * - CO_CONFIG_HB_CONS_QUERY_FUNCT - Enable functions for query HB state or
  *   NMT state of the specific monitored node.
+ * - CO_CONFIG_HB_CONS_NET_TABLE - Enable network state table with state of
+ *   all nodes in the network and log of changes, non-standard. Table is
+ *   configured by CO_HBconsumer_initNetTable(). One additional CAN receive
+ *   buffer is used.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received heartbeat CAN message.
  *   Callback is configured by CO_HBconsumer_initCallbackPre().
@@ -177,6 +181,7 @@ extern "C" {
 #define CO_CONFIG_HB_CONS_CALLBACK_CHANGE 0x02
 #define CO_CONFIG_HB_CONS_CALLBACK_MULTI  0x04
 #define CO_CONFIG_HB_CONS_QUERY_FUNCT     0x08
+#define CO_CONFIG_HB_CONS_NET_TABLE       0x10
 /** @} */ /* CO_STACK_CONFIG_NMT_HB */
 
 /**
@@ -190,14 +195,17 @@ extern "C" {
  * Possible flags, can be ORed:
  * - CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE - Enable Node guarding slave.
  * - CO_CONFIG_NODE_GUARDING_MASTER_ENABLE - Enable Node guarding master.
+ * - CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS - Node guarding master counts requests and missing responses for each
+ *   node and measures round-trip time with the clock from CO_nodeGuardingMaster_initClock().
  * - #CO_CONFIG_FLAG_TIMERNEXT - Enable calculation of timerNext_us variable
  *   inside CO_nodeGuardingSlave_process().
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_NODE_GUARDING (0)
 #endif
-#define CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE  0x01
-#define CO_CONFIG_NODE_GUARDING_MASTER_ENABLE 0x02
+#define CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE      0x01
+#define CO_CONFIG_NODE_GUARDING_MASTER_ENABLE     0x02
+#define CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS 0x04
 
 /**
  * Maximum number of nodes monitored by master
@@ -226,6 +234,10 @@ extern "C" {
  *   "Pre-defined error field"
  * - CO_CONFIG_EM_CONSUMER - Enable simple emergency consumer with callback.
  * - CO_CONFIG_EM_STATUS_BITS - Access @ref CO_EM_errorStatusBits_t from OD.
+ * - CO_CONFIG_EM_CONS_AGGREGATE - Emergency consumer aggregates received
+ *   messages per node-ID and error code and keeps history of them,
+ *   non-standard. Callback is then called from CO_EM_process() and it is
+ *   rate limited. If set, then CO_CONFIG_EM_CONSUMER must also be set.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   emergency condition by CO_errorReport() or CO_errorReset() call.
  *   Callback is configured by CO_EM_initCallbackPre().
@@ -243,6 +255,7 @@ extern "C" {
 #define CO_CONFIG_EM_HISTORY           0x08
 #define CO_CONFIG_EM_STATUS_BITS       0x10
 #define CO_CONFIG_EM_CONSUMER          0x20
+#define CO_CONFIG_EM_CONS_AGGREGATE    0x40
 
 /**
  * Maximum number of @ref CO_EM_errorStatusBits_t
@@ -383,6 +396,12 @@ extern "C" {
  * - CO_CONFIG_SDO_CLI_LOCAL - Enable local transfer, if Node-ID of the SDO
  *   server is the same as node-ID of the SDO client. (SDO client is the same
  *   device as SDO server.) Transfer data directly without communication on CAN.
+ * - CO_CONFIG_SDO_CLI_BULK - Enable @ref CO_SDObulk engine, which runs batch of
+ *   SDO transfers concurrently over the last @ref CO_CONFIG_SDO_CLI_BULK_COUNT
+ *   SDO clients (first SDO client is always left to the gateway, if enabled).
+ * - CO_CONFIG_SDO_CLI_ADAPTIVE - Measure round trip time of each remote node
+ *   and extend SDO timeout for slow nodes, see CO_SDOclient_initNodeStat().
+ *   Block upload also adapts blksize to segment loss on the bus.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received SDO CAN message.
  *   Callback is configured by CO_SDOclient_initCallbackPre().
@@ -399,6 +418,8 @@ extern "C" {
 #define CO_CONFIG_SDO_CLI_SEGMENTED 0x02
 #define CO_CONFIG_SDO_CLI_BLOCK     0x04
 #define CO_CONFIG_SDO_CLI_LOCAL     0x08
+#define CO_CONFIG_SDO_CLI_BULK      0x10
+#define CO_CONFIG_SDO_CLI_ADAPTIVE  0x20
 
 /**
  * Size of the internal data buffer for the SDO client.
@@ -414,6 +435,31 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SDO_CLI_BUFFER_SIZE 32
 #endif
+
+/**
+ * Maximum number of SDO clients used by @ref CO_SDObulk engine.
+ *
+ * Each channel serves one remote node at a time. Number of actually used
+ * channels is limited also by number of SDO clients in Object Dictionary.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_CLI_BULK_CHANNELS 8
+#endif
+
+/**
+ * Number of SDO clients reserved for @ref CO_SDObulk engine.
+ *
+ * Clients are taken from the end of the SDO client range in Object Dictionary,
+ * Gateway-ascii sessions share the SDO clients before them. If gateway uses SDO,
+ * first SDO client is always left to it. For full concurrency Object Dictionary
+ * needs @ref CO_CONFIG_GTWA_SESSIONS + CO_CONFIG_SDO_CLI_BULK_COUNT SDO clients,
+ * so each session has own SDO client. With fewer SDO clients, SDO commands of
+ * gateway sessions wait for each other. Value must not be larger than
+ * @ref CO_CONFIG_SDO_CLI_BULK_CHANNELS, default is the same value.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_CLI_BULK_COUNT 8
+#endif
 /** @} */ /* CO_STACK_CONFIG_SDO */
 
 /**
@@ -427,6 +473,9 @@ extern "C" {
  * Possible flags, can be ORed:
  * - CO_CONFIG_TIME_ENABLE - Enable TIME object and TIME consumer.
  * - CO_CONFIG_TIME_PRODUCER - Enable TIME producer.
+ * - CO_CONFIG_TIME_DISCIPLINE - Time is taken from local clock, configured by CO_TIME_initClock(). Producer sends the
+ *   clock, consumer estimates offset and drift of the clock to the received TIME with PI filter. Disciplined network
+ *   time is available with CO_TIME_getNetworkTime().
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received TIME CAN message.
  *   Callback is configured by CO_TIME_initCallbackPre().
@@ -436,8 +485,9 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_TIME (CO_CONFIG_TIME_ENABLE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
-#define CO_CONFIG_TIME_ENABLE   0x01
-#define CO_CONFIG_TIME_PRODUCER 0x02
+#define CO_CONFIG_TIME_ENABLE     0x01
+#define CO_CONFIG_TIME_PRODUCER   0x02
+#define CO_CONFIG_TIME_DISCIPLINE 0x04
 /** @} */ /* CO_STACK_CONFIG_TIME */
 
 /**
@@ -451,6 +501,10 @@ extern "C" {
  * Possible flags, can be ORed:
  * - CO_CONFIG_SYNC_ENABLE - Enable SYNC object and SYNC consumer.
  * - CO_CONFIG_SYNC_PRODUCER - Enable SYNC producer.
+ * - CO_CONFIG_SYNC_PRODUCER_DEADLINE - SYNC producer keeps the nominal schedule: late transmission does not shift
+ *   the following SYNC messages. Transmission may be triggered at absolute deadlines by external timer, see
+ *   CO_SYNC_sendDeadline(). Measured period and jitter are available in optional OD object. Requires
+ *   CO_CONFIG_SYNC_PRODUCER.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received SYNC CAN message.
  *   Callback is configured by CO_SYNC_initCallbackPre().
@@ -463,8 +517,9 @@ extern "C" {
     (CO_CONFIG_SYNC_ENABLE | CO_CONFIG_SYNC_PRODUCER | CO_CONFIG_GLOBAL_RT_FLAG_CALLBACK_PRE                           \
      | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
-#define CO_CONFIG_SYNC_ENABLE   0x01
-#define CO_CONFIG_SYNC_PRODUCER 0x02
+#define CO_CONFIG_SYNC_ENABLE            0x01
+#define CO_CONFIG_SYNC_PRODUCER          0x02
+#define CO_CONFIG_SYNC_PRODUCER_DEADLINE 0x04
 
 /**
  * Configuration of @ref CO_PDO
@@ -513,11 +568,14 @@ extern "C" {
  *
  * Possible flags, can be ORed:
  * - CO_CONFIG_STORAGE_ENABLE - Enable data storage
+ * - CO_CONFIG_STORAGE_DIRTY - Enable @ref OD_initCallbackWritten(), which reports regions written by
+ *   @ref OD_writeOriginal(). Target specific auto storage may use it to save only changed data.
  */
 #ifdef CO_DOXYGEN
-#define CO_CONFIG_STORAGE (CO_CONFIG_STORAGE_ENABLE)
+#define CO_CONFIG_STORAGE (CO_CONFIG_STORAGE_ENABLE | CO_CONFIG_STORAGE_DIRTY)
 #endif
 #define CO_CONFIG_STORAGE_ENABLE 0x01
+#define CO_CONFIG_STORAGE_DIRTY  0x02
 /** @} */ /* CO_STACK_CONFIG_STORAGE */
 
 /**
@@ -565,6 +623,8 @@ extern "C" {
  * Possible flags, can be ORed:
  * - CO_CONFIG_SRDO_ENABLE - Enable the SRDO object.
  * - CO_CONFIG_SRDO_CHECK_TX - Enable checking data before sending.
+ * - CO_CONFIG_SRDO_DIRECT_MAP - Copy mapped OD variables without OD extension
+ *   directly from/to their memory location, without OD_IO read/write.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received RSRDO CAN message.
  *   Callback is configured by CO_SRDO_initCallbackPre().
@@ -574,8 +634,9 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SRDO (0)
 #endif
-#define CO_CONFIG_SRDO_ENABLE   0x01
-#define CO_CONFIG_SRDO_CHECK_TX 0x02
+#define CO_CONFIG_SRDO_ENABLE     0x01
+#define CO_CONFIG_SRDO_CHECK_TX   0x02
+#define CO_CONFIG_SRDO_DIRECT_MAP 0x04
 
 /**
  * SRDO Tx time delay
@@ -601,9 +662,13 @@ extern "C" {
  * - CO_CONFIG_LSS_SLAVE_FASTSCAN_DIRECT_RESPOND - Send LSS fastscan respond
  *   directly from CO_LSSslave_receive() function.
  * - CO_CONFIG_LSS_MASTER - Enable LSS master
+ * - CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE - Shorten LSS master fastscan
+ *   response window according to measured response latency of the slaves.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received CAN message.
  *   Callback is configured by CO_LSSmaster_initCallbackPre().
+ * - #CO_CONFIG_FLAG_TIMERNEXT - Enable calculation of timerNext_us variable
+ *   with CO_LSSmaster_timerNext().
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_LSS (CO_CONFIG_LSS_SLAVE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE)
@@ -611,6 +676,7 @@ extern "C" {
 #define CO_CONFIG_LSS_SLAVE                         0x01
 #define CO_CONFIG_LSS_SLAVE_FASTSCAN_DIRECT_RESPOND 0x02
 #define CO_CONFIG_LSS_MASTER                        0x10
+#define CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE      0x20
 /** @} */ /* CO_STACK_CONFIG_LSS */
 
 /**
@@ -641,6 +707,20 @@ extern "C" {
  *   help usage.
  * - CO_CONFIG_GTW_ASCII_PRINT_LEDS - Display "red" and "green" CANopen status
  *   LED diodes on terminal.
+ * - CO_CONFIG_GTW_BINARY - Enable non-standard binary frames in the command
+ *   stream of gateway-ascii device, see @ref CO_CANopen_309_3_Binary. If set,
+ *   then CO_CONFIG_GTW_ASCII_SDO and CO_CONFIG_FIFO_ALT_READ must also be set.
+ * - CO_CONFIG_GTW_ASCII_SUBSCRIBE - Enable non-standard commands "sub" and
+ *   "unsub" in gateway-ascii device. Client subscribes to Object Dictionary
+ *   entries or PDO messages and receives their values, when they change. If
+ *   set, then CO_CONFIG_GTW_ASCII_SDO must also be set. See also
+ *   @ref CO_CONFIG_GTWA_SUBSCRIPTIONS.
+ * - CO_CONFIG_GTW_ASCII_NODES - Enable non-standard command "nodes" in
+ *   gateway-ascii device, which prints network state table and its log of
+ *   changes. If set, then CO_CONFIG_HB_CONS_NET_TABLE must also be set.
+ * - CO_CONFIG_GTW_ASCII_EMCY - Enable non-standard command "emcy" in
+ *   gateway-ascii device, which prints aggregated emergency messages and
+ *   their history. If set, then CO_CONFIG_EM_CONS_AGGREGATE must also be set.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_GTW (0)
@@ -654,6 +734,10 @@ extern "C" {
 #define CO_CONFIG_GTW_ASCII_ERROR_DESC 0x40
 #define CO_CONFIG_GTW_ASCII_PRINT_HELP 0x80
 #define CO_CONFIG_GTW_ASCII_PRINT_LEDS 0x100
+#define CO_CONFIG_GTW_BINARY           0x200
+#define CO_CONFIG_GTW_ASCII_SUBSCRIBE  0x400
+#define CO_CONFIG_GTW_ASCII_NODES      0x800
+#define CO_CONFIG_GTW_ASCII_EMCY       0x1000
 
 /**
  * Number of loops of #CO_SDOclientDownload() in case of block download
@@ -682,6 +766,28 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_GTWA_LOG_BUF_SIZE 2000
 #endif
+
+/**
+ * Number of ASCII gateway objects (sessions), 1 to 32.
+ *
+ * Each session has own command and response stream, so multiple clients (socket connections, for example) can use the
+ * gateway concurrently. SDO client objects are shared between sessions, up to one per session. If there are less SDO
+ * clients (0x1280+) in Object Dictionary than sessions, then SDO commands from different sessions are serialized. Each
+ * session occupies memory for own command and message log buffer.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_GTWA_SESSIONS 1
+#endif
+
+/**
+ * Number of subscriptions per ASCII gateway session, 1 to 64.
+ *
+ * Used, if CO_CONFIG_GTW_ASCII_SUBSCRIBE is set. Each subscription of each session reserves one CAN receive buffer,
+ * which is used, when PDO message is subscribed.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_GTWA_SUBSCRIPTIONS 8
+#endif
 /** @} */ /* CO_STACK_CONFIG_GATEWAY */
 
 /**
@@ -695,12 +801,16 @@ extern "C" {
  * Possible flags, can be ORed:
  * - CO_CONFIG_CRC16_ENABLE - Enable CRC16 calculation
  * - CO_CONFIG_CRC16_EXTERNAL - CRC functions are defined externally
+ * - CO_CONFIG_CRC16_SLICE8 - crc16_ccitt() calculates blocks eight bytes at a
+ *   time (slice-by-8). It is several times faster on long blocks (storage,
+ *   SDO block transfer), but needs additional 3.5 kB of constant tables.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_CRC16 (0)
 #endif
 #define CO_CONFIG_CRC16_ENABLE   0x01
 #define CO_CONFIG_CRC16_EXTERNAL 0x02
+#define CO_CONFIG_CRC16_SLICE8   0x04
 /** @} */ /* CO_STACK_CONFIG_CRC16 */
 
 /**
@@ -749,14 +859,12 @@ extern "C" {
  *
  * Possible flags, can be ORed:
  * - CO_CONFIG_TRACE_ENABLE - Enable Trace recorder
- * - CO_CONFIG_TRACE_OWN_INTTYPES - If set, then macros PRIu32("u" or "lu")
- *   and PRId32("d" or "ld") must be set. (File inttypes.h can not be included).
+ * - #CO_CONFIG_FLAG_TIMERNEXT - Enable calculation of timerNext_us variable
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_TRACE (0)
 #endif
-#define CO_CONFIG_TRACE_ENABLE       0x01
-#define CO_CONFIG_TRACE_OWN_INTTYPES 0x02
+#define CO_CONFIG_TRACE_ENABLE 0x01
 /** @} */ /* CO_STACK_CONFIG_TRACE */
 
 /**
@@ -77,49 +77,50 @@ CO_fifo_init(CO_fifo_t* fifo, uint8_t* buf, size_t bufSize) {
  ******************************************************************************/
 size_t
 CO_fifo_write(CO_fifo_t* fifo, const uint8_t* buf, size_t count, uint16_t* crc) {
-    size_t i;
-    uint8_t* bufDest;
+    size_t writePtr;
+    size_t space;
+    size_t countFirst;
 
     if ((fifo == NULL) || (fifo->buf == NULL) || (buf == NULL)) {
         return 0;
     }
 
-    bufDest = &fifo->buf[fifo->writePtr];
-    for (i = count; i > 0U; i--) {
-        size_t writePtrNext = fifo->writePtr + 1U;
-
-        /* is circular buffer full */
-        if ((writePtrNext == fifo->readPtr) || ((writePtrNext == fifo->bufSize) && (fifo->readPtr == 0U))) {
-            break;
-        }
-
-        *bufDest = *buf;
+    /* Free space is contiguous up to the end of the buffer, rest continues from its beginning. Copy both spans and
+     * update writePtr only once, after data are in the buffer. */
+    writePtr = fifo->writePtr;
+    space = CO_fifo_getSpace(fifo);
+    if (count > space) {
+        count = space;
+    }
+    countFirst = fifo->bufSize - writePtr;
+    if (countFirst > count) {
+        countFirst = count;
+    }
+    (void)memcpy((void*)&fifo->buf[writePtr], (const void*)buf, countFirst);
+    (void)memcpy((void*)&fifo->buf[0], (const void*)&buf[countFirst], count - countFirst);
 
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_CRC16_CCITT) != 0
-        if (crc != NULL) {
-            crc16_ccitt_single(crc, *buf);
-        }
+    if (crc != NULL) {
+        *crc = crc16_ccitt(buf, count, *crc);
+    }
+#else
+    (void)crc;
 #endif
 
-        /* increment variables */
-        if (writePtrNext == fifo->bufSize) {
-            fifo->writePtr = 0;
-            bufDest = &fifo->buf[0];
-        } else {
-            fifo->writePtr++;
-            bufDest++;
-        }
-        buf++;
+    writePtr += count;
+    if (writePtr >= fifo->bufSize) {
+        writePtr -= fifo->bufSize;
     }
+    fifo->writePtr = writePtr;
 
-    return count - i;
+    return count;
 }
 
 size_t
 CO_fifo_read(CO_fifo_t* fifo, uint8_t* buf, size_t count, bool_t* eof) {
-    size_t i;
-    const uint8_t* bufSrc;
-    bool_t alive_cycle = true;
+    size_t readPtr;
+    size_t occupied;
+    size_t countFirst;
 
     if (eof != NULL) {
         *eof = false;
@@ -128,62 +129,63 @@ CO_fifo_read(CO_fifo_t* fifo, uint8_t* buf, size_t count, bool_t* eof) {
         return 0;
     }
 
-    bufSrc = &fifo->buf[fifo->readPtr];
-    for (i = count; (i > 0U) && alive_cycle;) {
-        const uint8_t c = *bufSrc;
-
-        /* is circular buffer empty */
-        if (fifo->readPtr == fifo->writePtr) {
-            alive_cycle = false;
-        } else {
-            *buf = c;
-            buf++;
-
-            /* increment variables */
-            if (++fifo->readPtr == fifo->bufSize) {
-                fifo->readPtr = 0;
-                bufSrc = &fifo->buf[0];
-            } else {
-                bufSrc++;
-            }
-            i--;
+    readPtr = fifo->readPtr;
+    occupied = CO_fifo_getOccupied(fifo);
+    if (count > occupied) {
+        count = occupied;
+    }
+    countFirst = fifo->bufSize - readPtr;
+    if (countFirst > count) {
+        countFirst = count;
+    }
 
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ASCII_COMMANDS) != 0
-            /* is delimiter? */
-            if ((eof != NULL) && (c == DELIM_COMMAND)) {
+    /* read up to and including delimiter */
+    if (eof != NULL) {
+        const uint8_t* delim = memchr(&fifo->buf[readPtr], (int)DELIM_COMMAND, countFirst);
+        if (delim != NULL) {
+            count = (size_t)(delim - &fifo->buf[readPtr]) + 1U;
+            countFirst = count;
+            *eof = true;
+        } else {
+            delim = memchr(&fifo->buf[0], (int)DELIM_COMMAND, count - countFirst);
+            if (delim != NULL) {
+                count = countFirst + (size_t)(delim - &fifo->buf[0]) + 1U;
                 *eof = true;
-                alive_cycle = false;
             }
-#endif
         }
     }
+#endif
+
+    (void)memcpy((void*)buf, (const void*)&fifo->buf[readPtr], countFirst);
+    (void)memcpy((void*)&buf[countFirst], (const void*)&fifo->buf[0], count - countFirst);
+
+    readPtr += count;
+    if (readPtr >= fifo->bufSize) {
+        readPtr -= fifo->bufSize;
+    }
+    fifo->readPtr = readPtr;
 
-    return count - i;
+    return count;
 }
 
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ALT_READ) != 0
 size_t
 CO_fifo_altBegin(CO_fifo_t* fifo, size_t offset) {
-    size_t i;
-
     if (fifo == NULL) {
         return 0;
     }
 
-    fifo->altReadPtr = fifo->readPtr;
-    for (i = offset; i > 0U; i--) {
-        /* is circular buffer empty */
-        if (fifo->altReadPtr == fifo->writePtr) {
-            break;
-        }
-
-        /* increment variable */
-        if (++fifo->altReadPtr == fifo->bufSize) {
-            fifo->altReadPtr = 0;
-        }
+    size_t occupied = CO_fifo_getOccupied(fifo);
+    if (offset > occupied) {
+        offset = occupied;
+    }
+    fifo->altReadPtr = fifo->readPtr + offset;
+    if (fifo->altReadPtr >= fifo->bufSize) {
+        fifo->altReadPtr -= fifo->bufSize;
     }
 
-    return offset - i;
+    return offset;
 }
 
 void
@@ -193,52 +195,45 @@ CO_fifo_altFinish(CO_fifo_t* fifo, uint16_t* crc) {
         return;
     }
 
-    if (crc == NULL) {
-        fifo->readPtr = fifo->altReadPtr;
-    } else {
-        const uint8_t* bufSrc = &fifo->buf[fifo->readPtr];
-        while (fifo->readPtr != fifo->altReadPtr) {
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_CRC16_CCITT) != 0
-            crc16_ccitt_single(crc, *bufSrc);
-#endif
-            /* increment variable */
-            if (++fifo->readPtr == fifo->bufSize) {
-                fifo->readPtr = 0;
-                bufSrc = &fifo->buf[0];
-            } else {
-                bufSrc++;
-            }
+    /* calculate CRC over consumed data, which may wrap around the end of the buffer */
+    if ((crc != NULL) && (fifo->readPtr != fifo->altReadPtr)) {
+        if (fifo->altReadPtr > fifo->readPtr) {
+            *crc = crc16_ccitt(&fifo->buf[fifo->readPtr], fifo->altReadPtr - fifo->readPtr, *crc);
+        } else {
+            *crc = crc16_ccitt(&fifo->buf[fifo->readPtr], fifo->bufSize - fifo->readPtr, *crc);
+            *crc = crc16_ccitt(&fifo->buf[0], fifo->altReadPtr, *crc);
         }
     }
+#else
+    (void)crc;
+#endif
+    fifo->readPtr = fifo->altReadPtr;
 }
 
 size_t
 CO_fifo_altRead(CO_fifo_t* fifo, uint8_t* buf, size_t count) {
-    size_t i;
-    const uint8_t* bufSrc;
+    size_t altReadPtr = fifo->altReadPtr;
+    size_t occupied = CO_fifo_altGetOccupied(fifo);
+    size_t countFirst;
 
-    bufSrc = &fifo->buf[fifo->altReadPtr];
-    for (i = count; i > 0U; i--) {
-        const uint8_t c = *bufSrc;
-
-        /* is there no more data */
-        if (fifo->altReadPtr == fifo->writePtr) {
-            break;
-        }
-
-        *buf = c;
-        buf++;
+    if (count > occupied) {
+        count = occupied;
+    }
+    countFirst = fifo->bufSize - altReadPtr;
+    if (countFirst > count) {
+        countFirst = count;
+    }
+    (void)memcpy((void*)buf, (const void*)&fifo->buf[altReadPtr], countFirst);
+    (void)memcpy((void*)&buf[countFirst], (const void*)&fifo->buf[0], count - countFirst);
 
-        /* increment variables */
-        if (++fifo->altReadPtr == fifo->bufSize) {
-            fifo->altReadPtr = 0;
-            bufSrc = &fifo->buf[0];
-        } else {
-            bufSrc++;
-        }
+    altReadPtr += count;
+    if (altReadPtr >= fifo->bufSize) {
+        altReadPtr -= fifo->bufSize;
     }
+    fifo->altReadPtr = altReadPtr;
 
-    return count - i;
+    return count;
 }
 #endif /* (CO_CONFIG_FIFO) & CO_CONFIG_FIFO_ALT_READ */
 
@@ -321,99 +316,111 @@ CO_fifo_trimSpaces(CO_fifo_t* fifo, bool_t* insideComment) {
     return delimCommandFound;
 }
 
+/* Graphical character, same as isgraph() in "C" locale */
+static inline bool_t
+isGraph(uint8_t c) {
+    return (c > 0x20U) && (c < 0x7FU);
+}
+
 size_t
-CO_fifo_readToken(CO_fifo_t* fifo, char* buf, size_t count, uint8_t* closed, bool_t* err) {
+CO_fifo_readTokenSpan(CO_fifo_t* fifo, const char** token, char* buf, size_t count, uint8_t* closed, bool_t* err) {
     bool_t delimCommandFound = false;
     bool_t delimCommentFound = false;
     size_t tokenSize = 0;
+    size_t tokenStart = 0;
+
+    *token = buf;
 
     if ((fifo != NULL) && (buf != NULL) && (count > 1U) && ((err == NULL) || (*err == false))
         && (fifo->readPtr != fifo->writePtr)) {
+        const uint8_t* b = fifo->buf;
+        size_t bufSize = fifo->bufSize;
+        size_t writePtr = fifo->writePtr;
+        size_t ptr = fifo->readPtr; /* current pointer (integer, 0 based) */
         bool_t finished = false;
-        uint8_t step = 0;
-        size_t ptr = fifo->readPtr;   /* current pointer (integer, 0 based) */
-        uint8_t* c = &fifo->buf[ptr]; /* current character */
-        do {
-            switch (step) {
-                case 0: /* skip leading empty characters, stop on delimiter */
-                    if (isgraph((int)*c) != 0) {
-                        if (*c == DELIM_COMMENT) {
-                            delimCommentFound = true;
-                        } else {
-                            buf[tokenSize] = (char)*c;
-                            tokenSize++;
-                            step++;
-                        }
-                    } else if (*c == DELIM_COMMAND) {
-                        delimCommandFound = true;
-                    } else { /* MISRA C 2004 14.10 */
-                    }
-                    break;
-                case 1: /* search for end of the token */
-                    if (isgraph((int)*c) != 0) {
-                        if (*c == DELIM_COMMENT) {
-                            delimCommentFound = true;
-                        } else if (tokenSize < count) {
-                            buf[tokenSize] = (char)*c;
-                            tokenSize++;
-                        } else { /* MISRA C 2004 14.10 */
-                        }
-                    } else {
-                        if (*c == DELIM_COMMAND) {
-                            delimCommandFound = true;
-                        }
-                        step++;
-                    }
-                    break;
-                case 2: /* skip trailing empty characters */
-                    if (isgraph((int)*c) != 0) {
-                        if (*c == DELIM_COMMENT) {
-                            delimCommentFound = true;
-                        } else {
-                            fifo->readPtr = ptr;
-                            finished = true;
-                        }
-                    } else if (*c == DELIM_COMMAND) {
-                        delimCommandFound = true;
-                    } else { /* MISRA C 2004 14.10 */
-                    }
-                    break;
-                default:
-                    /* MISRA C 2004 15.3 */
-                    break;
-            }
-            if (delimCommentFound == true) {
-                /* Comment delimiter found, clear all till end of the line. */
-                fifo->readPtr = ptr;
-                delimCommandFound = CO_fifo_CommSearch(fifo, true);
+        uint8_t c = b[ptr];
+
+        /* skip leading empty characters, stop on delimiter or at the beginning of the token */
+        while (!finished && !isGraph(c)) {
+            if (c == DELIM_COMMAND) {
+                delimCommandFound = true;
                 finished = true;
-            } else if (delimCommandFound) {
-                /* command delimiter found, set readPtr behind it. */
-                if (++ptr == fifo->bufSize) {
+            } else {
+                if (++ptr == bufSize) {
                     ptr = 0;
                 }
-                fifo->readPtr = ptr;
+                /* only empty characters, leave them in the buffer */
+                finished = ptr == writePtr;
+                c = b[ptr];
+            }
+        }
+
+        /* search for end of the token */
+        if (!finished && (c != DELIM_COMMENT)) {
+            tokenStart = ptr;
+            while (!finished && isGraph(c) && (c != DELIM_COMMENT)) {
+                tokenSize++;
+                if (++ptr == bufSize) {
+                    ptr = 0;
+                }
+                if (ptr == writePtr) {
+                    /* token is not terminated yet, leave it in the buffer */
+                    tokenSize = 0;
+                    finished = true;
+                }
+                c = b[ptr];
+            }
+            if (!finished && !isGraph(c)) {
+                if (c == DELIM_COMMAND) {
+                    delimCommandFound = true;
+                    finished = true;
+                }
+            }
+        }
+
+        /* skip trailing empty characters */
+        while (!finished && !isGraph(c)) {
+            if (c == DELIM_COMMAND) {
+                delimCommandFound = true;
                 finished = true;
-            } else if (!finished) {
-                /* find next character in the circular buffer */
-                if (++ptr == fifo->bufSize) {
+            } else {
+                if (++ptr == bufSize) {
                     ptr = 0;
-                    c = &fifo->buf[ptr];
-                } else {
-                    c++;
                 }
-                /* end, if buffer is now empty */
-                if (ptr == fifo->writePtr) {
-                    if (step == 2U) {
-                        fifo->readPtr = ptr;
-                    } else {
-                        tokenSize = 0;
-                    }
+                if (ptr == writePtr) {
+                    fifo->readPtr = ptr;
                     finished = true;
                 }
-            } else { /* MISRA C 2004 14.10 */
+                c = b[ptr];
             }
-        } while (!finished);
+        }
+
+        if (!finished) {
+            /* graphical character: comment or the next token */
+            if (c == DELIM_COMMENT) {
+                delimCommentFound = true;
+            } else {
+                fifo->readPtr = ptr;
+            }
+        } else if (delimCommandFound) {
+            /* command delimiter found, set readPtr behind it. */
+            if (++ptr == bufSize) {
+                ptr = 0;
+            }
+            fifo->readPtr = ptr;
+        } else { /* MISRA C 2004 14.10 */
+        }
+
+        if (delimCommentFound) {
+            /* Comment delimiter found, clear all till end of the line. */
+            fifo->readPtr = ptr;
+            delimCommandFound = CO_fifo_CommSearch(fifo, true);
+        }
+    }
+
+    /* token was larger then size of the buffer, all was cleaned, return empty */
+    if (tokenSize >= count) {
+        tokenSize = count;
     }
 
     /* set 'err' return value */
@@ -430,9 +437,37 @@ CO_fifo_readToken(CO_fifo_t* fifo, char* buf, size_t count, uint8_t* closed, boo
         *closed = delimCommandFound ? 1U : 0U;
     }
 
-    /* token was larger then size of the buffer, all was cleaned, return empty */
     if (tokenSize == count) {
         tokenSize = 0;
+    } else if (tokenSize > 0U) {
+        /* Token is followed by an empty character or comment delimiter. Copy it, only if it wraps around the end of
+         * the circular buffer. */
+        if ((tokenStart + tokenSize) < fifo->bufSize) {
+            *token = (const char*)&fifo->buf[tokenStart];
+        } else {
+            size_t countFirst = fifo->bufSize - tokenStart;
+            if (countFirst > tokenSize) {
+                countFirst = tokenSize;
+            }
+            (void)memcpy((void*)buf, (const void*)&fifo->buf[tokenStart], countFirst);
+            (void)memcpy((void*)&buf[countFirst], (const void*)&fifo->buf[0], tokenSize - countFirst);
+            buf[tokenSize] = '\0';
+        }
+    } else if ((buf != NULL) && (count > 0U)) {
+        buf[0] = '\0';
+    } else { /* MISRA C 2004 14.10 */
+    }
+
+    return tokenSize;
+}
+
+size_t
+CO_fifo_readToken(CO_fifo_t* fifo, char* buf, size_t count, uint8_t* closed, bool_t* err) {
+    const char* token;
+    size_t tokenSize = CO_fifo_readTokenSpan(fifo, &token, buf, count, closed, err);
+
+    if (token != buf) {
+        (void)memcpy((void*)buf, (const void*)token, tokenSize);
     }
     /* write string terminator character */
     if ((buf != NULL) && (count > tokenSize)) {
@@ -365,6 +365,27 @@ bool_t CO_fifo_trimSpaces(CO_fifo_t* fifo, bool_t* insideComment);
  * @return Number of bytes read.
  */
 size_t CO_fifo_readToken(CO_fifo_t* fifo, char* buf, size_t count, uint8_t* closed, bool_t* err);
+
+/**
+ * Get token from FIFO buffer without copying
+ *
+ * Same as CO_fifo_readToken(), but token is not copied, if it is contiguous in the circular buffer. Then *token points
+ * inside the FIFO buffer. Token is not null terminated there, but it is followed by an empty character or comment
+ * delimiter, so it can be parsed with strtoul(), for example. Pointer is valid until the next write into the FIFO. If
+ * token wraps around the end of the buffer, it is copied into buf, null terminated, and *token points to buf.
+ *
+ * @param fifo This object.
+ * @param [out] token Pointer to the token, not NULL.
+ * @param buf Buffer for the token, if it must be copied. Also on error or empty token *token points to buf with empty
+ * string.
+ * @param count Size of buf. Longer tokens are errors, as in CO_fifo_readToken().
+ * @param [in,out] closed See CO_fifo_readToken().
+ * @param [out] err See CO_fifo_readToken().
+ *
+ * @return Length of the token.
+ */
+size_t CO_fifo_readTokenSpan(CO_fifo_t* fifo, const char** token, char* buf, size_t count, uint8_t* closed,
+                             bool_t* err);
 #endif /* (CO_CONFIG_FIFO) & CO_CONFIG_FIFO_ASCII_COMMANDS */
 
 #if (((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ASCII_DATATYPES) != 0) || defined CO_DOXYGEN
@@ -90,6 +90,28 @@ CO_SRDO_receive_inverted(void* object, void* msg) {
     }
 }
 
+/* Verify, if inverted data are bitwise inverted normal data. Compare four bytes at once. */
+static bool_t
+CO_SRDO_isInverted(const uint8_t* normal, const uint8_t* inverted, CO_SRDO_size_t length) {
+    CO_SRDO_size_t i = 0;
+
+    for (; (i + 4U) <= length; i += 4U) {
+        uint32_t n;
+        uint32_t inv;
+        (void)memcpy((void*)(&n), (const void*)(&normal[i]), sizeof(n));
+        (void)memcpy((void*)(&inv), (const void*)(&inverted[i]), sizeof(inv));
+        if ((n ^ inv) != 0xFFFFFFFFU) {
+            return false;
+        }
+    }
+    for (; i < length; i++) {
+        if ((uint8_t)(normal[i] ^ inverted[i]) != 0xFFU) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /* Set OD object 13FE:00 to CO_SRDO_INVALID and clear configurationValid flag. */
 static void
 configurationValidUnset(CO_SRDOGuard_t* SRDOGuard) {
@@ -558,6 +580,9 @@ CO_SRDO_config(CO_SRDO_t* SRDO, uint8_t SRDO_Index, CO_SRDOGuard_t* SRDOGuard, u
                 stream->dataOffset = mappedLength;
                 OD_IO->read = OD_read_dummy;
                 OD_IO->write = OD_write_dummy;
+#if ((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_DIRECT_MAP) != 0
+                SRDO->mapDirect[i] = NULL;
+#endif
             }
             /* find entry in the Object Dictionary */
             else {
@@ -579,6 +604,19 @@ CO_SRDO_config(CO_SRDO_t* SRDO, uint8_t SRDO_Index, CO_SRDOGuard_t* SRDOGuard, u
                     *OD_IO = OD_IOcopy;
                     OD_IO->stream.dataOffset = mappedLength;
                     srdoDataLength[plain_inverted] += mappedLength;
+
+#if ((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_DIRECT_MAP) != 0
+                    /* Variable without OD extension is copied directly from/to its memory location */
+                    SRDO->mapDirect[i] = NULL;
+                    if ((OD_IO->read == OD_readOriginal) && (OD_IO->write == OD_writeOriginal)
+                        && (OD_IO->stream.dataOrig != NULL)
+#ifdef CO_BIG_ENDIAN
+                        && ((OD_IO->stream.attribute & ODA_MB) == 0U)
+#endif
+                    ) {
+                        SRDO->mapDirect[i] = (uint8_t*)OD_IO->stream.dataOrig;
+                    }
+#endif
                 }
             }
             if (err != 0U) {
@@ -776,6 +814,14 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
                             break;
                         }
 
+#if ((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_DIRECT_MAP) != 0
+                        if (SRDO->mapDirect[i] != NULL) {
+                            (void)memcpy(dataSRDO[plain_inverted], SRDO->mapDirect[i], mappedLength);
+                            dataSRDO[plain_inverted] += mappedLength;
+                            continue;
+                        }
+#endif
+
                         /* length of OD variable may be larger than mappedLength */
                         OD_size_t ODdataLength = stream->dataLength;
                         if (ODdataLength > CO_SRDO_MAX_SIZE) {
@@ -826,12 +872,10 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
                         bool_t data_ok = true;
 #if ((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_CHECK_TX) != 0
                         /* check data before sending (optional) */
-                        for (uint8_t i = 0; i < SRDO->dataLength; i++) {
-                            if ((uint8_t)(~SRDO->CANtxBuff[0]->data[i]) != SRDO->CANtxBuff[1]->data[i]) {
-                                SRDO->internalState = CO_SRDO_state_error_txNotInverted;
-                                data_ok = false;
-                                break;
-                            }
+                        if (!CO_SRDO_isInverted(SRDO->CANtxBuff[0]->data, SRDO->CANtxBuff[1]->data,
+                                                SRDO->dataLength)) {
+                            SRDO->internalState = CO_SRDO_state_error_txNotInverted;
+                            data_ok = false;
                         }
 #endif
                         if (data_ok) {
@@ -847,20 +891,21 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
                         }
                     }
                 }
-            } else {
-                if (SRDO->invertedDelay == 0U) {
-                    if (CO_CANsend(SRDO->CANdevTx[1], SRDO->CANtxBuff[1]) == CO_ERROR_NO) {
-                        SRDO->nextIsNormal = true;
-                    } else {
-                        SRDO->internalState = CO_SRDO_state_error_txFail;
-                    }
+            }
+            /* Inverted message follows after minimum delay. If delay is zero, it is sent in the same cycle. */
+            if (!SRDO->nextIsNormal && (SRDO->invertedDelay == 0U)) {
+                if (CO_CANsend(SRDO->CANdevTx[1], SRDO->CANtxBuff[1]) == CO_ERROR_NO) {
+                    SRDO->nextIsNormal = true;
+                } else {
+                    SRDO->internalState = CO_SRDO_state_error_txFail;
                 }
             }
 
 #if ((CO_CONFIG_SRDO)&CO_CONFIG_FLAG_TIMERNEXT) != 0
             if (timerNext_us != NULL) {
-                if (*timerNext_us > SRDO->cycleTimer) {
-                    *timerNext_us = SRDO->cycleTimer; /* Schedule for the next message timer */
+                uint32_t timer = SRDO->nextIsNormal ? SRDO->cycleTimer : SRDO->invertedDelay;
+                if (*timerNext_us > timer) {
+                    *timerNext_us = timer; /* Schedule for the next message timer */
                 }
             }
 #endif
@@ -869,14 +914,14 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
             if (SRDO->rxSrdoShort) {
                 CO_errorReport(SRDO->em, CO_EM_RPDO_WRONG_LENGTH, CO_EMC_PDO_LENGTH, 0);
                 SRDO->internalState = CO_SRDO_state_error_rxShort;
-            } else if (CO_FLAG_READ(SRDO->CANrxNew[SRDO->nextIsNormal ? 0 : 1])) {
-                /* normal message received ? */
-                if (SRDO->nextIsNormal) {
+            } else {
+                /* normal message received */
+                if (SRDO->nextIsNormal && CO_FLAG_READ(SRDO->CANrxNew[0])) {
                     SRDO->validationTimer = SRDO->validationTime_us;
                     SRDO->nextIsNormal = false;
                 }
-                /* inverted message received */
-                else {
+                /* inverted message received, may be in the same cycle as normal message */
+                if (!SRDO->nextIsNormal && CO_FLAG_READ(SRDO->CANrxNew[1])) {
                     SRDO->cycleTimer = SRDO->cycleTime_us;
                     SRDO->validationTimer = SRDO->cycleTime_us;
                     SRDO->nextIsNormal = true;
@@ -885,12 +930,9 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
                     bool_t data_ok = true;
 
                     /* Verify, if normal and inverted data matches properly */
-                    for (uint8_t i = 0; i < SRDO->dataLength; i++) {
-                        if ((uint8_t)(~dataSRDO[0][i]) != dataSRDO[1][i]) {
-                            data_ok = false;
-                            SRDO->internalState = CO_SRDO_state_error_rxNotInverted;
-                            break;
-                        }
+                    if (!CO_SRDO_isInverted(dataSRDO[0], dataSRDO[1], SRDO->dataLength)) {
+                        data_ok = false;
+                        SRDO->internalState = CO_SRDO_state_error_rxNotInverted;
                     }
 
                     /* copy data from CAN messages into mapped data from Object Dictionary */
@@ -916,6 +958,18 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
                             if (ODdataLength > CO_SRDO_MAX_SIZE) {
                                 ODdataLength = CO_SRDO_MAX_SIZE;
                             }
+
+#if ((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_DIRECT_MAP) != 0
+                            if (SRDO->mapDirect[i] != NULL) {
+                                /* same as OD_writeOriginal(), remaining bytes are zeroed */
+                                (void)memcpy(SRDO->mapDirect[i], dataSRDO[plain_inverted], mappedLength);
+                                if (ODdataLength > mappedLength) {
+                                    (void)memset(&SRDO->mapDirect[i][mappedLength], 0, ODdataLength - mappedLength);
+                                }
+                                dataSRDO[plain_inverted] += mappedLength;
+                                continue;
+                            }
+#endif
                             /* Prepare data for writing into OD variable. If mappedLength
                              * is smaller than ODdataLength, then use auxiliary buffer */
                             uint8_t buf[CO_SRDO_MAX_SIZE];
@@ -962,8 +1016,7 @@ CO_SRDO_process(CO_SRDO_t* SRDO, uint32_t timeDifference_us, uint32_t* timerNext
 
                     CO_FLAG_CLEAR(SRDO->CANrxNew[0]);
                     CO_FLAG_CLEAR(SRDO->CANrxNew[1]);
-                }    /* inverted message received */
-            } else { /* MISRA C 2004 14.10 */
+                } /* inverted message received */
             }
 
             /* verify timeouts */
@@ -63,6 +63,8 @@ extern "C" {
  * operational CO_SRDO_config() must be called for each SRDO.
  *
  * CO_SRDO_process() must be executed cyclically, similar as PDO processing. Function is fast, no time consuming tasks.
+ * It should run in the realtime thread, because safety reaction time depends on its calling period. Normal and
+ * inverted message are processed in the same call, if both are available.
  * Function returns @ref CO_SRDO_state_t value, which may be used to determine working-state or safe-state of safety
  * related device. If return values from all SRDO objects are >= @ref CO_SRDO_state_communicationEstablished, then
  * working state is allowed. Otherwise SR device must be in safe state.
@@ -157,6 +159,10 @@ typedef struct {
                                                   erroneous mapping. OD_IO.dataOffset is set to 0 before read/write
                                                   function call and after the call OD_IO.dataOffset is set back to
                                                   mappedLength. */
+#if (((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_DIRECT_MAP) != 0) || defined CO_DOXYGEN
+    uint8_t* mapDirect[CO_SRDO_MAX_MAPPED_ENTRIES]; /**< Memory location of mapped OD variable, which is copied
+                                                       directly, or NULL, if OD_IO is used. Set by CO_SRDO_config(). */
+#endif
     CO_CANtx_t* CANtxBuff[2];                  /**< CAN transmit buffers inside CANdevTx */
     volatile void* CANrxNew[2];                /**< Variable indicates, if new SRDO message received from CAN bus. */
     bool_t rxSrdoShort;                        /**< true, if received SRDO is too short */
@@ -100,12 +100,49 @@ CO_LSSmaster_receive(void* object, void* msg) {
  * Generally, we do not really care if the message has been received before or after the timeout
  * expired. Only if no message has been received we have to check for timeouts.
  */
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+/*
+ * Get the response window of the current request.
+ *
+ * Fastscan window is shortened to twice the highest measured response latency plus margin. In scan state missing
+ * response is the information, so the shortened window is always used. Check and verify states wait for the full
+ * timeout before they conclude, that no node has responded.
+ */
+static uint32_t
+CO_LSSmaster_window(CO_LSSmaster_t* LSSmaster) {
+    uint32_t window = LSSmaster->timeout_us;
+
+    if ((LSSmaster->command == CO_LSSmaster_COMMAND_IDENTIFY_FASTSCAN) && LSSmaster->fsAdaptive
+        && (LSSmaster->fsLatency_us > 0U)
+        && ((LSSmaster->fsState == CO_LSSmaster_FS_STATE_SCAN) || CO_FLAG_READ(LSSmaster->CANrxNew))) {
+        uint32_t windowAdaptive = (2U * LSSmaster->fsLatency_us) + CO_LSSmaster_FS_WINDOW_MARGIN_US;
+        if (windowAdaptive < window) {
+            window = windowAdaptive;
+        }
+    }
+    return window;
+}
+#else
+#define CO_LSSmaster_window(LSSmaster) ((LSSmaster)->timeout_us)
+#endif
+
 static inline CO_LSSmaster_return_t
 CO_LSSmaster_check_timeout(CO_LSSmaster_t* LSSmaster, uint32_t timeDifference_us) {
     CO_LSSmaster_return_t ret = CO_LSSmaster_WAIT_SLAVE;
 
     LSSmaster->timeoutTimer += timeDifference_us;
-    if (LSSmaster->timeoutTimer >= LSSmaster->timeout_us) {
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+    /* Measure latency of the first response to the fastscan request. Resolution depends on the calling period, but
+     * mainline is usually triggered by the reception of the response. */
+    if ((LSSmaster->command == CO_LSSmaster_COMMAND_IDENTIFY_FASTSCAN) && !LSSmaster->fsLatencyMeasured
+        && CO_FLAG_READ(LSSmaster->CANrxNew)) {
+        LSSmaster->fsLatencyMeasured = true;
+        if (LSSmaster->timeoutTimer > LSSmaster->fsLatency_us) {
+            LSSmaster->fsLatency_us = LSSmaster->timeoutTimer;
+        }
+    }
+#endif
+    if (LSSmaster->timeoutTimer >= CO_LSSmaster_window(LSSmaster)) {
         LSSmaster->timeoutTimer = 0;
         ret = CO_LSSmaster_TIMEOUT;
     }
@@ -129,6 +166,11 @@ CO_LSSmaster_init(CO_LSSmaster_t* LSSmaster, uint16_t timeout_ms, CO_CANmodule_t
     LSSmaster->timeoutTimer = 0;
     CO_FLAG_CLEAR(LSSmaster->CANrxNew);
     (void)memset(LSSmaster->CANrxData, 0, sizeof(LSSmaster->CANrxData));
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+    LSSmaster->fsLatency_us = 0;
+    LSSmaster->fsLatencyMeasured = false;
+    LSSmaster->fsAdaptive = false;
+#endif
 #if ((CO_CONFIG_LSS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
     LSSmaster->pFunctSignal = NULL;
     LSSmaster->functSignalObject = NULL;
@@ -156,6 +198,19 @@ CO_LSSmaster_changeTimeout(CO_LSSmaster_t* LSSmaster, uint16_t timeout_ms) {
     }
 }
 
+#if ((CO_CONFIG_LSS)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+void
+CO_LSSmaster_timerNext(CO_LSSmaster_t* LSSmaster, uint32_t* timerNext_us) {
+    if ((LSSmaster != NULL) && (timerNext_us != NULL) && (LSSmaster->command != CO_LSSmaster_COMMAND_WAITING)) {
+        uint32_t window = CO_LSSmaster_window(LSSmaster);
+        uint32_t diff = (LSSmaster->timeoutTimer < window) ? (window - LSSmaster->timeoutTimer) : 0U;
+        if (*timerNext_us > diff) {
+            *timerNext_us = diff;
+        }
+    }
+}
+#endif
+
 #if ((CO_CONFIG_LSS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0
 void
 CO_LSSmaster_initCallbackPre(CO_LSSmaster_t* LSSmaster, void* object, void (*pFunctSignal)(void* object)) {
@@ -643,6 +698,9 @@ static void
 CO_LSSmaster_FsSendMsg(CO_LSSmaster_t* LSSmaster, uint32_t idNumber, uint8_t bitCheck, uint8_t lssSub,
                        uint8_t lssNext) {
     LSSmaster->timeoutTimer = 0;
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+    LSSmaster->fsLatencyMeasured = false;
+#endif
 
     CO_FLAG_CLEAR(LSSmaster->CANrxNew);
     LSSmaster->TXbuff->data[0] = CO_LSS_IDENT_FASTSCAN;
@@ -877,6 +935,9 @@ CO_LSSmaster_IdentifyFastscan(CO_LSSmaster_t* LSSmaster, uint32_t timeDifference
     if (LSSmaster->command == CO_LSSmaster_COMMAND_WAITING) {
         /* start fastscan */
         LSSmaster->command = CO_LSSmaster_COMMAND_IDENTIFY_FASTSCAN;
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+        LSSmaster->fsAdaptive = true;
+#endif
 
         /* check if any nodes are waiting, if yes fastscan is reset */
         LSSmaster->fsState = CO_LSSmaster_FS_STATE_CHECK;
@@ -955,6 +1016,21 @@ CO_LSSmaster_IdentifyFastscan(CO_LSSmaster_t* LSSmaster, uint32_t timeDifference
             break;
     }
 
+#if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0
+    /* Scanned value, which is not verified, or unexpected response may be caused by a late response to the previous
+     * request. Discard the measured latency and repeat the whole fastscan once with the full timeout. */
+    if (LSSmaster->fsAdaptive
+        && ((ret == CO_LSSmaster_SCAN_FAILED)
+            || ((ret == CO_LSSmaster_SCAN_NOACK) && (LSSmaster->fsState != CO_LSSmaster_FS_STATE_CHECK)
+                && (fastscan->scan[LSSmaster->fsLssSub] == CO_LSSmaster_FS_SCAN)))) {
+        LSSmaster->fsAdaptive = false;
+        LSSmaster->fsLatency_us = 0;
+        LSSmaster->fsState = CO_LSSmaster_FS_STATE_CHECK;
+        CO_LSSmaster_FsSendMsg(LSSmaster, 0, CO_LSS_FASTSCAN_CONFIRM, 0, 0);
+        ret = CO_LSSmaster_WAIT_SLAVE;
+    }
+#endif
+
     if (ret != CO_LSSmaster_WAIT_SLAVE) {
         /* finished */
         LSSmaster->command = CO_LSSmaster_COMMAND_WAITING;
@@ -104,6 +104,11 @@ typedef struct {
     volatile void* CANrxNew; /**< Indication if new LSS message is received from CAN bus. It needs to be cleared when
                                 received message is completely processed. */
     uint8_t CANrxData[8];    /**< 8 data bytes of the received message */
+#if (((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    uint32_t fsLatency_us;    /**< Highest measured response latency in fastscan, zero if not measured yet */
+    bool_t fsLatencyMeasured; /**< Latency of the current fastscan request is already measured */
+    bool_t fsAdaptive;        /**< If true, fastscan response window is shortened according to fsLatency_us */
+#endif
 #if (((CO_CONFIG_LSS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0) || defined CO_DOXYGEN
     void (*pFunctSignal)(void* object); /**< From CO_LSSmaster_initCallbackPre() or NULL */
     void* functSignalObject;            /**< Pointer to object */
@@ -120,6 +125,14 @@ typedef struct {
 #define CO_LSSmaster_DEFAULT_TIMEOUT 1000U /* ms */
 #endif
 
+/**
+ * Margin in us, added to twice the measured response latency, if adaptive fastscan is used. See
+ * #CO_LSSmaster_IdentifyFastscan()
+ */
+#ifndef CO_LSSmaster_FS_WINDOW_MARGIN_US
+#define CO_LSSmaster_FS_WINDOW_MARGIN_US 2000U
+#endif
+
 /**
  * Initialize LSS object.
  *
@@ -157,6 +170,19 @@ CO_ReturnError_t CO_LSSmaster_init(CO_LSSmaster_t* LSSmaster, uint16_t timeout_m
  */
 void CO_LSSmaster_changeTimeout(CO_LSSmaster_t* LSSmaster, uint16_t timeout_ms);
 
+#if (((CO_CONFIG_LSS)&CO_CONFIG_FLAG_TIMERNEXT) != 0) || defined CO_DOXYGEN
+/**
+ * Calculate time until the response window of the currently processed request expires
+ *
+ * LSS master functions have no timerNext_us argument. This function may be called after them, so mainline is not
+ * sleeping longer than necessary. This is important for fastscan, where missing response is the answer.
+ *
+ * @param LSSmaster This object.
+ * @param [out] timerNext_us info to OS, see @ref CO_process(). Value is only lowered.
+ */
+void CO_LSSmaster_timerNext(CO_LSSmaster_t* LSSmaster, uint32_t* timerNext_us);
+#endif
+
 #if (((CO_CONFIG_LSS)&CO_CONFIG_FLAG_CALLBACK_PRE) != 0) || defined CO_DOXYGEN
 /**
  * Initialize LSSmasterRx callback function.
@@ -365,6 +391,11 @@ fastscan.scan[CO_LSS_FASTSCAN_SERIAL] = CO_LSSmaster_FS_SCAN;
  *
  * @remark When doing partial scans, it is in the responsibility of the user that the LSS address is unique.
  *
+ * If CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE is enabled, response latency of the slaves is measured and each scan step
+ * waits only twice the highest measured latency plus #CO_LSSmaster_FS_WINDOW_MARGIN_US, but not longer than timeout.
+ * Missing response in check or verify step is still confirmed by full timeout. If scanned value is not verified, whole
+ * fastscan is repeated once with full timeout, because late response may have corrupted the result.
+ *
  * This function needs that no node is selected when starting the scan process.
  *
  * Function must be called cyclically until it returns != #CO_LSSmaster_WAIT_SLAVE. Function is non-blocking.
@@ -42,6 +42,29 @@
 #error CO_CONFIG_FIFO_ASCII_DATATYPES must be enabled.
 #endif
 #endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) == 0
+#error CO_CONFIG_GTW_ASCII_SDO must be enabled.
+#endif
+#if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ALT_READ) == 0
+#error CO_CONFIG_FIFO_ALT_READ must be enabled.
+#endif
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) == 0
+#error CO_CONFIG_GTW_ASCII_SDO must be enabled.
+#endif
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) == 0
+#error CO_CONFIG_HB_CONS_NET_TABLE must be enabled.
+#endif
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+#if ((CO_CONFIG_EM)&CO_CONFIG_EM_CONS_AGGREGATE) == 0
+#error CO_CONFIG_EM_CONS_AGGREGATE must be enabled.
+#endif
+#endif
 
 CO_ReturnError_t
 CO_GTWA_init(CO_GTWA_t* gtwa,
@@ -85,6 +108,7 @@ CO_GTWA_init(CO_GTWA_t* gtwa,
     gtwa->SDO_C = SDO_C;
     gtwa->SDOtimeoutTime = SDOclientTimeoutTime_ms;
     gtwa->SDOblockTransferEnable = SDOclientBlockTransfer;
+    gtwa->SDOpoolIdx = 0xFFU;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NMT) != 0
     gtwa->NMT = NMT;
@@ -109,6 +133,207 @@ CO_GTWA_init(CO_GTWA_t* gtwa,
     return CO_ERROR_NO;
 }
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+void
+CO_GTWA_initSDOpool(CO_GTWA_t* gtwa, CO_GTWA_SDOpool_t* SDOpool) {
+    if ((gtwa != NULL) && (gtwa->SDOpoolIdx == 0xFFU)) {
+        gtwa->SDOpool = ((SDOpool != NULL) && (SDOpool->SDO_C != NULL) && (SDOpool->count > 0U)) ? SDOpool : NULL;
+    }
+}
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+void
+CO_GTWA_initSDObulk(CO_GTWA_t* gtwa, CO_GTWA_SDObulk_t* SDObulk) {
+    if ((gtwa != NULL) && (gtwa->state != CO_GTWA_ST_BULK)) {
+        gtwa->SDObulk = ((SDObulk != NULL) && (SDObulk->bulk != NULL)) ? SDObulk : NULL;
+    }
+}
+#endif
+
+/* Bitmask of all SDO clients in the pool */
+static inline uint32_t
+SDOpoolMask(const CO_GTWA_SDOpool_t* pool) {
+    return (pool->count >= 32U) ? 0xFFFFFFFFU : (((uint32_t)1U << pool->count) - 1U);
+}
+
+/* Acquire free SDO client from the pool, if not already. Return false, if there is no free SDO client. */
+static bool_t
+SDOpoolAcquire(CO_GTWA_t* gtwa) {
+    CO_GTWA_SDOpool_t* pool = gtwa->SDOpool;
+
+    if ((pool == NULL) || (gtwa->SDOpoolIdx != 0xFFU)) {
+        return true;
+    }
+    uint32_t freeMask = ~pool->busy & SDOpoolMask(pool);
+    if (freeMask == 0U) {
+        return false;
+    }
+    uint8_t i = 0;
+    while ((freeMask & ((uint32_t)1U << i)) == 0U) {
+        i++;
+    }
+    pool->busy |= (uint32_t)1U << i;
+    gtwa->SDOpoolIdx = i;
+    gtwa->SDO_C = &pool->SDO_C[i];
+    return true;
+}
+
+/* Return SDO client to the pool, must be called only when gateway is not in SDO state, see SDOpoolReleaseIfUnused(). */
+static void
+SDOpoolRelease(CO_GTWA_t* gtwa) {
+    if ((gtwa->SDOpool != NULL) && (gtwa->SDOpoolIdx != 0xFFU)) {
+        gtwa->SDOpool->busy &= ~((uint32_t)1U << gtwa->SDOpoolIdx);
+        gtwa->SDOpoolIdx = 0xFFU;
+    }
+}
+
+/* Abort SDO transfer in progress and close SDO client, when session is disabled in the middle of the command. So SDO
+ * server is not left waiting for the rest of the transfer and SDO client goes back to the pool idle. */
+static void
+SDOabortActive(CO_GTWA_t* gtwa) {
+    CO_GTWA_state_t st = gtwa->state;
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_DATA_TRANSF;
+
+    if ((gtwa->SDOpool != NULL) && (gtwa->SDOpoolIdx == 0xFFU)) {
+        return; /* SDO client is not owned by this session */
+    }
+    if ((st == CO_GTWA_ST_READ) || (st == CO_GTWA_ST_MREAD) || (st == CO_GTWA_ST_BIN_READ)) {
+        (void)CO_SDOclientUpload(gtwa->SDO_C, 0, true, &abortCode, NULL, NULL, NULL);
+        CO_SDOclientClose(gtwa->SDO_C);
+    } else if ((st == CO_GTWA_ST_WRITE) || (st == CO_GTWA_ST_WRITE_ABORTED) || (st == CO_GTWA_ST_MWRITE)
+               || (st == CO_GTWA_ST_BIN_WRITE)) {
+        (void)CO_SDOclientDownload(gtwa->SDO_C, 0, true, false, &abortCode, NULL, NULL);
+        CO_SDOclientClose(gtwa->SDO_C);
+    } else { /* MISRA C 2004 14.10 */
+    }
+}
+
+/* Return SDO client to the pool, if current state doesn't use it (idle, LSS, log, help, led). So other sessions are not
+ * blocked by long LSS command or by session, which waits for the application to read the response. */
+static void
+SDOpoolReleaseIfUnused(CO_GTWA_t* gtwa) {
+    CO_GTWA_state_t st = gtwa->state;
+
+    if (((st & 0xF0U) != 0x10U) && (st != CO_GTWA_ST_BIN_READ) && (st != CO_GTWA_ST_BIN_WRITE)) {
+        SDOpoolRelease(gtwa);
+    }
+}
+#endif
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+void
+CO_GTWA_initLSSlock(CO_GTWA_t* gtwa, CO_GTWA_LSSlock_t* LSSlock) {
+    if (gtwa != NULL) {
+        gtwa->LSSlock = LSSlock;
+    }
+}
+
+/* Take ownership of the shared LSS master. Return true and set errCode, if LSS master is used by other session. */
+static bool_t
+LSSacquire(CO_GTWA_t* gtwa, CO_GTWA_respErrorCode_t* errCode) {
+    CO_GTWA_LSSlock_t* lock = gtwa->LSSlock;
+
+    if (lock == NULL) {
+        return false;
+    }
+    if ((lock->owner != NULL) && (lock->owner != gtwa)) {
+        *errCode = CO_GTWA_respErrorInternalState;
+        return true;
+    }
+    lock->owner = gtwa;
+    return false;
+}
+
+/* Release ownership of the shared LSS master, if current state doesn't use it. */
+static void
+LSSreleaseIfUnused(CO_GTWA_t* gtwa) {
+    CO_GTWA_LSSlock_t* lock = gtwa->LSSlock;
+    CO_GTWA_state_t st = gtwa->state;
+
+    if ((lock != NULL) && (lock->owner == gtwa) && ((st & 0xF0U) != 0x20U) && ((st & 0xF0U) != 0x30U)) {
+        lock->owner = NULL;
+    }
+}
+#endif
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+/* Receive PDO message of the subscription. Function may be called from the CAN receive thread. */
+static void
+CO_GTWA_subReceive(void* object, void* msg) {
+    CO_GTWA_sub_t* sub = (CO_GTWA_sub_t*)object;
+    uint8_t DLC = CO_CANrxMsg_readDLC(msg);
+    const uint8_t* data = CO_CANrxMsg_readData(msg);
+
+    if ((sub->type == CO_GTWA_SUB_PDO) && (DLC >= sub->dataLengthMin) && (DLC <= CO_GTWA_SUB_DATA_SIZE)) {
+        /* copy data and set 'new message' flag, older data are overwritten */
+        sub->CANrxDLC = DLC;
+        (void)memcpy(sub->CANrxData, data, DLC);
+        CO_FLAG_SET(sub->CANrxNew);
+    }
+}
+
+/* Cancel the subscription. If PDO was subscribed, disable its CAN receive buffer. */
+static void
+subCancel(CO_GTWA_t* gtwa, uint8_t id) {
+    CO_GTWA_sub_t* sub = &gtwa->sub[id];
+
+    if (sub->type == CO_GTWA_SUB_PDO) {
+        (void)CO_CANrxBufferInit(gtwa->CANdevRx, gtwa->CANdevRxIdx + id, 0, 0x7FF, false, (void*)sub,
+                                 CO_GTWA_subReceive);
+    }
+    sub->type = CO_GTWA_SUB_NONE;
+    sub->pending = false;
+    CO_FLAG_CLEAR(sub->CANrxNew);
+}
+
+CO_ReturnError_t
+CO_GTWA_initSubscriptions(CO_GTWA_t* gtwa, OD_t* OD, CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx) {
+    /* verify arguments */
+    if ((gtwa == NULL) || (OD == NULL) || (CANdevRx == NULL)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    gtwa->OD = OD;
+    gtwa->CANdevRx = CANdevRx;
+    gtwa->CANdevRxIdx = CANdevRxIdx;
+    gtwa->subTime_us = 0;
+
+    /* CAN receive buffers are configured, when PDO is subscribed */
+    for (uint8_t i = 0; i < CO_CONFIG_GTWA_SUBSCRIPTIONS; i++) {
+        CO_GTWA_sub_t* sub = &gtwa->sub[i];
+        CO_ReturnError_t ret;
+
+        sub->type = CO_GTWA_SUB_NONE;
+        sub->pending = false;
+        CO_FLAG_CLEAR(sub->CANrxNew);
+        ret = CO_CANrxBufferInit(CANdevRx, CANdevRxIdx + i, 0, 0x7FF, false, (void*)sub, CO_GTWA_subReceive);
+        if (ret != CO_ERROR_NO) {
+            return ret;
+        }
+    }
+
+    return CO_ERROR_NO;
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SUBSCRIBE */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+void
+CO_GTWA_initNetTable(CO_GTWA_t* gtwa, CO_HBconsumer_netTable_t* netTable) {
+    if (gtwa != NULL) {
+        gtwa->netTable = netTable;
+    }
+}
+#endif
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+void
+CO_GTWA_initEmcy(CO_GTWA_t* gtwa, CO_EM_t* em) {
+    if (gtwa != NULL) {
+        gtwa->em = em;
+    }
+}
+#endif
+
 void
 CO_GTWA_initRead(CO_GTWA_t* gtwa,
                  size_t (*readCallback)(void* object, const char* buf, size_t count, uint8_t* connectionOK),
@@ -145,6 +370,14 @@ static const char CO_GTWA_helpString[] =
     "\nCommand strings start with '\"[\"<sequence>\"]\"' followed by:\n"
     "[[<net>] <node>] r[ead] <index> <subindex> [<datatype>]        # SDO upload.\n"
     "[[<net>] <node>] w[rite] <index> <subindex> <datatype> <value> # SDO download.\n"
+    "[[<net>] <node>] mr[ead] <index> <subindex> <datatype> ...     # SDO upload of\n"
+    "                                 # multiple objects, non-standard.\n"
+    "[[<net>] <node>] mw[rite] <index> <subindex> <datatype> <value> ...\n"
+    "                                 # SDO download of multiple objects, non-standard.\n"
+    "[<net>] bulk r[ead] <node>[-<node>] <index> <subindex> <datatype>\n"
+    "[<net>] bulk w[rite] <node>[-<node>] <index> <subindex> <datatype> <value>\n"
+    "                                 # SDO upload or download of the same object\n"
+    "                                 # on range of nodes concurrently, non-standard.\n"
     "\n"
     "[[<net>] <node>] start                   # NMT Start node.\n"
     "[[<net>] <node>] stop                    # NMT Stop node.\n"
@@ -157,13 +390,24 @@ static const char CO_GTWA_helpString[] =
     "[<net>] set sdo_timeout <value>          # Configure SDO client time-out in ms.\n"
     "[<net>] set sdo_block <0|1>              # Enable/disable SDO block transfer.\n"
     "\n"
+    "[<net>] sub od <index> <subindex> <min_interval_ms> [<datatype>]\n"
+    "                                 # Subscribe to own OD entry, non-standard.\n"
+    "[<net>] sub pdo <COB-ID> <min_interval_ms> [<datatype> ...]\n"
+    "                                 # Subscribe to PDO message, non-standard.\n"
+    "unsub <id>|all                           # Cancel subscription, non-standard.\n"
+    "\n"
     "help [datatype|lss]                      # Print this or datatype or lss help.\n"
     "led                                      # Print status LEDs of this device.\n"
     "log                                      # Print message log.\n"
+    "nodes [<logSeq>]                         # Print state of the nodes in the\n"
+    "                                 # network or log of changes, non-standard.\n"
+    "emcy [<histSeq>]                         # Print received emergency messages\n"
+    "                                 # or their history, non-standard.\n"
     "\n"
     "Response:\n"
     "\"[\"<sequence>\"]\" OK | <value> |\n"
     "                 ERROR:<SDO-abort-code> | ERROR:<internal-error-code>\n"
+    "\"@\"<id> <timestamp_ms> <value> ...       # Subscription notification.\n"
     "\n"
     "* Every command must be terminated with <CR><LF> ('\\r\\n'). characters. Same\n"
     "  is response. String is not null terminated, <CR> is optional in command.\n"
@@ -172,7 +416,32 @@ static const char CO_GTWA_helpString[] =
     "* 'sdo_timeout' is in milliseconds, 500 by default. Block transfer is\n"
     "  disabled by default.\n"
     "* If '<net>' or '<node>' is not specified within commands, then value defined\n"
-    "  by 'set network' or 'set node' command is used.\r\n";
+    "  by 'set network' or 'set node' command is used.\n"
+    "* 'mread' and 'mwrite' accept list of objects. Response is one line with one\n"
+    "  value, OK or ERROR:<SDO-abort-code> for each object.\n"
+    "* 'bulk' runs transfers over SDO bulk engine, one per node in the range.\n"
+    "  Response is one line with <node>:<value>, <node>:OK or\n"
+    "  <node>:ERROR:<SDO-abort-code> for each node, printed when all transfers\n"
+    "  are finished. Datatype must have fixed length of at most 8 bytes. Only one\n"
+    "  'bulk' command may run at a time.\n"
+    "* 'sub' responds with subscription <id>. Later, when the value changes, the\n"
+    "  notification line is printed between the responses. It is printed at most\n"
+    "  once per <min_interval_ms>, with the latest value. OD entry is sampled with\n"
+    "  the same interval. Values are printed as hex, if <datatype> is omitted.\n"
+    "  PDO must not be received by the RPDO of this device.\n"
+    "* 'nodes' prints one line per node, which was seen or is monitored:\n"
+    "  <node> <NMT> <HB> <bootups> <timeouts> <changes> <last_seen_ms>. With\n"
+    "  <logSeq> it prints log entries from <logSeq> on:\n"
+    "  <logSeq> <time_ms> <node> <event> <NMT> <HB>. Response is the number of\n"
+    "  all log entries, which is <logSeq> for the next call.\n"
+    "* 'emcy' prints one line per node and error code received:\n"
+    "  <node> <errorCode> <errorRegister> <errorBit> <infoCode> <count>\n"
+    "  <first_ms> <last_ms>. Values from the last message are printed. With\n"
+    "  <histSeq> it prints history from <histSeq> on: one entry for the first\n"
+    "  message, then at most one per interval (1000 ms by default) for repeated\n"
+    "  messages:\n"
+    "  <histSeq> <time_ms> <node> <errorCode> <errorRegister> <errorBit>\n"
+    "  <infoCode> <count>. Response is the number of all history entries.\r\n";
 
 static const char CO_GTWA_helpStringDatatypes[] =
     "\nDatatypes:\n"
@@ -207,7 +476,9 @@ static const char CO_GTWA_helpStringLss[] =
     "* All LSS commands start with '\"[\"<sequence>\"]\" [<net>]'.\n"
     "* <table_index>: 0=1000 kbit/s, 1=800 kbit/s, 2=500 kbit/s, 3=250 kbit/s,\n"
     "                 4=125 kbit/s, 6=50 kbit/s, 7=20 kbit/s, 8=10 kbit/s, 9=auto\n"
-    "* <scanType>: 0=fastscan, 1=ignore, 2=match value in next parameter\r\n";
+    "* <scanType>: 0=fastscan, 1=ignore, 2=match value in next parameter\n"
+    "* lss_allnodes first tries to match identity of the previously found node.\n"
+    "  <timeout_ms> is upper limit, fastscan adapts to measured response time.\r\n";
 #endif
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_LEDS) != 0
@@ -218,19 +489,171 @@ static const char* CO_GTWA_LED_PRINTOUTS[CO_GTWA_LED_PRINTOUTS_SIZE] = {
     "                                   \r"};
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_LEDS */
 
-/* Get uint32 number from token, verify limits and set *err if necessary */
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+/* names of the values from CO_HBconsumer_netTable_t */
+static const char*
+nodesNMTstring(uint8_t NMTstate) {
+    switch (NMTstate) {
+        case (uint8_t)CO_NMT_INITIALIZING: return "INITIALIZING";
+        case (uint8_t)CO_NMT_PRE_OPERATIONAL: return "PRE-OPERATIONAL";
+        case (uint8_t)CO_NMT_OPERATIONAL: return "OPERATIONAL";
+        case (uint8_t)CO_NMT_STOPPED: return "STOPPED";
+        default: return "UNKNOWN";
+    }
+}
+
+static const char*
+nodesHBstring(uint8_t HBstate) {
+    static const char* names[] = {"UNCONFIGURED", "UNKNOWN", "ACTIVE", "TIMEOUT"};
+    return (HBstate < 4U) ? names[HBstate] : "?";
+}
+
+static const char*
+nodesEventString(uint8_t event) {
+    static const char* names[] = {"?", "NMT", "BOOTUP", "HB_STARTED", "TIMEOUT"};
+    return (event < 5U) ? names[event] : "?";
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_NODES */
+
+/* Get uint32 number from token of length len, verify limits and set *err if necessary. Token need not be null
+ * terminated, but it must not be followed by a digit or letter (see CO_fifo_readTokenSpan()). */
 static inline uint32_t
-getU32(char* token, uint32_t min, uint32_t max, bool_t* err) {
+getU32span(const char* token, size_t len, uint32_t min, uint32_t max, bool_t* err) {
     char* sRet;
     uint32_t num = strtoul(token, &sRet, 0);
 
-    if ((sRet != strchr(token, (int32_t)'\0')) || (num < min) || (num > max)) {
+    if ((sRet != &token[len]) || (num < min) || (num > max)) {
         *err = true;
     }
 
     return num;
 }
 
+/* Get uint32 number from null terminated token, verify limits and set *err if necessary */
+static inline uint32_t
+getU32(char* token, uint32_t min, uint32_t max, bool_t* err) {
+    return getU32span(token, strlen(token), min, max, err);
+}
+
+static inline uint8_t
+lowerChar(char c) {
+    uint8_t u = (uint8_t)c;
+    return ((u >= (uint8_t)'A') && (u <= (uint8_t)'Z')) ? (uint8_t)(u + ((uint8_t)'a' - (uint8_t)'A')) : u;
+}
+
+/* Hash of the command or data type name, case insensitive, len must not be zero. Multipliers are chosen so, that all
+ * names from commandNames[] and dataTypes[] have different hash in the 64 slots tables commandHash[] and
+ * dataTypesHash[], which are precomputed. If name is added, tables must be recalculated and remain collision free. */
+static inline uint8_t
+tokenHash(const char* token, size_t len) {
+    uint32_t h = (11U * lowerChar(token[0])) + (7U * lowerChar(token[len - 1U]))
+                 + (4U * lowerChar(token[(len > 4U) ? 4U : (len - 1U)])) + (12U * (uint32_t)len);
+    return (uint8_t)(h & 0x3FU);
+}
+
+/* Compare token of length len with lower case name, case insensitive */
+static bool_t
+tokenIs(const char* token, size_t len, const char* name) {
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        if (lowerChar(token[i]) != (uint8_t)name[i]) {
+            return false;
+        }
+    }
+    return name[len] == '\0';
+}
+
+/* Commands, see CO_GTWA_getCommand() */
+typedef enum {
+    CMD_UNKNOWN = 0,
+    CMD_SET,
+    CMD_READ,
+    CMD_WRITE,
+    CMD_MREAD,
+    CMD_MWRITE,
+    CMD_START,
+    CMD_STOP,
+    CMD_PREOP,
+    CMD_RESET,
+    CMD_LSS_SWITCH_GLOB,
+    CMD_LSS_SWITCH_SEL,
+    CMD_LSS_SET_NODE,
+    CMD_LSS_CONF_BITRATE,
+    CMD_LSS_ACTIVATE_BITRATE,
+    CMD_LSS_STORE,
+    CMD_LSS_INQUIRE_ADDR,
+    CMD_LSS_GET_NODE,
+    CMD__LSS_FASTSCAN,
+    CMD_LSS_ALLNODES,
+    CMD_LOG,
+    CMD_HELP,
+    CMD_LED,
+    CMD_SUB,
+    CMD_UNSUB,
+    CMD_NODES,
+    CMD_EMCY,
+    CMD_BULK
+} CO_GTWA_command_t;
+
+typedef struct {
+    const char* name;
+    CO_GTWA_command_t cmd;
+} commandName_t;
+
+/* All command names, also the ones, which are disabled by configuration */
+static const commandName_t commandNames[] = {{"set", CMD_SET},
+                                             {"r", CMD_READ},
+                                             {"read", CMD_READ},
+                                             {"w", CMD_WRITE},
+                                             {"write", CMD_WRITE},
+                                             {"mr", CMD_MREAD},
+                                             {"mread", CMD_MREAD},
+                                             {"mw", CMD_MWRITE},
+                                             {"mwrite", CMD_MWRITE},
+                                             {"start", CMD_START},
+                                             {"stop", CMD_STOP},
+                                             {"preop", CMD_PREOP},
+                                             {"preoperational", CMD_PREOP},
+                                             {"reset", CMD_RESET},
+                                             {"lss_switch_glob", CMD_LSS_SWITCH_GLOB},
+                                             {"lss_switch_sel", CMD_LSS_SWITCH_SEL},
+                                             {"lss_set_node", CMD_LSS_SET_NODE},
+                                             {"lss_conf_bitrate", CMD_LSS_CONF_BITRATE},
+                                             {"lss_activate_bitrate", CMD_LSS_ACTIVATE_BITRATE},
+                                             {"lss_store", CMD_LSS_STORE},
+                                             {"lss_inquire_addr", CMD_LSS_INQUIRE_ADDR},
+                                             {"lss_get_node", CMD_LSS_GET_NODE},
+                                             {"_lss_fastscan", CMD__LSS_FASTSCAN},
+                                             {"lss_allnodes", CMD_LSS_ALLNODES},
+                                             {"log", CMD_LOG},
+                                             {"help", CMD_HELP},
+                                             {"led", CMD_LED},
+                                             {"sub", CMD_SUB},
+                                             {"unsub", CMD_UNSUB},
+                                             {"nodes", CMD_NODES},
+                                             {"emcy", CMD_EMCY},
+                                             {"bulk", CMD_BULK}};
+
+/* tokenHash() -> index in commandNames[] + 1, 0 for empty slot */
+static const uint8_t commandHash[64] = {
+     0,  0,  0, 17,  0,  0,  4,  0,  0,  0,  9, 28, 16,  0,  0,  0,
+     0,  1, 15, 22, 27,  0,  0,  0,  2,  0,  0, 19, 12, 24, 14, 20,
+     0,  0,  3,  0,  8,  0, 21, 30,  0, 10,  0,  0, 13,  6,  0, 23,
+     5, 11,  0, 18,  0, 25,  0,  7, 26, 29, 31,  0,  0,  0,  0, 32};
+
+/* get command from token, case insensitive */
+static CO_GTWA_command_t
+CO_GTWA_getCommand(const char* token, size_t len) {
+    if (len > 0U) {
+        uint8_t i = commandHash[tokenHash(token, len)];
+        if ((i > 0U) && tokenIs(token, len, commandNames[i - 1U].name)) {
+            return commandNames[i - 1U].cmd;
+        }
+    }
+    return CMD_UNKNOWN;
+}
+
 /* Verify net and node, return true on error */
 static bool_t
 checkNetNode(CO_GTWA_t* gtwa, int32_t net, int16_t node, uint8_t NodeMin, CO_GTWA_respErrorCode_t* errCode) {
@@ -321,18 +744,20 @@ static const CO_GTWA_dataType_t dataTypes[] = {
     {(char*)"d", 0, CO_fifo_readB642a, CO_fifo_cpyTok2B64}    /* DOMAIN - base64 */
 };
 
-/* get data type from token */
-static const CO_GTWA_dataType_t*
-CO_GTWA_getDataType(char* token, bool_t* err) {
-    if ((token != NULL) && (*err == false)) {
-        uint32_t i;
-        uint32_t len = sizeof(dataTypes) / sizeof(CO_GTWA_dataType_t);
+/* tokenHash() -> index in dataTypes[] + 1, 0 for empty slot */
+static const uint8_t dataTypesHash[64] = {
+     0,  0,  0,  3,  1,  0, 16,  7, 14,  0,  0,  0,  0,  5, 18,  0,
+    19,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  0,  0, 12,  0,
+     0,  0,  0,  6, 20,  0,  0, 10, 11,  0,  0,  0,  0,  0,  0,  0,
+    15,  0, 13,  0,  0,  0,  0,  0,  2,  4,  0,  0,  0,  8,  0,  0};
 
-        for (i = 0; i < len; i++) {
-            const CO_GTWA_dataType_t* dt = &dataTypes[i];
-            if (strcmp(token, dt->syntax) == 0) {
-                return dt;
-            }
+/* get data type from token of length len, case insensitive */
+static const CO_GTWA_dataType_t*
+CO_GTWA_getDataType(const char* token, size_t len, bool_t* err) {
+    if ((token != NULL) && (len > 0U) && (*err == false)) {
+        uint8_t i = dataTypesHash[tokenHash(token, len)];
+        if ((i > 0U) && tokenIs(token, len, dataTypes[i - 1U].syntax)) {
+            return &dataTypes[i - 1U];
         }
     }
 
@@ -371,6 +796,182 @@ respBufTransfer(CO_GTWA_t* gtwa) {
     return connectionOK != 0U;
 }
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+/*******************************************************************************
+ * BINARY FRAMES
+ ******************************************************************************/
+/* Offsets inside binary frame header */
+#define BIN_MAGIC  0U
+#define BIN_OPCODE 1U
+#define BIN_SEQ    2U
+#define BIN_NET    4U
+#define BIN_NODE   5U
+#define BIN_INDEX  6U
+#define BIN_SUB    8U
+#define BIN_TYPE   9U /* status in response */
+#define BIN_LEN    10U
+
+/* Size of CiA 301 data types, indexed by data type code, 0 if not fixed */
+static const uint8_t binTypeSize[] = {0, 1, 1, 2, 4, 1, 2, 4, 4, 0, 0, 0, 6, 6, 0, 0, 3, 8, 5, 6, 7, 8, 3, 0, 5, 6, 7, 8};
+
+static inline size_t
+binGetTypeSize(uint8_t type) {
+    return (type < sizeof(binTypeSize)) ? binTypeSize[type] : 0U;
+}
+
+static inline size_t
+binSpace(CO_GTWA_t* gtwa) {
+    return CO_GTWA_RESP_BUF_SIZE - (gtwa->respBufOffset + gtwa->respBufCount);
+}
+
+/* Return true, if next command in commFifo is binary frame */
+static bool_t
+binFrameNext(CO_GTWA_t* gtwa) {
+    uint8_t magic = 0;
+
+    (void)CO_fifo_altBegin(&gtwa->commFifo, 0);
+    (void)CO_fifo_altRead(&gtwa->commFifo, &magic, 1);
+    return magic == CO_GTWA_BIN_MAGIC_REQ;
+}
+
+/* Return true, if binary frame in commFifo is ready to be processed. SDO download and batch frames are processed, when
+ * header is available, their payload is streamed. Other frames must be complete. */
+static bool_t
+binFrameReady(CO_GTWA_t* gtwa) {
+    uint8_t hdr[CO_GTWA_BIN_HEADER_SIZE];
+    size_t occupied = CO_fifo_getOccupied(&gtwa->commFifo);
+    size_t len;
+
+    if (occupied < CO_GTWA_BIN_HEADER_SIZE) {
+        return false;
+    }
+    (void)CO_fifo_altBegin(&gtwa->commFifo, 0);
+    (void)CO_fifo_altRead(&gtwa->commFifo, hdr, CO_GTWA_BIN_HEADER_SIZE);
+    if (hdr[BIN_MAGIC] != CO_GTWA_BIN_MAGIC_REQ) {
+        return false;
+    }
+    if ((hdr[BIN_OPCODE] == (uint8_t)CO_GTWA_BIN_OP_WRITE) || (hdr[BIN_OPCODE] == (uint8_t)CO_GTWA_BIN_OP_BATCH)) {
+        return true;
+    }
+    len = (size_t)hdr[BIN_LEN] | ((size_t)hdr[BIN_LEN + 1U] << 8);
+    /* too long payload will be rejected and skipped */
+    return (len > CO_GTWA_BIN_SHORT_PAYLOAD) || (occupied >= (CO_GTWA_BIN_HEADER_SIZE + len));
+}
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+/* Acquire SDO client from the pool, if binary frame in commFifo is SDO read or write. Return false, if frame must wait
+ * for free SDO client. Frame must be ready, see binFrameReady(). */
+static bool_t
+binSDOpoolAcquire(CO_GTWA_t* gtwa) {
+    uint8_t hdr[CO_GTWA_BIN_HEADER_SIZE];
+
+    (void)CO_fifo_altBegin(&gtwa->commFifo, 0);
+    (void)CO_fifo_altRead(&gtwa->commFifo, hdr, CO_GTWA_BIN_HEADER_SIZE);
+    if ((hdr[BIN_OPCODE] != (uint8_t)CO_GTWA_BIN_OP_READ) && (hdr[BIN_OPCODE] != (uint8_t)CO_GTWA_BIN_OP_WRITE)) {
+        return true;
+    }
+    return SDOpoolAcquire(gtwa);
+}
+#else
+#define binSDOpoolAcquire(gtwa) true
+#endif
+
+/* Read bytes of current frame from commFifo, account them also in the batch */
+static size_t
+binRead(CO_GTWA_t* gtwa, uint8_t* buf, size_t count) {
+    size_t n = CO_fifo_read(&gtwa->commFifo, buf, count, NULL);
+
+    gtwa->binBatchRemain = (n < gtwa->binBatchRemain) ? (gtwa->binBatchRemain - n) : 0U;
+    return n;
+}
+
+/* Discard remaining payload of current frame from commFifo. Return true, if all discarded. */
+static bool_t
+binSkip(CO_GTWA_t* gtwa) {
+    uint8_t buf[32];
+
+    while (gtwa->binRemain > 0U) {
+        size_t n = binRead(gtwa, buf, (gtwa->binRemain < sizeof(buf)) ? gtwa->binRemain : sizeof(buf));
+        if (n == 0U) {
+            break;
+        }
+        gtwa->binRemain -= n;
+    }
+    return gtwa->binRemain == 0U;
+}
+
+/* Append response frame header to respBuf and return pointer to its payload. Caller must verify space. */
+static uint8_t*
+binFrameBegin(CO_GTWA_t* gtwa, const uint8_t* reqHdr, uint8_t status, size_t len) {
+    uint8_t* frame = (uint8_t*)&gtwa->respBuf[gtwa->respBufOffset + gtwa->respBufCount];
+
+    (void)memcpy((void*)frame, (const void*)reqHdr, CO_GTWA_BIN_HEADER_SIZE);
+    frame[BIN_MAGIC] = CO_GTWA_BIN_MAGIC_RSP;
+    frame[BIN_TYPE] = status;
+    frame[BIN_LEN] = (uint8_t)len;
+    frame[BIN_LEN + 1U] = (uint8_t)(len >> 8);
+    gtwa->respBufCount += CO_GTWA_BIN_HEADER_SIZE + len;
+    return &frame[CO_GTWA_BIN_HEADER_SIZE];
+}
+
+/* Append response to the batch request, if all requests from the batch are finished */
+static void
+binBatchEnd(CO_GTWA_t* gtwa) {
+    if (gtwa->binBatchActive && (gtwa->binBatchRemain == 0U) && (gtwa->binRemain == 0U)) {
+        gtwa->binBatchActive = false;
+        if (binSpace(gtwa) < (CO_GTWA_BIN_HEADER_SIZE + 4U)) {
+            (void)respBufTransfer(gtwa);
+        }
+        if (binSpace(gtwa) >= (CO_GTWA_BIN_HEADER_SIZE + 4U)) {
+            uint8_t* payload = binFrameBegin(gtwa, gtwa->binBatchHdr, (uint8_t)CO_GTWA_BIN_ST_OK, 4U);
+            payload[0] = (uint8_t)gtwa->binBatchOk;
+            payload[1] = (uint8_t)(gtwa->binBatchOk >> 8);
+            payload[2] = (uint8_t)gtwa->binBatchErr;
+            payload[3] = (uint8_t)(gtwa->binBatchErr >> 8);
+        }
+        (void)respBufTransfer(gtwa);
+    }
+}
+
+/* Finish response frame. Responses inside batch are collected in respBuf, otherwise they are transferred immediately.
+ * Return false, if communication is broken. */
+static bool_t
+binFrameEnd(CO_GTWA_t* gtwa, uint8_t status) {
+    if (gtwa->binBatchActive && ((status & (uint8_t)CO_GTWA_BIN_ST_MORE) == 0U)) {
+        if (status == (uint8_t)CO_GTWA_BIN_ST_OK) {
+            gtwa->binBatchOk++;
+        } else {
+            gtwa->binBatchErr++;
+        }
+        binBatchEnd(gtwa);
+    }
+    if (!gtwa->binBatchActive || (binSpace(gtwa) < ((2U * CO_GTWA_BIN_HEADER_SIZE) + 8U))) {
+        return respBufTransfer(gtwa);
+    }
+    return true;
+}
+
+/* Response to the current binary request, payload is optional uint32 code */
+static void
+binResponse(CO_GTWA_t* gtwa, CO_GTWA_binStatus_t status, const uint32_t* code) {
+    size_t len = (code != NULL) ? 4U : 0U;
+
+    if (binSpace(gtwa) < (CO_GTWA_BIN_HEADER_SIZE + len)) {
+        (void)respBufTransfer(gtwa);
+    }
+    if (binSpace(gtwa) >= (CO_GTWA_BIN_HEADER_SIZE + len)) {
+        uint8_t* payload = binFrameBegin(gtwa, gtwa->binHdr, (uint8_t)status, len);
+        if (code != NULL) {
+            payload[0] = (uint8_t)*code;
+            payload[1] = (uint8_t)(*code >> 8);
+            payload[2] = (uint8_t)(*code >> 16);
+            payload[3] = (uint8_t)(*code >> 24);
+        }
+    }
+    (void)binFrameEnd(gtwa, (uint8_t)status);
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_BINARY */
+
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_ERROR_DESC) != 0
 #ifndef CO_CONFIG_GTW_ASCII_ERROR_DESC_STRINGS
 #define CO_CONFIG_GTW_ASCII_ERROR_DESC_STRINGS
@@ -450,6 +1051,13 @@ responseWithError(CO_GTWA_t* gtwa, CO_GTWA_respErrorCode_t respErrorCode) {
     uint32_t len = sizeof(errorDescs) / sizeof(errorDescs_t);
     const char* desc = "-";
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    if (gtwa->binary) {
+        uint32_t code = (uint32_t)respErrorCode;
+        binResponse(gtwa, CO_GTWA_BIN_ST_ERROR, &code);
+        return;
+    }
+#endif
     for (i = 0; i < len; i++) {
         const errorDescs_t* ed = &errorDescs[i];
         if ((CO_GTWA_respErrorCode_t)ed->code == respErrorCode) {
@@ -469,6 +1077,13 @@ responseWithErrorSDO(CO_GTWA_t* gtwa, CO_SDO_abortCode_t abortCode, bool_t postp
     uint32_t len = sizeof(errorDescsSDO) / sizeof(errorDescs_t);
     const char* desc = "-";
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    if (gtwa->binary) {
+        uint32_t code = (uint32_t)abortCode;
+        binResponse(gtwa, CO_GTWA_BIN_ST_ABORT, &code);
+        return;
+    }
+#endif
     for (i = 0; i < len; i++) {
         const errorDescs_t* ed = &errorDescsSDO[i];
         if ((CO_SDO_abortCode_t)ed->code == abortCode) {
@@ -492,6 +1107,13 @@ responseWithErrorSDO(CO_GTWA_t* gtwa, CO_SDO_abortCode_t abortCode, bool_t postp
 #else /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_ERROR_DESC */
 static inline void
 responseWithError(CO_GTWA_t* gtwa, CO_GTWA_respErrorCode_t respErrorCode) {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    if (gtwa->binary) {
+        uint32_t code = (uint32_t)respErrorCode;
+        binResponse(gtwa, CO_GTWA_BIN_ST_ERROR, &code);
+        return;
+    }
+#endif
     gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "] ERROR:%d\r\n",
                                           gtwa->sequence, respErrorCode);
     (void)respBufTransfer(gtwa);
@@ -500,6 +1122,13 @@ responseWithError(CO_GTWA_t* gtwa, CO_GTWA_respErrorCode_t respErrorCode) {
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
 static inline void
 responseWithErrorSDO(CO_GTWA_t* gtwa, CO_SDO_abortCode_t abortCode, bool_t postponed) {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    if (gtwa->binary) {
+        uint32_t code = (uint32_t)abortCode;
+        binResponse(gtwa, CO_GTWA_BIN_ST_ABORT, &code);
+        return;
+    }
+#endif
     if (!postponed) {
         gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "] ERROR:0x%08X\r\n",
                                               gtwa->sequence, abortCode);
@@ -507,58 +1136,502 @@ responseWithErrorSDO(CO_GTWA_t* gtwa, CO_SDO_abortCode_t abortCode, bool_t postp
         gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "\n...ERROR:0x%08X\r\n", abortCode);
     }
 
-    (void)respBufTransfer(gtwa);
-}
-#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
-#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_ERROR_DESC */
+    (void)respBufTransfer(gtwa);
+}
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_ERROR_DESC */
+
+static inline void
+responseWithOK(CO_GTWA_t* gtwa) {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    if (gtwa->binary) {
+        binResponse(gtwa, CO_GTWA_BIN_ST_OK, NULL);
+        return;
+    }
+#endif
+    gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "] OK\r\n",
+                                          (int32_t)gtwa->sequence);
+    (void)respBufTransfer(gtwa);
+}
+
+static inline void
+responseWithEmpty(CO_GTWA_t* gtwa) {
+    gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "\r\n");
+    (void)respBufTransfer(gtwa);
+}
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+static void
+responseLSS(CO_GTWA_t* gtwa, CO_LSSmaster_return_t lss_ret) {
+    if (lss_ret == CO_LSSmaster_OK) {
+        responseWithOK(gtwa);
+    } else {
+        CO_GTWA_respErrorCode_t respErrorCode;
+
+        if ((lss_ret == CO_LSSmaster_TIMEOUT) || (lss_ret == CO_LSSmaster_SCAN_NOACK)) {
+            respErrorCode = CO_GTWA_respErrorTimeOut;
+        } else if (lss_ret == CO_LSSmaster_OK_MANUFACTURER) {
+            respErrorCode = CO_GTWA_respErrorLSSmanufacturer;
+        } else {
+            respErrorCode = CO_GTWA_respErrorInternalState;
+        }
+        responseWithError(gtwa, respErrorCode);
+    }
+}
+#endif
+
+static inline void
+convertToLower(char* token, size_t maxCount) {
+    size_t i;
+    char* c = &token[0];
+
+    for (i = 0; i < maxCount; i++) {
+        if (*c == '\0') {
+            break;
+        } else {
+            *c = (char)tolower((int32_t)*c);
+        }
+        c++;
+    }
+}
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+/* Parse next '<index> <subindex> <datatype> [<value>]' of 'mread' or 'mwrite' command and initiate SDO transfer. Set
+ * SDOmultiLast, if command delimiter was reached. Return true on error. */
+static bool_t
+multiItemStart(CO_GTWA_t* gtwa, bool_t write) {
+    char tok[20];
+    const char* t;
+    size_t n;
+    uint8_t closed = 0U;
+    bool_t err = false;
+    uint16_t idx;
+    uint8_t subidx;
+
+    n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+    idx = (uint16_t)getU32span(t, n, 0, 0xFFFF, &err);
+    if (!err) {
+        n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+        subidx = (uint8_t)getU32span(t, n, 0, 0xFF, &err);
+    }
+    if (!err) {
+        closed = write ? 0U : 0xFFU;
+        n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+        gtwa->SDOdataType = CO_GTWA_getDataType(t, n, &err);
+    }
+
+    if (err) {
+        /* token closed with command delimiter is also error here */
+    } else if (write) {
+        uint8_t status;
+        size_t size;
+
+        if (CO_SDOclientDownloadInitiate(gtwa->SDO_C, idx, subidx, gtwa->SDOdataType->length, gtwa->SDOtimeoutTime,
+                                         gtwa->SDOblockTransferEnable)
+            != CO_SDO_RT_ok_communicationEnd) {
+            err = true;
+        } else {
+            /* value must fit into SDO buffer */
+            size = gtwa->SDOdataType->dataTypeScan(&gtwa->SDO_C->bufFifo, &gtwa->commFifo, &status);
+            closed = ((status & CO_fifo_st_closed) == 0U) ? 0U : 1U;
+            if (((status & (CO_fifo_st_errMask | CO_fifo_st_partial)) != 0U) || (size == 0U)) {
+                err = true;
+            } else if (gtwa->SDOdataType->length == 0U) {
+                CO_SDOclientDownloadInitSize(gtwa->SDO_C, size);
+            } else { /* MISRA C 2004 14.10 */
+            }
+        }
+    } else {
+        if (CO_SDOclientUploadInitiate(gtwa->SDO_C, idx, subidx, gtwa->SDOtimeoutTime, gtwa->SDOblockTransferEnable)
+            != CO_SDO_RT_ok_communicationEnd) {
+            err = true;
+        }
+    }
+
+    gtwa->SDOmultiLast = closed == 1U;
+    return err;
+}
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+/* Parse '<node>[-<node>]' token of 'bulk' command, set *err if necessary. Return number of nodes. */
+static uint8_t
+getNodeRange(const char* token, size_t len, uint8_t* nodeFirst, bool_t* err) {
+    size_t i = 0;
+    uint32_t first;
+    uint32_t last;
+
+    while ((i < len) && (token[i] != '-')) {
+        i++;
+    }
+    first = getU32span(token, i, 1, 127, err);
+    last = (i < len) ? getU32span(&token[i + 1U], len - i - 1U, first, 127, err) : first;
+    if ((i == 0U) || (i == (len - 1U))) {
+        *err = true;
+    }
+    if (*err) {
+        return 0;
+    }
+    *nodeFirst = (uint8_t)first;
+    return (uint8_t)(last - first + 1U);
+}
+#endif
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+/* Copy payload of SDO download frame from commFifo to SDO buffer, as much as possible */
+static void
+binDownloadCopy(CO_GTWA_t* gtwa) {
+    uint8_t buf[32];
+
+    while (gtwa->binRemain > 0U) {
+        size_t n = CO_fifo_getSpace(&gtwa->SDO_C->bufFifo);
+        if (n > gtwa->binRemain) {
+            n = gtwa->binRemain;
+        }
+        if (n > sizeof(buf)) {
+            n = sizeof(buf);
+        }
+        n = binRead(gtwa, buf, n);
+        if (n == 0U) {
+            break;
+        }
+        (void)CO_SDOclientDownloadBufWrite(gtwa->SDO_C, buf, n);
+        gtwa->binRemain -= n;
+    }
+    gtwa->SDOdataCopyStatus = gtwa->binRemain > 0U;
+}
+
+/* Copy uploaded data from SDO buffer into response frames. Data, which does not fit into one frame, are split into
+ * multiple frames, all except last with CO_GTWA_BIN_ST_MORE flag. */
+static void
+binUploadResponse(CO_GTWA_t* gtwa, CO_SDO_return_t ret, size_t sizeTransferred) {
+    CO_fifo_t* bufFifo = &gtwa->SDO_C->bufFifo;
+    bool_t end = ret == CO_SDO_RT_ok_communicationEnd;
+    size_t typeSize = binGetTypeSize(gtwa->binHdr[BIN_TYPE]);
+
+    if (end && !gtwa->SDOdataCopyStatus && (typeSize != 0U) && (sizeTransferred != typeSize)) {
+        (void)CO_fifo_purge(bufFifo);
+        responseWithErrorSDO(gtwa, CO_SDO_AB_TYPE_MISMATCH, false);
+        gtwa->state = CO_GTWA_ST_IDLE;
+        return;
+    }
+
+    do {
+        size_t occupied = CO_fifo_getOccupied(bufFifo);
+        size_t len;
+        uint8_t status;
+
+        if (binSpace(gtwa) <= CO_GTWA_BIN_HEADER_SIZE) {
+            (void)respBufTransfer(gtwa);
+            if (binSpace(gtwa) <= CO_GTWA_BIN_HEADER_SIZE) {
+                break;
+            }
+        }
+        len = binSpace(gtwa) - CO_GTWA_BIN_HEADER_SIZE;
+        if (len > occupied) {
+            len = occupied;
+        }
+        if (!end && (len == 0U)) {
+            break;
+        }
+        status = (end && (len == occupied)) ? (uint8_t)CO_GTWA_BIN_ST_OK : (uint8_t)CO_GTWA_BIN_ST_MORE;
+
+        (void)CO_fifo_read(bufFifo, binFrameBegin(gtwa, gtwa->binHdr, status, len), len, NULL);
+        gtwa->SDOdataCopyStatus = true;
+        if (status == (uint8_t)CO_GTWA_BIN_ST_OK) {
+            gtwa->state = CO_GTWA_ST_IDLE;
+        }
+
+        if (binFrameEnd(gtwa, status) == false) {
+            /* broken communication, send SDO abort and force finish. */
+            CO_SDO_abortCode_t abortCode = CO_SDO_AB_DATA_TRANSF;
+            (void)CO_SDOclientUpload(gtwa->SDO_C, 0, true, &abortCode, NULL, NULL, NULL);
+            gtwa->state = CO_GTWA_ST_IDLE;
+            break;
+        }
+    } while ((gtwa->state == CO_GTWA_ST_BIN_READ) && (gtwa->respHold == false));
+}
+
+/* Read binary frame from commFifo and start it */
+static void
+binCommand(CO_GTWA_t* gtwa) {
+    uint8_t* hdr = &gtwa->binHdr[0];
+    uint8_t payload[CO_GTWA_BIN_SHORT_PAYLOAD];
+    CO_GTWA_respErrorCode_t respErrorCode = CO_GTWA_respErrorNone;
+    bool_t err = false;
+    CO_SDO_return_t SDO_ret;
+    size_t len;
+    uint16_t idx;
+    int32_t net;
+    int16_t node;
+
+    (void)binRead(gtwa, hdr, CO_GTWA_BIN_HEADER_SIZE);
+    gtwa->binary = true;
+    len = (size_t)hdr[BIN_LEN] | ((size_t)hdr[BIN_LEN + 1U] << 8);
+    gtwa->binRemain = len;
+    gtwa->sequence = (uint32_t)hdr[BIN_SEQ] | ((uint32_t)hdr[BIN_SEQ + 1U] << 8);
+    net = (hdr[BIN_NET] != 0U) ? (int32_t)hdr[BIN_NET] : gtwa->net_default;
+    node = (hdr[BIN_NODE] != 0U) ? (int16_t)hdr[BIN_NODE] : gtwa->node_default;
+    idx = (uint16_t)hdr[BIN_INDEX] | (uint16_t)((uint16_t)hdr[BIN_INDEX + 1U] << 8);
+
+    /* short payload is already in commFifo, see binFrameReady() */
+    if ((hdr[BIN_OPCODE] != (uint8_t)CO_GTWA_BIN_OP_WRITE) && (hdr[BIN_OPCODE] != (uint8_t)CO_GTWA_BIN_OP_BATCH)
+        && (len <= CO_GTWA_BIN_SHORT_PAYLOAD)) {
+        gtwa->binRemain -= binRead(gtwa, payload, len);
+    }
+
+    switch (hdr[BIN_OPCODE]) {
+        case CO_GTWA_BIN_OP_READ: {
+            if ((len != 0U) || checkNetNode(gtwa, net, node, 1, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            SDO_ret = CO_SDOclient_setup(gtwa->SDO_C, (uint32_t)CO_CAN_ID_SDO_CLI + gtwa->node,
+                                         (uint32_t)CO_CAN_ID_SDO_SRV + gtwa->node, gtwa->node);
+            if (SDO_ret == CO_SDO_RT_ok_communicationEnd) {
+                SDO_ret = CO_SDOclientUploadInitiate(gtwa->SDO_C, idx, hdr[BIN_SUB], gtwa->SDOtimeoutTime,
+                                                     gtwa->SDOblockTransferEnable);
+            }
+            if (SDO_ret != CO_SDO_RT_ok_communicationEnd) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+            gtwa->SDOdataCopyStatus = false;
+            gtwa->state = CO_GTWA_ST_BIN_READ;
+            break;
+        }
+
+        case CO_GTWA_BIN_OP_WRITE: {
+            size_t typeSize = binGetTypeSize(hdr[BIN_TYPE]);
+
+            if ((len == 0U) || checkNetNode(gtwa, net, node, 1, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            if ((typeSize != 0U) && (typeSize != len)) {
+                responseWithErrorSDO(gtwa, CO_SDO_AB_TYPE_MISMATCH, false);
+                gtwa->state = CO_GTWA_ST_BIN_SKIP;
+                break;
+            }
+            SDO_ret = CO_SDOclient_setup(gtwa->SDO_C, (uint32_t)CO_CAN_ID_SDO_CLI + gtwa->node,
+                                         (uint32_t)CO_CAN_ID_SDO_SRV + gtwa->node, gtwa->node);
+            if (SDO_ret == CO_SDO_RT_ok_communicationEnd) {
+                SDO_ret = CO_SDOclientDownloadInitiate(gtwa->SDO_C, idx, hdr[BIN_SUB], gtwa->binRemain,
+                                                       gtwa->SDOtimeoutTime, gtwa->SDOblockTransferEnable);
+            }
+            if (SDO_ret != CO_SDO_RT_ok_communicationEnd) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+            binDownloadCopy(gtwa);
+            gtwa->stateTimeoutTmr = 0;
+            gtwa->state = CO_GTWA_ST_BIN_WRITE;
+            break;
+        }
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NMT) != 0
+        case CO_GTWA_BIN_OP_NMT: {
+            /* node 0 means all nodes here */
+            node = (int16_t)hdr[BIN_NODE];
+            if ((len != 1U) || checkNetNode(gtwa, net, node, 0, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            if ((payload[0] != (uint8_t)CO_NMT_ENTER_OPERATIONAL) && (payload[0] != (uint8_t)CO_NMT_ENTER_STOPPED)
+                && (payload[0] != (uint8_t)CO_NMT_ENTER_PRE_OPERATIONAL) && (payload[0] != (uint8_t)CO_NMT_RESET_NODE)
+                && (payload[0] != (uint8_t)CO_NMT_RESET_COMMUNICATION)) {
+                err = true;
+                break;
+            }
+            if (CO_NMT_sendCommand(gtwa->NMT, (CO_NMT_command_t)payload[0], gtwa->node) != CO_ERROR_NO) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+            responseWithOK(gtwa);
+            break;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_NMT */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+        case CO_GTWA_BIN_OP_LSS_SWITCH_GLOB: {
+            if ((len != 1U) || (payload[0] > 1U) || checkNet(gtwa, net, &respErrorCode)
+                || LSSacquire(gtwa, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            if (payload[0] == 1U) {
+                gtwa->state = CO_GTWA_ST_LSS_SWITCH_GLOB;
+            } else if (CO_LSSmaster_swStateDeselect(gtwa->LSSmaster) == CO_LSSmaster_OK) {
+                responseWithOK(gtwa);
+            } else {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+            }
+            break;
+        }
+
+        case CO_GTWA_BIN_OP_LSS_SET_NODE: {
+            if ((len != 1U) || ((payload[0] > 0x7FU) && (payload[0] < 0xFFU)) || checkNet(gtwa, net, &respErrorCode)
+                || LSSacquire(gtwa, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            gtwa->lssNID = payload[0];
+            gtwa->state = CO_GTWA_ST_LSS_SET_NODE;
+            break;
+        }
+
+        case CO_GTWA_BIN_OP_LSS_STORE: {
+            if ((len != 0U) || checkNet(gtwa, net, &respErrorCode) || LSSacquire(gtwa, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            gtwa->state = CO_GTWA_ST_LSS_STORE;
+            break;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LSS */
+
+        case CO_GTWA_BIN_OP_BATCH: {
+            /* batches can not be nested */
+            if (gtwa->binBatchActive) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+            (void)memcpy((void*)gtwa->binBatchHdr, (const void*)hdr, CO_GTWA_BIN_HEADER_SIZE);
+            gtwa->binBatchActive = true;
+            gtwa->binBatchRemain = gtwa->binRemain;
+            gtwa->binRemain = 0;
+            gtwa->binBatchOk = 0;
+            gtwa->binBatchErr = 0;
+            /* empty batch */
+            binBatchEnd(gtwa);
+            break;
+        }
+
+        default: {
+            respErrorCode = CO_GTWA_respErrorReqNotSupported;
+            err = true;
+            break;
+        }
+    }
 
-static inline void
-responseWithOK(CO_GTWA_t* gtwa) {
-    gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "] OK\r\n",
-                                          (int32_t)gtwa->sequence);
-    (void)respBufTransfer(gtwa);
+    if (err) {
+        if (respErrorCode == CO_GTWA_respErrorNone) {
+            respErrorCode = CO_GTWA_respErrorSyntax;
+        }
+        responseWithError(gtwa, respErrorCode);
+        gtwa->state = CO_GTWA_ST_BIN_SKIP;
+    }
+    /* frame, which was not accepted, may have some payload left in commFifo */
+    if ((gtwa->state == CO_GTWA_ST_BIN_SKIP) && binSkip(gtwa)) {
+        gtwa->state = CO_GTWA_ST_IDLE;
+        binBatchEnd(gtwa);
+    }
 }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_BINARY */
 
-static inline void
-responseWithEmpty(CO_GTWA_t* gtwa) {
-    gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "\r\n");
-    (void)respBufTransfer(gtwa);
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+/* Print notification '"@"<id> <timestamp_ms> <value> ...' of the subscription into respBuf */
+static void
+subPrint(CO_GTWA_t* gtwa, uint8_t id) {
+    const CO_GTWA_sub_t* sub = &gtwa->sub[id];
+    size_t offset = 0;
+    size_t count = (size_t)sprintf(gtwa->respBuf, "@%" PRIu8 " %" PRIu64 ".%03" PRIu32, id, sub->timestamp_us / 1000U,
+                                   (uint32_t)(sub->timestamp_us % 1000U));
+
+    for (uint8_t i = 0; i < sub->dataTypeCount; i++) {
+        const CO_GTWA_dataType_t* dt = sub->dataType[i];
+        size_t len = (dt->length == 0U) ? ((size_t)sub->valueLength - offset) : dt->length;
+        uint8_t buf[CO_GTWA_SUB_DATA_SIZE + 1U];
+        CO_fifo_t fifo;
+
+        /* Each value is printed from own fifo, because dataTypePrint functions print all data in the fifo. */
+        CO_fifo_init(&fifo, buf, sizeof(buf));
+        CO_fifo_reset(&fifo);
+        (void)CO_fifo_write(&fifo, &sub->value[offset], len, NULL);
+        gtwa->respBuf[count] = ' ';
+        count++;
+        count += dt->dataTypePrint(&fifo, &gtwa->respBuf[count], (CO_GTWA_RESP_BUF_SIZE - 2U) - count, true);
+        offset += len;
+    }
+    count += (size_t)sprintf(&gtwa->respBuf[count], "\r\n");
+    gtwa->respBufCount = count;
 }
 
-#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+/* Get new values of the subscriptions. Print notifications, if their interval has expired and response stream is not
+ * used by the command. */
 static void
-responseLSS(CO_GTWA_t* gtwa, CO_LSSmaster_return_t lss_ret) {
-    if (lss_ret == CO_LSSmaster_OK) {
-        responseWithOK(gtwa);
-    } else {
-        CO_GTWA_respErrorCode_t respErrorCode;
+subProcess(CO_GTWA_t* gtwa, uint32_t* timerNext_us) {
+    bool_t output = (gtwa->state == CO_GTWA_ST_IDLE) && !gtwa->respHold;
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    output = output && !gtwa->binBatchActive;
+#endif
 
-        if ((lss_ret == CO_LSSmaster_TIMEOUT) || (lss_ret == CO_LSSmaster_SCAN_NOACK)) {
-            respErrorCode = CO_GTWA_respErrorTimeOut;
-        } else if (lss_ret == CO_LSSmaster_OK_MANUFACTURER) {
-            respErrorCode = CO_GTWA_respErrorLSSmanufacturer;
-        } else {
-            respErrorCode = CO_GTWA_respErrorInternalState;
+    for (uint8_t i = 0; i < CO_CONFIG_GTWA_SUBSCRIPTIONS; i++) {
+        CO_GTWA_sub_t* sub = &gtwa->sub[i];
+        uint64_t elapsed = gtwa->subTime_us - sub->lastTime_us;
+        bool_t due = elapsed >= sub->interval_us;
+
+        if (sub->type == CO_GTWA_SUB_PDO) {
+            /* Clear the flag. If between the copy operation CANrxNew is set by receive thread, then copy the latest
+             * data again. */
+            while (CO_FLAG_READ(sub->CANrxNew)) {
+                CO_FLAG_CLEAR(sub->CANrxNew);
+                sub->valueLength = sub->CANrxDLC;
+                (void)memcpy(sub->value, sub->CANrxData, CO_GTWA_SUB_DATA_SIZE);
+                sub->timestamp_us = gtwa->subTime_us;
+                sub->pending = true;
+            }
+        } else if ((sub->type == CO_GTWA_SUB_OD) && due) {
+            uint8_t buf[CO_GTWA_SUB_DATA_SIZE];
+            OD_size_t countRd = 0;
+            ODR_t odRet;
+
+            sub->OD_IO.stream.dataOffset = 0;
+            CO_LOCK_OD(gtwa->CANdevRx);
+            odRet = sub->OD_IO.read(&sub->OD_IO.stream, buf, sizeof(buf), &countRd);
+            CO_UNLOCK_OD(gtwa->CANdevRx);
+
+            if ((odRet == ODR_OK) && ((countRd != sub->valueLength) || (memcmp(buf, sub->value, countRd) != 0))) {
+                (void)memcpy(sub->value, buf, countRd);
+                sub->valueLength = (uint8_t)countRd;
+                sub->timestamp_us = gtwa->subTime_us;
+                sub->pending = true;
+            }
+        } else { /* MISRA C 2004 14.10 */
         }
-        responseWithError(gtwa, respErrorCode);
-    }
-}
-#endif
 
-static inline void
-convertToLower(char* token, size_t maxCount) {
-    size_t i;
-    char* c = &token[0];
+        /* Print the latest value, older values were overwritten */
+        if (sub->pending && due && output) {
+            subPrint(gtwa, i);
+            sub->pending = false;
+            sub->lastTime_us = gtwa->subTime_us;
+            elapsed = 0;
+            due = sub->interval_us == 0U;
+            (void)respBufTransfer(gtwa);
+            output = !gtwa->respHold;
+        }
 
-    for (i = 0; i < maxCount; i++) {
-        if (*c == '\0') {
-            break;
-        } else {
-            *c = (char)tolower((int32_t)*c);
+        /* Calculate, when the next notification or OD sample is due */
+        if ((timerNext_us != NULL) && (sub->interval_us > 0U)) {
+            uint32_t diff = 0xFFFFFFFFU;
+            if (!due && (sub->pending || (sub->type == CO_GTWA_SUB_OD))) {
+                diff = sub->interval_us - (uint32_t)elapsed;
+            } else if (sub->type == CO_GTWA_SUB_OD) {
+                diff = sub->interval_us;
+            } else { /* MISRA C 2004 14.10 */
+            }
+            if (*timerNext_us > diff) {
+                *timerNext_us = diff;
+            }
         }
-        c++;
     }
 }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SUBSCRIBE */
 
 /*******************************************************************************
  * PROCESS FUNCTION
@@ -576,11 +1649,41 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
     }
 
     if (!enable) {
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0)
+        /* nobody will read the results of 'bulk' command, abort it */
+        if (gtwa->state == CO_GTWA_ST_BULK) {
+            CO_SDObulk_abort(gtwa->SDObulk->bulk, CO_SDO_AB_GENERAL);
+            gtwa->SDObulk->owner = NULL;
+        }
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+        SDOabortActive(gtwa);
+#endif
         gtwa->state = CO_GTWA_ST_IDLE;
         CO_fifo_reset(&gtwa->commFifo);
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+        SDOpoolRelease(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+        LSSreleaseIfUnused(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+        gtwa->binRemain = 0;
+        gtwa->binBatchActive = false;
+        gtwa->binBatchRemain = 0;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+        for (uint8_t i = 0; i < CO_CONFIG_GTWA_SUBSCRIPTIONS; i++) {
+            subCancel(gtwa, i);
+        }
+#endif
         return;
     }
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+    gtwa->subTime_us += timeDifference_us;
+#endif
+
     /* If there is some more output data for application, read them first. Hold on this state, if necessary. */
     if (gtwa->respHold) {
         timeDifference_us += gtwa->timeDifference_us_cumulative;
@@ -588,6 +1691,12 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         (void)respBufTransfer(gtwa);
         if (gtwa->respHold) {
             gtwa->timeDifference_us_cumulative = timeDifference_us;
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+            SDOpoolReleaseIfUnused(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+            LSSreleaseIfUnused(gtwa);
+#endif
             return;
         } else {
             gtwa->timeDifference_us_cumulative = 0;
@@ -597,18 +1706,38 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
     /***************************************************************************
      * COMMAND PARSER
      ***************************************************************************/
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+    /* binary frames, stop if response can not be transferred */
+    while ((gtwa->state == CO_GTWA_ST_IDLE) && !gtwa->respHold && binFrameReady(gtwa) && binSDOpoolAcquire(gtwa)) {
+        binCommand(gtwa);
+        timeDifference_us = 0;
+    }
+#endif
+
     /* if idle, search for new command, skip comments or empty lines */
-    while (CO_fifo_CommSearch(&gtwa->commFifo, false) && (gtwa->state == CO_GTWA_ST_IDLE)) {
+    while (
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+        !binFrameNext(gtwa) &&
+#endif
+        CO_fifo_CommSearch(&gtwa->commFifo, false) && (gtwa->state == CO_GTWA_ST_IDLE)) {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+        size_t cmdReadPtr = gtwa->commFifo.readPtr;
+#endif
         char tok[20];
+        const char* t;
         size_t n;
         uint32_t ui[3];
         int32_t i;
         int32_t net = gtwa->net_default;
         int16_t node = gtwa->node_default;
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+        gtwa->binary = false;
+#endif
+
         /* parse mandatory token '"["<sequence>"]"' */
         closed = 0xFFU;
-        n = CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+        n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
         /* Break if error in token or token was found, but closed with command delimiter. */
         if (err || ((n > 0U) && (closed != 0U))) {
             err = true;
@@ -621,16 +1750,11 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         } else { /* MISRA C 2004 14.10 */
         }
 
-        if (tok[0] != '[') {
-            err = true;
-            break;
-        }
-        if (tok[strlen(tok) - 1U] != ']') {
+        if ((t[0] != '[') || (t[n - 1U] != ']')) {
             err = true;
             break;
         }
-        tok[strlen(tok) - 1U] = '\0';
-        gtwa->sequence = getU32(tok + 1, 0, 0xFFFFFFFFU, &err);
+        gtwa->sequence = getU32span(&t[1], n - 2U, 0, 0xFFFFFFFFU, &err);
         if (err) {
             break;
         }
@@ -639,12 +1763,12 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
          * follows mandatory token <command>, which is not numerical. */
         for (i = 0; i < 3; i++) {
             closed = 0xFFU;
-            n = CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
             if (err || (n == 0U)) {
                 /* empty token, break on error */
                 err = true;
                 break;
-            } else if ((int32_t)isdigit((int)tok[0]) == 0) {
+            } else if ((int32_t)isdigit((int)t[0]) == 0) {
                 /* <command> found */
                 break;
             } else if (closed != 0U) {
@@ -654,7 +1778,7 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             } else { /* MISRA C 2004 14.10 */
             }
 
-            ui[i] = getU32(tok, 0, 0xFFFFFFFFU, &err);
+            ui[i] = getU32span(t, n, 0, 0xFFFFFFFFU, &err);
             if (err) {
                 break;
             }
@@ -695,42 +1819,71 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         }
 
         /* command is case insensitive */
-        convertToLower(tok, sizeof(tok));
+        CO_GTWA_command_t cmd = CO_GTWA_getCommand(t, n);
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+        /* Only SDO commands need SDO client from the pool. If all are busy, leave the command in commFifo, it will be
+         * parsed again, when other session releases SDO client. */
+        if (((cmd == CMD_READ) || (cmd == CMD_WRITE) || (cmd == CMD_MREAD) || (cmd == CMD_MWRITE))
+            && !SDOpoolAcquire(gtwa)) {
+            gtwa->commFifo.readPtr = cmdReadPtr;
+            break;
+        }
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+        /* LSS master is shared, only one session may run LSS commands at a time */
+        if ((cmd >= CMD_LSS_SWITCH_GLOB) && (cmd <= CMD_LSS_ALLNODES) && LSSacquire(gtwa, &respErrorCode)) {
+            err = true;
+            break;
+        }
+#endif
 
-        bool_t tok_is_set = strcmp(tok, "set") == 0;
+        bool_t tok_is_set = cmd == CMD_SET;
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
-        bool_t tok_is_read = strcmp(tok, "r") == 0;
-        tok_is_read = (strcmp(tok, "read") == 0) || tok_is_read;
-        bool_t tok_is_write = strcmp(tok, "w") == 0;
-        tok_is_write = (strcmp(tok, "write") == 0) || tok_is_write;
+        bool_t tok_is_read = cmd == CMD_READ;
+        bool_t tok_is_write = cmd == CMD_WRITE;
+        bool_t tok_is_mread = cmd == CMD_MREAD;
+        bool_t tok_is_mwrite = cmd == CMD_MWRITE;
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0)
+        bool_t tok_is_bulk = cmd == CMD_BULK;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NMT) != 0
-        bool_t tok_is_start = strcmp(tok, "start") == 0;
-        bool_t tok_is_stop = strcmp(tok, "stop") == 0;
-        bool_t tok_is_preop = strcmp(tok, "preop") == 0;
-        tok_is_preop = (strcmp(tok, "preoperational") == 0) || tok_is_preop;
-        bool_t tok_is_reset = strcmp(tok, "reset") == 0;
+        bool_t tok_is_start = cmd == CMD_START;
+        bool_t tok_is_stop = cmd == CMD_STOP;
+        bool_t tok_is_preop = cmd == CMD_PREOP;
+        bool_t tok_is_reset = cmd == CMD_RESET;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
-        bool_t tok_is_lss_switch_glob = strcmp(tok, "lss_switch_glob") == 0;
-        bool_t tok_is_lss_switch_sel = strcmp(tok, "lss_switch_sel") == 0;
-        bool_t tok_is_lss_set_node = strcmp(tok, "lss_set_node") == 0;
-        bool_t tok_is_lss_conf_bitrate = strcmp(tok, "lss_conf_bitrate") == 0;
-        bool_t tok_is_lss_activate_bitrate = strcmp(tok, "lss_activate_bitrate") == 0;
-        bool_t tok_is_lss_store = strcmp(tok, "lss_store") == 0;
-        bool_t tok_is_lss_inquire_addr = strcmp(tok, "lss_inquire_addr") == 0;
-        bool_t tok_is_lss_get_node = strcmp(tok, "lss_get_node") == 0;
-        bool_t tok_is__lss_fastscan = strcmp(tok, "_lss_fastscan") == 0;
-        bool_t tok_is_lss_allnodes = strcmp(tok, "lss_allnodes") == 0;
+        bool_t tok_is_lss_switch_glob = cmd == CMD_LSS_SWITCH_GLOB;
+        bool_t tok_is_lss_switch_sel = cmd == CMD_LSS_SWITCH_SEL;
+        bool_t tok_is_lss_set_node = cmd == CMD_LSS_SET_NODE;
+        bool_t tok_is_lss_conf_bitrate = cmd == CMD_LSS_CONF_BITRATE;
+        bool_t tok_is_lss_activate_bitrate = cmd == CMD_LSS_ACTIVATE_BITRATE;
+        bool_t tok_is_lss_store = cmd == CMD_LSS_STORE;
+        bool_t tok_is_lss_inquire_addr = cmd == CMD_LSS_INQUIRE_ADDR;
+        bool_t tok_is_lss_get_node = cmd == CMD_LSS_GET_NODE;
+        bool_t tok_is__lss_fastscan = cmd == CMD__LSS_FASTSCAN;
+        bool_t tok_is_lss_allnodes = cmd == CMD_LSS_ALLNODES;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LOG) != 0
-        bool_t tok_is_log = strcmp(tok, "log") == 0;
+        bool_t tok_is_log = cmd == CMD_LOG;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_HELP) != 0
-        bool_t tok_is_help = strcmp(tok, "help") == 0;
+        bool_t tok_is_help = cmd == CMD_HELP;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_PRINT_LEDS) != 0
-        bool_t tok_is_led = strcmp(tok, "led") == 0;
+        bool_t tok_is_led = cmd == CMD_LED;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+        bool_t tok_is_sub = cmd == CMD_SUB;
+        bool_t tok_is_unsub = cmd == CMD_UNSUB;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+        bool_t tok_is_nodes = cmd == CMD_NODES;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+        bool_t tok_is_emcy = cmd == CMD_EMCY;
 #endif
         /* set command - multiple sub commands */
         if (tok_is_set) {
@@ -854,16 +2007,16 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
 
             /* index */
             closed = 0U;
-            (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-            idx = (uint16_t)getU32(tok, 0, 0xFFFF, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            idx = (uint16_t)getU32span(t, n, 0, 0xFFFF, &err);
             if (err) {
                 break;
             }
 
             /* subindex */
             closed = 0xFFU;
-            n = CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-            subidx = (uint8_t)getU32(tok, 0, 0xFF, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            subidx = (uint8_t)getU32span(t, n, 0, 0xFF, &err);
             if (err || (n == 0U)) {
                 err = true;
                 break;
@@ -872,9 +2025,8 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             /* optional data type */
             if (closed == 0U) {
                 closed = 1U;
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                convertToLower(tok, sizeof(tok));
-                gtwa->SDOdataType = CO_GTWA_getDataType(tok, &err);
+                n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+                gtwa->SDOdataType = CO_GTWA_getDataType(t, n, &err);
                 if (err) {
                     break;
                 }
@@ -923,25 +2075,24 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
 
             /* index */
             closed = 0U;
-            (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-            idx = (uint16_t)getU32(tok, 0, 0xFFFF, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            idx = (uint16_t)getU32span(t, n, 0, 0xFFFF, &err);
             if (err) {
                 break;
             }
 
             /* subindex */
             closed = 0U;
-            n = CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-            subidx = (uint8_t)getU32(tok, 0, 0xFF, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            subidx = (uint8_t)getU32span(t, n, 0, 0xFF, &err);
             if (err) {
                 break;
             }
 
             /* data type */
             closed = 0U;
-            (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-            convertToLower(tok, sizeof(tok));
-            gtwa->SDOdataType = CO_GTWA_getDataType(tok, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            gtwa->SDOdataType = CO_GTWA_getDataType(t, n, &err);
             if (err) {
                 break;
             }
@@ -989,6 +2140,137 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             timeDifference_us = 0;
             gtwa->state = CO_GTWA_ST_WRITE;
         }
+
+        /* Multiple SDO uploads or downloads from the same node -
+         * 'mr[ead] <index> <subindex> <datatype> ...' or 'mw[rite] <index> <subindex> <datatype> <value> ...' */
+        else if (tok_is_mread || tok_is_mwrite) {
+            CO_SDO_return_t SDO_ret;
+            bool_t NodeErr = checkNetNode(gtwa, net, node, 1, &respErrorCode);
+
+            if ((closed != 0U) || NodeErr) {
+                err = true;
+                break;
+            }
+
+            /* setup client, objects from own node are accessed locally */
+            SDO_ret = CO_SDOclient_setup(gtwa->SDO_C, (uint32_t)CO_CAN_ID_SDO_CLI + gtwa->node,
+                                         (uint32_t)CO_CAN_ID_SDO_SRV + gtwa->node, gtwa->node);
+            if (SDO_ret != CO_SDO_RT_ok_communicationEnd) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+
+            /* response head, objects are parsed and transferred in state machine */
+            gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "]",
+                                                  (int32_t)gtwa->sequence);
+            gtwa->SDOmultiActive = false;
+            gtwa->SDOmultiLast = false;
+            timeDifference_us = 0;
+            gtwa->state = tok_is_mread ? CO_GTWA_ST_MREAD : CO_GTWA_ST_MWRITE;
+        }
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+        /* SDO upload or download of the same object on range of nodes over SDO bulk engine -
+         * 'bulk r[ead] <node>[-<node>] <index> <subindex> <datatype>' or
+         * 'bulk w[rite] <node>[-<node>] <index> <subindex> <datatype> <value>' */
+        else if (tok_is_bulk) {
+            CO_GTWA_SDObulk_t* SDObulk = gtwa->SDObulk;
+            CO_GTWA_command_t rw;
+            uint8_t nodeFirst = 0;
+            uint8_t nodeCount;
+            uint16_t idx;
+            uint8_t subidx;
+
+            if ((closed != 0U) || checkNet(gtwa, net, &respErrorCode)) {
+                err = true;
+                break;
+            }
+            if (SDObulk == NULL) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+            if ((SDObulk->owner != NULL) || CO_SDObulk_busy(SDObulk->bulk)) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+
+            /* r[ead] or w[rite] */
+            closed = 0U;
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            rw = CO_GTWA_getCommand(t, n);
+            if ((rw != CMD_READ) && (rw != CMD_WRITE)) {
+                err = true;
+            }
+
+            /* <node>[-<node>] <index> <subindex> <datatype> */
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            nodeCount = getNodeRange(t, n, &nodeFirst, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            idx = (uint16_t)getU32span(t, n, 0, 0xFFFF, &err);
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            subidx = (uint8_t)getU32span(t, n, 0, 0xFF, &err);
+            closed = (rw == CMD_WRITE) ? 0U : 1U;
+            n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+            gtwa->SDOdataType = CO_GTWA_getDataType(t, n, &err);
+            if (err) {
+                break;
+            }
+            if ((gtwa->SDOdataType->length == 0U) || (gtwa->SDOdataType->length > CO_GTWA_BULK_DATA_SIZE)) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+
+            /* value, the same for all nodes */
+            if (rw == CMD_WRITE) {
+                uint8_t buf[CO_GTWA_BULK_DATA_SIZE + 1U];
+                CO_fifo_t fifo;
+                uint8_t status;
+                size_t size;
+
+                CO_fifo_init(&fifo, buf, sizeof(buf));
+                size = gtwa->SDOdataType->dataTypeScan(&fifo, &gtwa->commFifo, &status);
+                closed = ((status & CO_fifo_st_closed) == 0U) ? 0U : 1U;
+                if ((closed == 0U) || ((status & (CO_fifo_st_errMask | CO_fifo_st_partial)) != 0U)
+                    || (size != gtwa->SDOdataType->length)) {
+                    err = true;
+                    break;
+                }
+                (void)CO_fifo_read(&fifo, SDObulk->data[0], size, NULL);
+            }
+
+            for (uint8_t i = 0; i < nodeCount; i++) {
+                CO_SDObulk_op_t* op = &SDObulk->ops[i];
+
+                op->nodeId = nodeFirst + i;
+                op->index = idx;
+                op->subIndex = subidx;
+                op->write = rw == CMD_WRITE;
+                op->data = op->write ? SDObulk->data[0] : SDObulk->data[i];
+                op->dataSize = gtwa->SDOdataType->length;
+            }
+            if (CO_SDObulk_start(SDObulk->bulk, SDObulk->ops, nodeCount) != CO_ERROR_NO) {
+                respErrorCode = CO_GTWA_respErrorInternalState;
+                err = true;
+                break;
+            }
+            SDObulk->owner = gtwa;
+            gtwa->bulkCount = nodeCount;
+            gtwa->bulkNext = 0;
+            /* SDO bulk engine is processed before the gateway, start it immediately */
+            if (timerNext_us != NULL) {
+                *timerNext_us = 0;
+            }
+
+            /* response head, results are printed in state machine, when all operations are finished */
+            gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "]",
+                                                  (int32_t)gtwa->sequence);
+            gtwa->state = CO_GTWA_ST_BULK;
+        }
+#endif
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NMT) != 0
@@ -1431,48 +2713,239 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
                     break;
                 }
 
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->scan[CO_LSS_FASTSCAN_PRODUCT] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
-                if (err) {
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->scan[CO_LSS_FASTSCAN_PRODUCT] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
+                if (err) {
+                    break;
+                }
+
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->match.identity.productCode = getU32(tok, 0, 0xFFFFFFFFU, &err);
+                if (err) {
+                    break;
+                }
+
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->scan[CO_LSS_FASTSCAN_REV] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
+                if (err) {
+                    break;
+                }
+
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->match.identity.revisionNumber = getU32(tok, 0, 0xFFFFFFFFU, &err);
+                if (err) {
+                    break;
+                }
+
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->scan[CO_LSS_FASTSCAN_SERIAL] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
+                if (err) {
+                    break;
+                }
+
+                closed = 1U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                fs->match.identity.serialNumber = getU32(tok, 0, 0xFFFFFFFFU, &err);
+                if (err) {
+                    break;
+                }
+            }
+            (void)memcpy(gtwa->lssScan, gtwa->lssFastscan.scan, sizeof(gtwa->lssScan));
+            gtwa->lssMatchFound = false;
+            gtwa->lssTime_us = 0;
+
+            /* continue with state machine */
+            gtwa->state = CO_GTWA_ST_LSS_ALLNODES;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LSS */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+        /* Subscribe - 'sub od <index> <subindex> <min_interval_ms> [<datatype>]' or
+         * 'sub pdo <COB-ID> <min_interval_ms> [<datatype> ...]' */
+        else if (tok_is_sub) {
+            CO_GTWA_sub_t* sub = NULL;
+            bool_t isPDO;
+            uint16_t idx = 0;
+            uint8_t subidx = 0;
+            uint8_t id;
+            uint8_t lengthMin = 0;
+            bool_t lengthVar = false;
+            bool_t NodeErr = checkNet(gtwa, net, &respErrorCode);
+
+            if ((closed != 0U) || NodeErr) {
+                err = true;
+                break;
+            }
+
+            /* free subscription */
+            for (id = 0; id < CO_CONFIG_GTWA_SUBSCRIPTIONS; id++) {
+                if (gtwa->sub[id].type == CO_GTWA_SUB_NONE) {
+                    sub = &gtwa->sub[id];
+                    break;
+                }
+            }
+            if (gtwa->OD == NULL) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            } else if (sub == NULL) {
+                respErrorCode = CO_GTWA_respErrorRunningOutOfMemory;
+                err = true;
+                break;
+            } else { /* MISRA C 2004 14.10 */
+            }
+
+            /* 'od' or 'pdo' */
+            closed = 0U;
+            (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+            convertToLower(tok, sizeof(tok));
+            isPDO = strcmp(tok, "pdo") == 0;
+            if (err || (!isPDO && (strcmp(tok, "od") != 0))) {
+                err = true;
+                break;
+            }
+
+            if (isPDO) {
+                /* COB-ID */
+                closed = 0U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                sub->CANid = (uint16_t)getU32(tok, 1, 0x7FF, &err);
+            } else {
+                /* index and subindex */
+                closed = 0U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                idx = (uint16_t)getU32(tok, 0, 0xFFFF, &err);
+                closed = 0U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                subidx = (uint8_t)getU32(tok, 0, 0xFF, &err);
+            }
+
+            /* minimum interval */
+            closed = 0xFFU;
+            n = CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+            sub->interval_us = getU32(tok, 0, 3600000, &err) * 1000U;
+            if (err || (n == 0U)) {
+                err = true;
+                break;
+            }
+
+            /* optional data types, data type with variable length must be the last one */
+            sub->dataTypeCount = 0;
+            while (closed == 0U) {
+                const CO_GTWA_dataType_t* dt;
+
+                if (lengthVar || (sub->dataTypeCount >= (isPDO ? CO_GTWA_SUB_DATA_SIZE : 1U))) {
+                    err = true;
                     break;
                 }
-
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->match.identity.productCode = getU32(tok, 0, 0xFFFFFFFFU, &err);
-                if (err) {
+                closed = 0xFFU;
+                n = CO_fifo_readTokenSpan(&gtwa->commFifo, &t, tok, sizeof(tok), &closed, &err);
+                dt = CO_GTWA_getDataType(t, n, &err);
+                if (err || (n == 0U)) {
+                    err = true;
                     break;
                 }
+                sub->dataType[sub->dataTypeCount] = dt;
+                sub->dataTypeCount++;
+                lengthMin += (uint8_t)dt->length;
+                lengthVar = dt->length == 0U;
+            }
+            if (err) {
+                break;
+            }
+            if (sub->dataTypeCount == 0U) {
+                sub->dataType[0] = &dataTypes[0]; /* hex */
+                sub->dataTypeCount = 1;
+            }
+            if (lengthMin > CO_GTWA_SUB_DATA_SIZE) {
+                respErrorCode = CO_GTWA_respErrorPDOlengthExceeded;
+                err = true;
+                break;
+            }
 
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->scan[CO_LSS_FASTSCAN_REV] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
+            sub->dataLengthMin = lengthMin;
+            sub->lastTime_us = gtwa->subTime_us - sub->interval_us;
+            sub->pending = false;
+            CO_FLAG_CLEAR(sub->CANrxNew);
+
+            if (isPDO) {
+                /* the same PDO may be subscribed only once */
+                for (uint8_t i2 = 0; i2 < CO_CONFIG_GTWA_SUBSCRIPTIONS; i2++) {
+                    if ((gtwa->sub[i2].type == CO_GTWA_SUB_PDO) && (gtwa->sub[i2].CANid == sub->CANid)) {
+                        respErrorCode = CO_GTWA_respErrorPDOalreadyUsed;
+                        err = true;
+                        break;
+                    }
+                }
                 if (err) {
                     break;
                 }
-
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->match.identity.revisionNumber = getU32(tok, 0, 0xFFFFFFFFU, &err);
-                if (err) {
+                if (CO_CANrxBufferInit(gtwa->CANdevRx, gtwa->CANdevRxIdx + id, sub->CANid, 0x7FF, false, (void*)sub,
+                                       CO_GTWA_subReceive)
+                    != CO_ERROR_NO) {
+                    respErrorCode = CO_GTWA_respErrorInternalState;
+                    err = true;
                     break;
                 }
+                sub->type = CO_GTWA_SUB_PDO;
+            } else {
+                /* OD entry must be readable and not longer than CO_GTWA_SUB_DATA_SIZE */
+                CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+                ODR_t odRet = OD_getSub(OD_find(gtwa->OD, idx), subidx, &sub->OD_IO, false);
+                OD_size_t dataLength = sub->OD_IO.stream.dataLength;
+
+                if (odRet != ODR_OK) {
+                    abortCode = (CO_SDO_abortCode_t)OD_getSDOabCode(odRet);
+                } else if ((sub->OD_IO.stream.attribute & ODA_SDO_R) == 0U) {
+                    abortCode = CO_SDO_AB_WRITEONLY;
+                } else if ((dataLength == 0U) || (dataLength > CO_GTWA_SUB_DATA_SIZE)) {
+                    abortCode = CO_SDO_AB_DATA_LONG;
+                } else if ((lengthMin != 0U) && (lengthMin != dataLength)) {
+                    abortCode = CO_SDO_AB_TYPE_MISMATCH;
+                } else { /* MISRA C 2004 14.10 */
+                }
 
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->scan[CO_LSS_FASTSCAN_SERIAL] = (CO_LSSmaster_scantype_t)getU32(tok, 0, 2, &err);
-                if (err) {
-                    break;
+                if (abortCode != CO_SDO_AB_NONE) {
+                    responseWithErrorSDO(gtwa, abortCode, false);
+                    continue;
                 }
+                sub->valueLength = 0xFFU; /* notify the first value */
+                sub->type = CO_GTWA_SUB_OD;
+            }
 
-                closed = 1U;
-                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
-                fs->match.identity.serialNumber = getU32(tok, 0, 0xFFFFFFFFU, &err);
+            gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "[%" PRId32 "] %" PRIu8 "\r\n",
+                                                  (int32_t)gtwa->sequence, id);
+            (void)respBufTransfer(gtwa);
+        }
+
+        /* Cancel subscription - 'unsub <id>|all' */
+        else if (tok_is_unsub) {
+            if (closed != 0U) {
+                err = true;
+                break;
+            }
+
+            closed = 1U;
+            (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+            if (err) {
+                break;
+            }
+
+            convertToLower(tok, sizeof(tok));
+            if (strcmp(tok, "all") == 0) {
+                for (uint8_t i2 = 0; i2 < CO_CONFIG_GTWA_SUBSCRIPTIONS; i2++) {
+                    subCancel(gtwa, i2);
+                }
+            } else {
+                uint8_t id = (uint8_t)getU32(tok, 0, CO_CONFIG_GTWA_SUBSCRIPTIONS - 1U, &err);
                 if (err) {
                     break;
                 }
+                subCancel(gtwa, id);
             }
-
-            /* continue with state machine */
-            gtwa->state = CO_GTWA_ST_LSS_ALLNODES;
+            responseWithOK(gtwa);
         }
-#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LSS */
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SUBSCRIBE */
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LOG) != 0
         /* Print message log */
@@ -1526,6 +2999,66 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         }
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_LEDS */
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+        /* Print network state table or its log - 'nodes [<logSeq>]' */
+        else if (tok_is_nodes) {
+            if (gtwa->netTable == NULL) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+            if (closed == 1U) {
+                gtwa->nodesLog = false;
+                gtwa->nodesNext = 1;
+            } else {
+                closed = 1U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                uint32_t logSeq = getU32(tok, 0, 0xFFFFFFFFU, &err);
+                if (err) {
+                    break;
+                }
+
+                /* older log entries are overwritten */
+                uint32_t logCount = gtwa->netTable->logCount;
+                gtwa->nodesLog = true;
+                gtwa->nodesNext = ((int32_t)(logCount - logSeq) > (int32_t)CO_HBCONS_NET_LOG_SIZE)
+                                      ? (logCount - CO_HBCONS_NET_LOG_SIZE)
+                                      : logSeq;
+            }
+            gtwa->state = CO_GTWA_ST_NODES;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_NODES */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+        /* Print aggregated emergency messages or their history - 'emcy [<histSeq>]' */
+        else if (tok_is_emcy) {
+            if (gtwa->em == NULL) {
+                respErrorCode = CO_GTWA_respErrorReqNotSupported;
+                err = true;
+                break;
+            }
+            if (closed == 1U) {
+                gtwa->emcyHist = false;
+                gtwa->emcyNext = 0;
+            } else {
+                closed = 1U;
+                (void)CO_fifo_readToken(&gtwa->commFifo, tok, sizeof(tok), &closed, &err);
+                uint32_t histSeq = getU32(tok, 0, 0xFFFFFFFFU, &err);
+                if (err) {
+                    break;
+                }
+
+                /* older history entries are overwritten */
+                uint32_t histCount = gtwa->em->consHistCount;
+                gtwa->emcyHist = true;
+                gtwa->emcyNext = ((int32_t)(histCount - histSeq) > (int32_t)CO_EM_CONS_HIST_SIZE)
+                                     ? (histCount - CO_EM_CONS_HIST_SIZE)
+                                     : histSeq;
+            }
+            gtwa->state = CO_GTWA_ST_EMCY;
+        }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_EMCY */
+
         /* Unrecognized command */
         else {
             respErrorCode = CO_GTWA_respErrorReqNotSupported;
@@ -1554,6 +3087,15 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
     else {
         switch (gtwa->state) {
             case CO_GTWA_ST_IDLE: {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+                SDOpoolRelease(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+                LSSreleaseIfUnused(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+                subProcess(gtwa, timerNext_us);
+#endif
                 return; /* skip timerNext_us calculation */
                 break;
             }
@@ -1686,8 +3228,232 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
                 }
                 break;
             }
+
+            /* SDO multiple uploads or downloads state */
+            case CO_GTWA_ST_MREAD:
+            case CO_GTWA_ST_MWRITE: {
+                bool_t write = gtwa->state == CO_GTWA_ST_MWRITE;
+                CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+                size_t sizeTransferred;
+                CO_SDO_return_t ret;
+
+                /* Serve objects one after another in the same cycle, until SDO client waits for response. */
+                while (!gtwa->respHold) {
+                    size_t space = (CO_GTWA_RESP_BUF_SIZE - 2U) - gtwa->respBufCount;
+                    char* resp = &gtwa->respBuf[gtwa->respBufCount];
+
+                    /* keep space for error response and the end of line */
+                    if (space < 24U) {
+                        if (respBufTransfer(gtwa) == false) {
+                            /* broken communication, send SDO abort and force finish. */
+                            if (gtwa->SDOmultiActive) {
+                                abortCode = CO_SDO_AB_DATA_TRANSF;
+                                if (write) {
+                                    (void)CO_SDOclientDownload(gtwa->SDO_C, 0, true, false, &abortCode, NULL, NULL);
+                                } else {
+                                    (void)CO_SDOclientUpload(gtwa->SDO_C, 0, true, &abortCode, NULL, NULL, NULL);
+                                }
+                            }
+                            gtwa->state = CO_GTWA_ST_IDLE;
+                            break;
+                        }
+                        continue;
+                    }
+
+                    /* start next object or finish */
+                    if (!gtwa->SDOmultiActive) {
+                        if (gtwa->SDOmultiLast) {
+                            gtwa->respBufCount += (size_t)sprintf(resp, "\r\n");
+                            (void)respBufTransfer(gtwa);
+                            gtwa->state = CO_GTWA_ST_IDLE;
+                            break;
+                        }
+                        if (multiItemStart(gtwa, write)) {
+                            gtwa->respBufCount += (size_t)snprintf(resp, space, " ERROR:%d\r\n",
+                                                                   (int32_t)CO_GTWA_respErrorSyntax);
+                            /* delete the rest of the command */
+                            if (!gtwa->SDOmultiLast) {
+                                (void)CO_fifo_CommSearch(&gtwa->commFifo, true);
+                            }
+                            (void)respBufTransfer(gtwa);
+                            gtwa->state = CO_GTWA_ST_IDLE;
+                            break;
+                        }
+                        gtwa->respBufCount += (size_t)sprintf(resp, " ");
+                        gtwa->SDOmultiActive = true;
+                        continue;
+                    }
+
+                    if (write) {
+                        uint32_t loop = 0;
+                        do {
+                            ret = CO_SDOclientDownload(gtwa->SDO_C, timeDifference_us, false, false, &abortCode,
+                                                       &sizeTransferred, timerNext_us);
+                        } while ((ret == CO_SDO_RT_blockDownldInProgress) && (++loop < CO_CONFIG_GTW_BLOCK_DL_LOOP));
+                    } else {
+                        ret = CO_SDOclientUpload(gtwa->SDO_C, timeDifference_us, false, &abortCode, NULL, NULL,
+                                                 timerNext_us);
+                    }
+                    timeDifference_us = 0;
+
+                    if (ret < CO_SDO_RT_ok_communicationEnd) {
+                        (void)CO_fifo_purge(&gtwa->SDO_C->bufFifo);
+                        gtwa->respBufCount += (size_t)snprintf(resp, space, "ERROR:0x%08X", (uint32_t)abortCode);
+                        gtwa->SDOmultiActive = false;
+                    } else if (write) {
+                        if (ret != CO_SDO_RT_ok_communicationEnd) {
+                            break; /* wait for response */
+                        }
+                        gtwa->respBufCount += (size_t)sprintf(resp, "OK");
+                        gtwa->SDOmultiActive = false;
+                    } else if ((ret == CO_SDO_RT_uploadDataBufferFull) || (ret == CO_SDO_RT_ok_communicationEnd)) {
+                        gtwa->respBufCount += gtwa->SDOdataType->dataTypePrint(&gtwa->SDO_C->bufFifo, resp, space,
+                                                                              ret == CO_SDO_RT_ok_communicationEnd);
+                        if ((ret == CO_SDO_RT_ok_communicationEnd)
+                            && (CO_fifo_getOccupied(&gtwa->SDO_C->bufFifo) == 0U)) {
+                            gtwa->SDOmultiActive = false;
+                        }
+                    } else {
+                        break; /* wait for response */
+                    }
+                }
+                break;
+            }
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+            /* SDO bulk state, transfers run in SDO bulk engine. Results are printed, when all are finished. */
+            case CO_GTWA_ST_BULK: {
+                CO_GTWA_SDObulk_t* SDObulk = gtwa->SDObulk;
+
+                if (CO_SDObulk_busy(SDObulk->bulk)) {
+                    break;
+                }
+
+                while (!gtwa->respHold) {
+                    size_t space = (CO_GTWA_RESP_BUF_SIZE - 2U) - gtwa->respBufCount;
+                    char* resp = &gtwa->respBuf[gtwa->respBufCount];
+                    const CO_SDObulk_op_t* op;
+
+                    /* keep space for the longest value and the end of line */
+                    if (space < 48U) {
+                        if (respBufTransfer(gtwa) == false) {
+                            SDObulk->owner = NULL;
+                            gtwa->state = CO_GTWA_ST_IDLE;
+                            break;
+                        }
+                        continue;
+                    }
+                    if (gtwa->bulkNext >= gtwa->bulkCount) {
+                        gtwa->respBufCount += (size_t)sprintf(resp, "\r\n");
+                        (void)respBufTransfer(gtwa);
+                        SDObulk->owner = NULL;
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                        break;
+                    }
+
+                    op = &SDObulk->ops[gtwa->bulkNext];
+                    gtwa->bulkNext++;
+                    gtwa->respBufCount += (size_t)sprintf(resp, " %" PRIu32 ":", (uint32_t)op->nodeId);
+                    resp = &gtwa->respBuf[gtwa->respBufCount];
+                    space = (CO_GTWA_RESP_BUF_SIZE - 2U) - gtwa->respBufCount;
+                    if (op->state != CO_SDObulk_op_done) {
+                        gtwa->respBufCount += (size_t)snprintf(resp, space, "ERROR:0x%08X", (uint32_t)op->abortCode);
+                    } else if (op->write) {
+                        gtwa->respBufCount += (size_t)sprintf(resp, "OK");
+                    } else {
+                        uint8_t buf[CO_GTWA_BULK_DATA_SIZE + 1U];
+                        CO_fifo_t fifo;
+
+                        CO_fifo_init(&fifo, buf, sizeof(buf));
+                        (void)CO_fifo_write(&fifo, op->data, op->sizeTransferred, NULL);
+                        gtwa->respBufCount += gtwa->SDOdataType->dataTypePrint(&fifo, resp, space, true);
+                    }
+                }
+                break;
+            }
+#endif
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+            /* SDO upload state, binary frame */
+            case CO_GTWA_ST_BIN_READ: {
+                CO_SDO_abortCode_t abortCode;
+                size_t sizeTransferred;
+                CO_SDO_return_t ret;
+
+                ret = CO_SDOclientUpload(gtwa->SDO_C, timeDifference_us, false, &abortCode, NULL, &sizeTransferred,
+                                         timerNext_us);
+
+                if (ret < CO_SDO_RT_ok_communicationEnd) {
+                    responseWithErrorSDO(gtwa, abortCode, false);
+                    gtwa->state = CO_GTWA_ST_IDLE;
+                } else if ((ret == CO_SDO_RT_uploadDataBufferFull) || (ret == CO_SDO_RT_ok_communicationEnd)) {
+                    binUploadResponse(gtwa, ret, sizeTransferred);
+                } else { /* MISRA C 2004 14.10 */
+                }
+                break;
+            }
+
+            /* SDO download state, binary frame */
+            case CO_GTWA_ST_BIN_WRITE: {
+                CO_SDO_abortCode_t abortCode;
+                size_t sizeTransferred;
+                bool_t abort_comm = false;
+                bool_t hold = false;
+                CO_SDO_return_t ret;
+
+                /* copy next part of the payload to the SDO buffer, wait for it, if necessary */
+                if (gtwa->SDOdataCopyStatus) {
+                    binDownloadCopy(gtwa);
+                }
+                if (gtwa->SDOdataCopyStatus
+                    && (CO_fifo_getOccupied(&gtwa->SDO_C->bufFifo) < (CO_CONFIG_GTW_BLOCK_DL_LOOP * 7U))) {
+                    if (gtwa->stateTimeoutTmr > CO_GTWA_STATE_TIMEOUT_TIME_US) {
+                        abortCode = CO_SDO_AB_DEVICE_INCOMPAT;
+                        abort_comm = true;
+                    } else {
+                        gtwa->stateTimeoutTmr += timeDifference_us;
+                        hold = true;
+                    }
+                }
+                if (!hold || abort_comm) {
+                    uint32_t loop = 0;
+                    do {
+                        ret = CO_SDOclientDownload(gtwa->SDO_C, timeDifference_us, abort_comm, gtwa->SDOdataCopyStatus,
+                                                   &abortCode, &sizeTransferred, timerNext_us);
+                        if (++loop >= CO_CONFIG_GTW_BLOCK_DL_LOOP) {
+                            break;
+                        }
+                    } while (ret == CO_SDO_RT_blockDownldInProgress);
+
+                    if (ret < CO_SDO_RT_ok_communicationEnd) {
+                        responseWithErrorSDO(gtwa, abortCode, false);
+                        /* purge remaining payload if necessary */
+                        if (binSkip(gtwa)) {
+                            gtwa->state = CO_GTWA_ST_IDLE;
+                            binBatchEnd(gtwa);
+                        } else {
+                            gtwa->state = CO_GTWA_ST_BIN_SKIP;
+                        }
+                    } else if (ret == CO_SDO_RT_ok_communicationEnd) {
+                        responseWithOK(gtwa);
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                    } else { /* MISRA C 2004 14.10 */
+                    }
+                }
+                break;
+            }
+
+            /* binary frame was not accepted, purge remaining payload */
+            case CO_GTWA_ST_BIN_SKIP: {
+                if (binSkip(gtwa)) {
+                    gtwa->state = CO_GTWA_ST_IDLE;
+                    binBatchEnd(gtwa);
+                }
+                break;
+            }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_BINARY */
+
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
             case CO_GTWA_ST_LSS_SWITCH_GLOB: {
                 CO_LSSmaster_return_t ret;
@@ -1818,17 +3584,25 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             }
             case CO_GTWA_ST_LSS_ALLNODES: {
                 CO_LSSmaster_return_t ret;
+                gtwa->lssTime_us += timeDifference_us;
                 if (gtwa->lssSubState == 0U) { /* _lss_fastscan */
                     ret = CO_LSSmaster_IdentifyFastscan(gtwa->LSSmaster, timeDifference_us, &gtwa->lssFastscan);
                     if (ret != CO_LSSmaster_WAIT_SLAVE) {
                         CO_LSSmaster_changeTimeout(gtwa->LSSmaster, CO_LSSmaster_DEFAULT_TIMEOUT);
 
-                        if ((ret == CO_LSSmaster_OK) || (ret == CO_LSSmaster_SCAN_NOACK)) {
+                        if (((ret == CO_LSSmaster_OK) || (ret == CO_LSSmaster_SCAN_NOACK)) && gtwa->lssMatchFound) {
+                            /* no more nodes with the same identity as previous node, repeat with user scan types */
+                            (void)memcpy(gtwa->lssFastscan.scan, gtwa->lssScan, sizeof(gtwa->lssScan));
+                            gtwa->lssMatchFound = false;
+                            CO_LSSmaster_changeTimeout(gtwa->LSSmaster, gtwa->lssTimeout_ms);
+                        } else if ((ret == CO_LSSmaster_OK) || (ret == CO_LSSmaster_SCAN_NOACK)) {
                             /* no (more) nodes found, send report sum and finish */
                             gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
-                                                                  "# Found %d nodes, search finished.\n"
+                                                                  "# Found %d nodes, search finished in %" PRIu32
+                                                                  " ms.\n"
                                                                   "[%" PRId32 "] OK\r\n",
-                                                                  gtwa->lssNodeCount, (int32_t)gtwa->sequence);
+                                                                  gtwa->lssNodeCount, gtwa->lssTime_us / 1000U,
+                                                                  (int32_t)gtwa->sequence);
                             (void)respBufTransfer(gtwa);
                             gtwa->state = CO_GTWA_ST_IDLE;
                         } else if (ret == CO_LSSmaster_SCAN_FINISHED) {
@@ -1894,7 +3668,17 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
                         /* increment variables, check end-of-nodeId */
                         gtwa->lssNodeCount++;
                         if (gtwa->lssNID < 127U) {
-                            /* repeat cycle with next node-id */
+                            uint8_t i;
+                            /* repeat cycle with next node-id. Nodes of the same type are commissioned together
+                             * usually, so try to match identity of the found node first. Then only serial number
+                             * is scanned. */
+                            for (i = CO_LSS_FASTSCAN_VENDOR_ID; i < CO_LSS_FASTSCAN_SERIAL; i++) {
+                                if (gtwa->lssScan[i] == CO_LSSmaster_FS_SCAN) {
+                                    gtwa->lssFastscan.scan[i] = CO_LSSmaster_FS_MATCH;
+                                    gtwa->lssFastscan.match.addr[i] = gtwa->lssFastscan.found.addr[i];
+                                    gtwa->lssMatchFound = true;
+                                }
+                            }
                             gtwa->lssNID++;
                             CO_LSSmaster_changeTimeout(gtwa->LSSmaster, gtwa->lssTimeout_ms);
                             gtwa->lssSubState = 0;
@@ -1907,11 +3691,12 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
                         /* send report */
                         gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
                                                               "# Node-ID %d assigned to: 0x%08" PRIX32 " 0x%08" PRIX32
-                                                              " 0x%08" PRIX32 " 0x%08" PRIX32 "\n%s",
+                                                              " 0x%08" PRIX32 " 0x%08" PRIX32 " (%" PRIu32 " ms)\n%s",
                                                               lssNidAssigned, gtwa->lssFastscan.found.identity.vendorID,
                                                               gtwa->lssFastscan.found.identity.productCode,
                                                               gtwa->lssFastscan.found.identity.revisionNumber,
-                                                              gtwa->lssFastscan.found.identity.serialNumber, msg2);
+                                                              gtwa->lssFastscan.found.identity.serialNumber,
+                                                              gtwa->lssTime_us / 1000U, msg2);
                         (void)respBufTransfer(gtwa);
                     }
                 }
@@ -1988,6 +3773,82 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
             }
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_PRINT_LEDS */
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+            /* print network state table or its log, one line per node or log entry */
+            case CO_GTWA_ST_NODES: {
+                const CO_HBconsumer_netTable_t* table = gtwa->netTable;
+
+                do {
+                    if (!gtwa->nodesLog && (gtwa->nodesNext < 128U)) {
+                        const CO_HBconsumer_netNode_t* node = &table->nodes[gtwa->nodesNext];
+                        if ((node->changeCount > 0U) || (node->HBstate != (uint8_t)CO_HBconsumer_UNCONFIGURED)) {
+                            gtwa->respBufCount = (size_t)snprintf(
+                                gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "%" PRIu32 " %s %s %u %u %u %" PRIu32 "\n",
+                                gtwa->nodesNext, nodesNMTstring(node->NMTstate), nodesHBstring(node->HBstate),
+                                node->bootupCount, node->timeoutCount, node->changeCount, node->lastSeen_ms);
+                            (void)respBufTransfer(gtwa);
+                        }
+                        gtwa->nodesNext++;
+                    } else if (gtwa->nodesLog && ((table->logCount - gtwa->nodesNext - 1U) < CO_HBCONS_NET_LOG_SIZE)) {
+                        const CO_HBconsumer_netLog_t* log =
+                            &table->log[gtwa->nodesNext & (CO_HBCONS_NET_LOG_SIZE - 1U)];
+                        gtwa->respBufCount = (size_t)snprintf(
+                            gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE, "%" PRIu32 " %" PRIu32 " %u %s %s %s\n",
+                            gtwa->nodesNext, log->time_ms, log->nodeId, nodesEventString(log->event),
+                            nodesNMTstring(log->NMTstate), nodesHBstring(log->HBstate));
+                        (void)respBufTransfer(gtwa);
+                        gtwa->nodesNext++;
+                    } else {
+                        gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                                                              "[%" PRId32 "] %" PRIu32 "\r\n", (int32_t)gtwa->sequence,
+                                                              table->logCount);
+                        (void)respBufTransfer(gtwa);
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                        break;
+                    }
+                } while (gtwa->respHold == false);
+                break;
+            }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_NODES */
+
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+            /* print aggregated emergency messages or their history, one line per entry */
+            case CO_GTWA_ST_EMCY: {
+                const CO_EM_t* em = gtwa->em;
+
+                do {
+                    if (!gtwa->emcyHist && (gtwa->emcyNext < CO_EM_CONS_ENTRIES)
+                        && (em->consEntries[gtwa->emcyNext].nodeId != 0U)) {
+                        const CO_EM_consEntry_t* e = &em->consEntries[gtwa->emcyNext];
+                        gtwa->respBufCount = (size_t)snprintf(
+                            gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                            "%u 0x%04X 0x%02X 0x%02X 0x%08" PRIX32 " %" PRIu32 " %" PRIu32 " %" PRIu32 "\n", e->nodeId,
+                            e->errorCode, e->errorRegister, e->errorBit, e->infoCode, e->count, e->firstSeen_ms,
+                            e->lastSeen_ms);
+                        (void)respBufTransfer(gtwa);
+                        gtwa->emcyNext++;
+                    } else if (gtwa->emcyHist
+                               && ((em->consHistCount - gtwa->emcyNext - 1U) < CO_EM_CONS_HIST_SIZE)) {
+                        const CO_EM_consHist_t* h = &em->consHist[gtwa->emcyNext & (CO_EM_CONS_HIST_SIZE - 1U)];
+                        gtwa->respBufCount = (size_t)snprintf(
+                            gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                            "%" PRIu32 " %" PRIu32 " %u 0x%04X 0x%02X 0x%02X 0x%08" PRIX32 " %u\n", gtwa->emcyNext,
+                            h->time_ms, h->nodeId, h->errorCode, h->errorRegister, h->errorBit, h->infoCode, h->count);
+                        (void)respBufTransfer(gtwa);
+                        gtwa->emcyNext++;
+                    } else {
+                        gtwa->respBufCount = (size_t)snprintf(gtwa->respBuf, CO_GTWA_RESP_BUF_SIZE,
+                                                              "[%" PRId32 "] %" PRIu32 "\r\n", (int32_t)gtwa->sequence,
+                                                              em->consHistCount);
+                        (void)respBufTransfer(gtwa);
+                        gtwa->state = CO_GTWA_ST_IDLE;
+                        break;
+                    }
+                } while (gtwa->respHold == false);
+                break;
+            }
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_EMCY */
+
             /* illegal state */
             default: {
                 respErrorCode = CO_GTWA_respErrorInternalState;
@@ -1998,9 +3859,32 @@ CO_GTWA_process(CO_GTWA_t* gtwa, bool_t enable, uint32_t timeDifference_us, uint
         } /* switch (gtwa->state) */
     }
 
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+    /* let other sessions use SDO client */
+    SDOpoolReleaseIfUnused(gtwa);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+    /* let other sessions use LSS master */
+    LSSreleaseIfUnused(gtwa);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0) && (((CO_CONFIG_LSS)&CO_CONFIG_FLAG_TIMERNEXT) != 0)
+    /* LSS master functions have no timerNext_us argument, wake up when LSS response window expires */
+    CO_LSSmaster_timerNext(gtwa->LSSmaster, timerNext_us);
+#endif
+
     /* execute next CANopen processing immediately, if idle and more commands available */
     if ((timerNext_us != NULL) && (gtwa->state == CO_GTWA_ST_IDLE)) {
-        if (CO_fifo_CommSearch(&gtwa->commFifo, false)) {
+        if ((CO_fifo_CommSearch(&gtwa->commFifo, false)
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0
+             || binFrameReady(gtwa)
+#endif
+                 )
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+            /* if all SDO clients are busy, wait for them */
+            && ((gtwa->SDOpool == NULL) || ((~gtwa->SDOpool->busy & SDOpoolMask(gtwa->SDOpool)) != 0U))
+#endif
+        ) {
             *timerNext_us = 0;
         }
     }
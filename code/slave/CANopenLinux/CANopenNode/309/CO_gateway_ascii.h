@@ -25,14 +25,29 @@
 #include "301/CO_driver.h"
 #include "301/CO_fifo.h"
 #include "301/CO_SDOclient.h"
+#include "extra/CO_SDObulk.h"
 #include "301/CO_NMT_Heartbeat.h"
 #include "305/CO_LSSmaster.h"
 #include "303/CO_LEDs.h"
+#include "301/CO_HBconsumer.h"
+#include "301/CO_Emergency.h"
 
 /* default configuration, see CO_config.h */
 #ifndef CO_CONFIG_GTW
 #define CO_CONFIG_GTW (0)
 #endif
+#ifndef CO_CONFIG_GTWA_SESSIONS
+#define CO_CONFIG_GTWA_SESSIONS 1
+#endif
+#if (CO_CONFIG_GTWA_SESSIONS < 1) || (CO_CONFIG_GTWA_SESSIONS > 32)
+#error CO_CONFIG_GTWA_SESSIONS must be from 1 to 32.
+#endif
+#ifndef CO_CONFIG_GTWA_SUBSCRIPTIONS
+#define CO_CONFIG_GTWA_SUBSCRIPTIONS 8
+#endif
+#if (CO_CONFIG_GTWA_SUBSCRIPTIONS < 1) || (CO_CONFIG_GTWA_SUBSCRIPTIONS > 64)
+#error CO_CONFIG_GTWA_SUBSCRIPTIONS must be from 1 to 64.
+#endif
 
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0) || defined CO_DOXYGEN
 
@@ -56,6 +71,13 @@ extern "C" {
  *
  * This module is usually initialized and processed in CANopen.c file. Application should register own callback function
  * for reading the output stream. Application writes new commands with CO_GTWA_write().
+ *
+ * Multiple Gateway-ascii objects (sessions, see @ref CO_CONFIG_GTWA_SESSIONS) may run concurrently, for example one
+ * per socket connection. Each session has own command fifo, sequence number and output stream. Sessions share SDO
+ * clients through #CO_GTWA_SDOpool_t: free SDO client is acquired, when session starts SDO command and is released,
+ * when session becomes idle. If all SDO clients are busy, SDO command waits in the fifo, other commands are not
+ * affected. NMT master object is shared directly. LSS master is owned by one session during LSS command, see
+ * #CO_GTWA_LSSlock_t.
  */
 
 /**
@@ -68,6 +90,14 @@ extern "C" {
 Command strings start with '"["<sequence>"]"' followed by:
 [[<net>] <node>] r[ead] <index> <subindex> [<datatype>]        # SDO upload.
 [[<net>] <node>] w[rite] <index> <subindex> <datatype> <value> # SDO download.
+[[<net>] <node>] mr[ead] <index> <subindex> <datatype> ...     # SDO upload of
+                                 # multiple objects, non-standard.
+[[<net>] <node>] mw[rite] <index> <subindex> <datatype> <value> ...
+                                 # SDO download of multiple objects, non-standard.
+[<net>] bulk r[ead] <node>[-<node>] <index> <subindex> <datatype>
+[<net>] bulk w[rite] <node>[-<node>] <index> <subindex> <datatype> <value>
+                                 # SDO upload or download of the same object
+                                 # on range of nodes concurrently, non-standard.
 
 [[<net>] <node>] start                   # NMT Start node.
 [[<net>] <node>] stop                    # NMT Stop node.
@@ -80,13 +110,24 @@ Command strings start with '"["<sequence>"]"' followed by:
 [<net>] set sdo_timeout <value>          # Configure SDO time-out.
 [<net>] set sdo_block <value>            # Enable/disable SDO block transfer.
 
+[<net>] sub od <index> <subindex> <min_interval_ms> [<datatype>]
+                                 # Subscribe to own OD entry, non-standard.
+[<net>] sub pdo <COB-ID> <min_interval_ms> [<datatype> ...]
+                                 # Subscribe to PDO message, non-standard.
+unsub <id>|all                           # Cancel subscription, non-standard.
+
 help [datatype|lss]                      # Print this or datatype or lss help.
 led                                      # Print status LED diodes.
 log                                      # Print message log.
+nodes [<logSeq>]                         # Print state of the nodes in the
+                                 # network or log of changes, non-standard.
+emcy [<histSeq>]                         # Print received emergency messages
+                                 # or their history, non-standard.
 
 Response:
 "["<sequence>"]" OK | <value> |
                  ERROR:<SDO-abort-code> | ERROR:<internal-error-code>
+"@"<id> <timestamp_ms> <value> ...       # Subscription notification.
 
 * Every command must be terminated with <CR><LF> ('\\r\\n'). characters. Same
   is response. String is not null terminated, <CR> is optional in command.
@@ -96,6 +137,31 @@ Response:
   disabled by default.
 * If '<net>' or '<node>' is not specified within commands, then value defined
   by 'set network' or 'set node' command is used.
+* 'mread' and 'mwrite' accept list of objects. Response is one line with one
+  value, OK or ERROR:<SDO-abort-code> for each object.
+* 'bulk' runs transfers over SDO bulk engine, one per node in the range.
+  Response is one line with <node>:<value>, <node>:OK or
+  <node>:ERROR:<SDO-abort-code> for each node, printed when all transfers
+  are finished. Datatype must have fixed length of at most 8 bytes. Only one
+  'bulk' command may run at a time.
+* 'sub' responds with subscription <id>. Later, when the value changes, the
+  notification line is printed between the responses. It is printed at most
+  once per <min_interval_ms>, with the latest value. OD entry is sampled with
+  the same interval. Values are printed as hex, if <datatype> is omitted.
+  PDO must not be received by the RPDO of this device.
+* 'nodes' prints one line per node, which was seen or is monitored:
+  <node> <NMT> <HB> <bootups> <timeouts> <changes> <last_seen_ms>. With
+  <logSeq> it prints log entries from <logSeq> on:
+  <logSeq> <time_ms> <node> <event> <NMT> <HB>. Response is the number of
+  all log entries, which is <logSeq> for the next call.
+* 'emcy' prints one line per node and error code received:
+  <node> <errorCode> <errorRegister> <errorBit> <infoCode> <count>
+  <first_ms> <last_ms>. Values from the last message are printed. With
+  <histSeq> it prints history from <histSeq> on: one entry for the first
+  message, then at most one per interval (1000 ms by default) for repeated
+  messages:
+  <histSeq> <time_ms> <node> <errorCode> <errorRegister> <errorBit>
+  <infoCode> <count>. Response is the number of all history entries.
 
 Datatypes:
 b                  # Boolean.
@@ -136,6 +202,55 @@ lss_allnodes [<timeout_ms> [<nodeStart=1..127> <store=0|1>\\
  * @}
  */
 
+/**
+ * @defgroup CO_CANopen_309_3_Binary Binary frames
+ * Non-standard binary mapping of the gateway commands, see @ref CO_CONFIG_GTW_BINARY.
+ *
+ * @{
+ *
+ * Binary frames may be written into the same command stream as ascii commands. Frame is recognized by the first byte
+ * (#CO_GTWA_BIN_MAGIC_REQ), which is never the first byte of the ascii command. Binary frames avoid token parsing and
+ * data type conversion, so they are suitable for the programs, which access many objects. Multi-byte values are little
+ * endian.
+ *
+ * @code{.unparsed}
+Byte   Request                          Response
+0      0xC0                             0xC1
+1      opcode                           opcode (copied)
+2..3   sequence                         sequence (copied)
+4      net (0 = default)                net (copied)
+5      node (0 = default, see below)    node (copied)
+6..7   index                            index (copied)
+8      subindex                         subindex (copied)
+9      data type (CiA 301 code, 0=raw)  status
+10..11 payload length                   payload length
+12..   payload                          payload
+
+Opcodes:
+0x01   SDO upload. Request payload is empty. Response payload are data.
+0x02   SDO download. Request payload are data (any length).
+0x03   NMT command. Payload is one byte: NMT command specifier. Node 0 means
+       all nodes.
+0x10   LSS switch state global. Payload is one byte: 0 or 1.
+0x11   LSS configure node-ID. Payload is one byte: node-ID.
+0x12   LSS store configuration. Payload is empty.
+0x20   Batch. Payload are request frames. Responses to them are collected
+       and followed by response to the batch with four bytes of payload:
+       number of successful and number of failed requests (two uint16).
+
+Status:
+0x00   OK.
+0x01   Gateway error, payload is uint32 CO_GTWA_respErrorCode_t.
+0x02   SDO abort, payload is uint32 SDO abort code.
+0x80   Flag: more response frames with partial data will follow.
+ * @endcode
+ *
+ * If data type of SDO request has fixed size (INTEGER16, for example), then data size is verified. Payload of requests,
+ * except SDO download and batch, may be up to #CO_GTWA_BIN_SHORT_PAYLOAD bytes long. Longer uploaded data are returned
+ * in multiple response frames.
+ * @}
+ */
+
 /** Size of response string buffer. This is intermediate buffer. If there is larger amount of data to transfer, then
  * multiple transfers will occur. */
 #ifndef CO_GTWA_RESP_BUF_SIZE
@@ -147,6 +262,40 @@ lss_allnodes [<timeout_ms> [<nodeStart=1..127> <store=0|1>\\
 #define CO_GTWA_STATE_TIMEOUT_TIME_US 1200000U
 #endif
 
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0) || defined CO_DOXYGEN
+/** Size of the binary frame header */
+#define CO_GTWA_BIN_HEADER_SIZE 12U
+/** First byte of the binary request frame */
+#define CO_GTWA_BIN_MAGIC_REQ 0xC0U
+/** First byte of the binary response frame */
+#define CO_GTWA_BIN_MAGIC_RSP 0xC1U
+/** Maximum payload length of binary request frames, except SDO download and batch */
+#define CO_GTWA_BIN_SHORT_PAYLOAD 8U
+
+/**
+ * Opcodes of the binary frames
+ */
+typedef enum {
+    CO_GTWA_BIN_OP_READ = 0x01U,            /**< SDO upload */
+    CO_GTWA_BIN_OP_WRITE = 0x02U,           /**< SDO download */
+    CO_GTWA_BIN_OP_NMT = 0x03U,             /**< NMT command */
+    CO_GTWA_BIN_OP_LSS_SWITCH_GLOB = 0x10U, /**< LSS switch state global */
+    CO_GTWA_BIN_OP_LSS_SET_NODE = 0x11U,    /**< LSS configure node-ID */
+    CO_GTWA_BIN_OP_LSS_STORE = 0x12U,       /**< LSS store configuration */
+    CO_GTWA_BIN_OP_BATCH = 0x20U            /**< Batch of request frames */
+} CO_GTWA_binOpcode_t;
+
+/**
+ * Status of the binary response frames
+ */
+typedef enum {
+    CO_GTWA_BIN_ST_OK = 0x00U,    /**< Success */
+    CO_GTWA_BIN_ST_ERROR = 0x01U, /**< Gateway error, payload is #CO_GTWA_respErrorCode_t */
+    CO_GTWA_BIN_ST_ABORT = 0x02U, /**< SDO abort, payload is #CO_SDO_abortCode_t */
+    CO_GTWA_BIN_ST_MORE = 0x80U   /**< Flag, more response frames will follow */
+} CO_GTWA_binStatus_t;
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_BINARY */
+
 /**
  * Response error codes as specified by CiA 309-3. Values less or equal to 0 are used for control for some functions and
  * are not part of the standard.
@@ -191,6 +340,8 @@ typedef enum {
     CO_GTWA_ST_READ = 0x10U,  /**< SDO 'read' (upload) */
     CO_GTWA_ST_WRITE = 0x11U, /**< SDO 'write' (download) */
     CO_GTWA_ST_WRITE_ABORTED = 0x12U,        /**< SDO 'write' (download) - aborted, purging remaining data */
+    CO_GTWA_ST_MREAD = 0x13U,                /**< SDO 'mread' (multiple uploads) */
+    CO_GTWA_ST_MWRITE = 0x14U,               /**< SDO 'mwrite' (multiple downloads) */
     CO_GTWA_ST_LSS_SWITCH_GLOB = 0x20U,      /**< LSS 'lss_switch_glob' */
     CO_GTWA_ST_LSS_SWITCH_SEL = 0x21U,       /**< LSS 'lss_switch_sel' */
     CO_GTWA_ST_LSS_SET_NODE = 0x22U,         /**< LSS 'lss_set_node' */
@@ -200,9 +351,15 @@ typedef enum {
     CO_GTWA_ST_LSS_INQUIRE_ADDR_ALL = 0x26U, /**< LSS 'lss_inquire_addr', all parameters */
     CO_GTWA_ST__LSS_FASTSCAN = 0x30U,        /**< LSS '_lss_fastscan' */
     CO_GTWA_ST_LSS_ALLNODES = 0x31U,         /**< LSS 'lss_allnodes' */
+    CO_GTWA_ST_BIN_READ = 0x40U,             /**< SDO upload, binary frame */
+    CO_GTWA_ST_BIN_WRITE = 0x41U,            /**< SDO download, binary frame */
+    CO_GTWA_ST_BIN_SKIP = 0x42U,             /**< Binary frame not accepted, purging remaining payload */
+    CO_GTWA_ST_BULK = 0x50U,                 /**< SDO 'bulk', batch runs in SDO bulk engine */
     CO_GTWA_ST_LOG = 0x80U,                  /**< print message 'log' */
     CO_GTWA_ST_HELP = 0x81U,                 /**< print 'help' text */
-    CO_GTWA_ST_LED = 0x82U                   /**< print 'status' of the node */
+    CO_GTWA_ST_LED = 0x82U,                  /**< print 'status' of the node */
+    CO_GTWA_ST_NODES = 0x83U,                /**< print 'nodes' table or log */
+    CO_GTWA_ST_EMCY = 0x84U                  /**< print 'emcy' table or history */
 } CO_GTWA_state_t;
 
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
@@ -223,6 +380,77 @@ typedef struct {
 } CO_GTWA_dataType_t;
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SDO */
 
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
+/**
+ * Pool of SDO client objects, shared by multiple Gateway-ascii objects
+ */
+typedef struct {
+    CO_SDOclient_t* SDO_C; /**< Array of SDO client objects */
+    uint8_t count;         /**< Number of SDO client objects in array, 1 to 32 */
+    uint32_t busy;         /**< Bitmask of SDO client objects currently used by Gateway-ascii objects */
+} CO_GTWA_SDOpool_t;
+#endif
+
+#if ((((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0))     \
+    || defined CO_DOXYGEN
+/** Maximum size of the value in 'bulk' command in bytes */
+#define CO_GTWA_BULK_DATA_SIZE 8U
+
+/**
+ * SDO bulk engine with operations for 'bulk' command, shared by multiple Gateway-ascii objects
+ */
+typedef struct {
+    CO_SDObulk_t* bulk;                        /**< SDO bulk engine, see @ref CO_SDObulk */
+    const void* owner;                         /**< Gateway-ascii object, which runs 'bulk' command, or NULL */
+    CO_SDObulk_op_t ops[127];                  /**< One operation per node */
+    uint8_t data[127][CO_GTWA_BULK_DATA_SIZE]; /**< Upload data of each operation or download value in data[0] */
+} CO_GTWA_SDObulk_t;
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0) || defined CO_DOXYGEN
+/**
+ * Owner of the LSS master object, shared by multiple Gateway-ascii objects
+ */
+typedef struct {
+    const void* owner; /**< Gateway-ascii object, which runs LSS command, or NULL */
+} CO_GTWA_LSSlock_t;
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0) || defined CO_DOXYGEN
+/** Maximum size of the subscribed value in bytes, same as size of the CAN message data */
+#define CO_GTWA_SUB_DATA_SIZE 8U
+
+/**
+ * Type of the subscription
+ */
+typedef enum {
+    CO_GTWA_SUB_NONE = 0U, /**< Subscription is not used */
+    CO_GTWA_SUB_OD = 1U,   /**< Entry in the Object Dictionary of this device, sampled periodically */
+    CO_GTWA_SUB_PDO = 2U   /**< PDO message, received from the CANopen network */
+} CO_GTWA_subType_t;
+
+/**
+ * Subscription in Gateway-ascii object, see 'sub' command
+ */
+typedef struct {
+    CO_GTWA_subType_t type;                                    /**< Type of the subscription */
+    OD_IO_t OD_IO;                                             /**< Subscribed OD entry, if type is CO_GTWA_SUB_OD */
+    uint16_t CANid;                                            /**< COB-ID, if type is CO_GTWA_SUB_PDO */
+    const CO_GTWA_dataType_t* dataType[CO_GTWA_SUB_DATA_SIZE]; /**< Data types for printing the value */
+    uint8_t dataTypeCount;                                     /**< Number of data types in dataType */
+    uint8_t dataLengthMin;                                     /**< Shorter PDO messages are ignored */
+    uint32_t interval_us;                                      /**< Minimum interval between notifications */
+    uint64_t lastTime_us;                                      /**< Time of last notification */
+    uint64_t timestamp_us;                                     /**< Time, when value was received or changed */
+    bool_t pending;                                            /**< True, if value is not yet notified */
+    uint8_t valueLength;                                       /**< Length of value */
+    uint8_t value[CO_GTWA_SUB_DATA_SIZE];                      /**< Latest value */
+    volatile void* CANrxNew;                                   /**< Flag, set by the PDO receive callback */
+    uint8_t CANrxDLC;                                          /**< Length of received PDO */
+    uint8_t CANrxData[CO_GTWA_SUB_DATA_SIZE];                  /**< Data of received PDO */
+} CO_GTWA_sub_t;
+#endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_SUBSCRIBE */
+
 /**
  * CANopen Gateway-ascii object
  */
@@ -258,19 +486,30 @@ typedef struct {
     CO_GTWA_state_t state;                 /**< Current state of the gateway object */
     uint32_t stateTimeoutTmr;              /**< Timeout timer for the current state */
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
-    CO_SDOclient_t* SDO_C;         /**< SDO client object from CO_GTWA_init() */
+    CO_SDOclient_t* SDO_C;         /**< SDO client object from CO_GTWA_init() or from SDOpool */
+    CO_GTWA_SDOpool_t* SDOpool;    /**< Pool of SDO clients from CO_GTWA_initSDOpool() or NULL */
+    uint8_t SDOpoolIdx;            /**< Index of SDO client acquired from SDOpool or 0xFF if none */
     uint16_t SDOtimeoutTime;       /**< Timeout time for SDO transfer in milliseconds, if no response */
     bool_t SDOblockTransferEnable; /**< SDO block transfer enabled? */
     bool_t SDOdataCopyStatus; /**< Indicate status of data copy from / to SDO buffer. If reading, true indicates, that
                                  response has started. If writing, true indicates, that SDO buffer contains only part of
                                  data and more data will follow. */
     const CO_GTWA_dataType_t* SDOdataType; /**< Data type of variable in current SDO communication */
+    bool_t SDOmultiActive; /**< 'mread' or 'mwrite': true, if SDO transfer of the current object is in progress */
+    bool_t SDOmultiLast;   /**< 'mread' or 'mwrite': true, if the current object is the last in the command */
+#endif
+#if ((((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0))     \
+    || defined CO_DOXYGEN
+    CO_GTWA_SDObulk_t* SDObulk; /**< Shared SDO bulk engine from CO_GTWA_initSDObulk() or NULL */
+    uint8_t bulkCount;          /**< 'bulk': number of operations (nodes) in the command */
+    uint8_t bulkNext;           /**< 'bulk': next operation to print */
 #endif
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NMT) != 0) || defined CO_DOXYGEN
     CO_NMT_t* NMT; /**< NMT object from CO_GTWA_init() */
 #endif
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0) || defined CO_DOXYGEN
     CO_LSSmaster_t* LSSmaster;           /**< LSSmaster object from CO_GTWA_init() */
+    CO_GTWA_LSSlock_t* LSSlock;          /**< Shared owner of LSSmaster from CO_GTWA_initLSSlock() or NULL */
     CO_LSS_address_t lssAddress;         /**< 128 bit number, uniquely identifying each node */
     uint8_t lssNID;                      /**< LSS Node-ID parameter */
     uint16_t lssBitrate;                 /**< LSS bitrate parameter */
@@ -280,6 +519,27 @@ typedef struct {
     uint8_t lssNodeCount;                /**< LSS allnodes node count parameter */
     bool_t lssStore;                     /**< LSS allnodes store parameter */
     uint16_t lssTimeout_ms;              /**< LSS allnodes timeout parameter */
+    CO_LSSmaster_scantype_t lssScan[4];  /**< LSS allnodes scan types given by user. After node is found, its vendor-ID,
+                                            product code and revision number are matched for the next node. */
+    bool_t lssMatchFound;                /**< LSS allnodes uses values from previously found node */
+    uint32_t lssTime_us;                 /**< LSS allnodes elapsed time for progress report */
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_BINARY) != 0) || defined CO_DOXYGEN
+    bool_t binary;                                /**< True, if current command is binary frame */
+    uint8_t binHdr[CO_GTWA_BIN_HEADER_SIZE];      /**< Header of current binary request frame */
+    size_t binRemain;                             /**< Payload bytes of current frame, not yet read from commFifo */
+    bool_t binBatchActive;                        /**< True, if batch is in progress */
+    uint8_t binBatchHdr[CO_GTWA_BIN_HEADER_SIZE]; /**< Header of current batch request frame */
+    size_t binBatchRemain;                        /**< Payload bytes of current batch, not yet read from commFifo */
+    uint16_t binBatchOk;                          /**< Number of successful requests in current batch */
+    uint16_t binBatchErr;                         /**< Number of failed requests in current batch */
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0) || defined CO_DOXYGEN
+    CO_GTWA_sub_t sub[CO_CONFIG_GTWA_SUBSCRIPTIONS]; /**< Subscriptions of this session */
+    OD_t* OD;                                        /**< Object Dictionary from CO_GTWA_initSubscriptions() */
+    CO_CANmodule_t* CANdevRx;                        /**< CAN device from CO_GTWA_initSubscriptions() */
+    uint16_t CANdevRxIdx;                            /**< CAN device buffer index from CO_GTWA_initSubscriptions() */
+    uint64_t subTime_us;                             /**< Time for subscription timestamps, microseconds */
 #endif
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LOG) != 0) || defined CO_DOXYGEN
     uint8_t logBuf[CO_CONFIG_GTWA_LOG_BUF_SIZE + 1]; /**< Message log buffer of usable size
@@ -294,6 +554,16 @@ typedef struct {
     CO_LEDs_t* LEDs; /**< CO_LEDs_t object for CANopen status LEDs imitation from CO_GTWA_init() */
     uint8_t ledStringPreviousIndex;
 #endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0) || defined CO_DOXYGEN
+    CO_HBconsumer_netTable_t* netTable; /**< Network state table from CO_GTWA_initNetTable() */
+    uint32_t nodesNext;                 /**< 'nodes': next node-ID or log sequence to print */
+    bool_t nodesLog;                    /**< 'nodes': true, if log is printed */
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0) || defined CO_DOXYGEN
+    CO_EM_t* em;       /**< Emergency object from CO_GTWA_initEmcy() */
+    uint32_t emcyNext; /**< 'emcy': next entry or history sequence to print */
+    bool_t emcyHist;   /**< 'emcy': true, if history is printed */
+#endif
 } CO_GTWA_t;
 
 /**
@@ -325,6 +595,91 @@ CO_ReturnError_t CO_GTWA_init(CO_GTWA_t* gtwa,
 #endif
                               uint8_t dummy);
 
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize pool of SDO clients in Gateway-ascii object
+ *
+ * If pool is configured, SDO client from CO_GTWA_init() is not used. Instead, free SDO client is acquired from the pool
+ * for the duration of each command. The same pool can be shared by many Gateway-ascii objects.
+ *
+ * @param gtwa This object
+ * @param SDOpool Pool of SDO clients with initialized SDO_C and count, or NULL to disable the pool.
+ */
+void CO_GTWA_initSDOpool(CO_GTWA_t* gtwa, CO_GTWA_SDOpool_t* SDOpool);
+#endif
+
+#if ((((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0))     \
+    || defined CO_DOXYGEN
+/**
+ * Initialize SDO bulk engine in Gateway-ascii object
+ *
+ * Function must be called after CO_GTWA_init(). If function is not called, 'bulk' command is not supported. The same
+ * object can be shared by many Gateway-ascii objects, one of them may run 'bulk' command at a time. Engine must be
+ * processed in the same thread as CO_GTWA_process().
+ *
+ * @param gtwa This object
+ * @param SDObulk Object with initialized SDO bulk engine, or NULL to disable 'bulk' command.
+ */
+void CO_GTWA_initSDObulk(CO_GTWA_t* gtwa, CO_GTWA_SDObulk_t* SDObulk);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize owner of the shared LSS master in Gateway-ascii object
+ *
+ * Function must be called after CO_GTWA_init(), if the same LSS master object is used by many Gateway-ascii objects.
+ * Session, which starts LSS command, owns LSS master until the command is finished. LSS commands from other sessions
+ * are rejected with error 102 meanwhile.
+ *
+ * @param gtwa This object
+ * @param LSSlock Object shared by all Gateway-ascii objects with the same LSS master, or NULL to disable the check.
+ */
+void CO_GTWA_initLSSlock(CO_GTWA_t* gtwa, CO_GTWA_LSSlock_t* LSSlock);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize subscriptions in Gateway-ascii object
+ *
+ * Function must be called after CO_GTWA_init(). Subscriptions are cancelled. If function is not called, 'sub' command
+ * is not supported.
+ *
+ * @param gtwa This object
+ * @param OD Object Dictionary of this device, used with 'sub od' command.
+ * @param CANdevRx CAN device for PDO reception.
+ * @param CANdevRxIdx Index of the first of @ref CO_CONFIG_GTWA_SUBSCRIPTIONS receive buffers in CANdevRx.
+ *
+ * @return #CO_ReturnError_t: CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_GTWA_initSubscriptions(CO_GTWA_t* gtwa, OD_t* OD, CO_CANmodule_t* CANdevRx, uint16_t CANdevRxIdx);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize network state table in Gateway-ascii object
+ *
+ * Function must be called after CO_GTWA_init(). If function is not called, 'nodes' command is not supported.
+ *
+ * @param gtwa This object
+ * @param netTable Network state table, see @ref CO_HBconsumer_initNetTable(). Table is only read by the gateway, so
+ * CO_GTWA_process() and CO_HBconsumer_process() must run in the same thread.
+ */
+void CO_GTWA_initNetTable(CO_GTWA_t* gtwa, CO_HBconsumer_netTable_t* netTable);
+#endif
+
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize emergency consumer in Gateway-ascii object
+ *
+ * Function must be called after CO_GTWA_init(). If function is not called, 'emcy' command is not supported.
+ *
+ * @param gtwa This object
+ * @param em Emergency object with aggregated messages, see @ref CO_EM_consEntry_t. Object is only read by the gateway,
+ * so CO_GTWA_process() and CO_EM_process() must run in the same thread.
+ */
+void CO_GTWA_initEmcy(CO_GTWA_t* gtwa, CO_EM_t* em);
+#endif
+
 /**
  * Initialize read callback in Gateway-ascii object
  *
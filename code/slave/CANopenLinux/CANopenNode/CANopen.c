@@ -65,6 +65,11 @@
 #else
 #define CO_RX_CNT_HB_CONS 0
 #endif
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0) && (CO_RX_CNT_HB_CONS > 0)
+#define CO_RX_CNT_HB_NET 1
+#else
+#define CO_RX_CNT_HB_NET 0
+#endif
 
 #if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE) != 0
 #define CO_RX_CNT_NG_SLV 1
@@ -252,7 +257,12 @@
 #define CO_TX_CNT_LSS_MST OD_CNT_LSS_MST
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-#define OD_CNT_GTWA 1
+#define OD_CNT_GTWA CO_CONFIG_GTWA_SESSIONS
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0) && (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0)
+#define CO_RX_CNT_GTWA_SUB (OD_CNT_GTWA * CO_CONFIG_GTWA_SUBSCRIPTIONS)
+#else
+#define CO_RX_CNT_GTWA_SUB 0
 #endif
 
 #if (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE
@@ -279,7 +289,9 @@
 #define CO_RX_IDX_NG_MST   (CO_RX_IDX_NG_SLV + (uint16_t)CO_RX_CNT_NG_SLV)
 #define CO_RX_IDX_LSS_SLV  (CO_RX_IDX_NG_MST + (uint16_t)CO_RX_CNT_NG_MST)
 #define CO_RX_IDX_LSS_MST  (CO_RX_IDX_LSS_SLV + (uint16_t)CO_RX_CNT_LSS_SLV)
-#define CO_CNT_ALL_RX_MSGS (CO_RX_IDX_LSS_MST + (uint16_t)CO_RX_CNT_LSS_MST)
+#define CO_RX_IDX_GTWA_SUB (CO_RX_IDX_LSS_MST + (uint16_t)CO_RX_CNT_LSS_MST)
+#define CO_RX_IDX_HB_NET   (CO_RX_IDX_GTWA_SUB + (uint16_t)CO_RX_CNT_GTWA_SUB)
+#define CO_CNT_ALL_RX_MSGS (CO_RX_IDX_HB_NET + (uint16_t)CO_RX_CNT_HB_NET)
 
 #define CO_TX_IDX_NMT_MST  0U
 #define CO_TX_IDX_GFC      (CO_TX_IDX_NMT_MST + (uint16_t)CO_TX_CNT_NMT_MST)
@@ -298,6 +310,27 @@
 #define CO_CNT_ALL_TX_MSGS (CO_TX_IDX_LSS_MST + (uint16_t)CO_TX_CNT_LSS_MST)
 #endif /* #ifdef #else CO_MULTIPLE_OD */
 
+/* SDO clients used by SDO bulk engine: the last CO_SDO_CLI_BULK_CNT SDO clients, from CO_SDO_CLI_BULK_FIRST on. If
+ * gateway uses SDO, first SDO client is always left to it. */
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+#define CO_SDO_CLI_BULK_AVAIL ((CO_GET_CNT(SDO_CLI) > 0U) ? (CO_GET_CNT(SDO_CLI) - 1U) : 0U)
+#else
+#define CO_SDO_CLI_BULK_AVAIL CO_GET_CNT(SDO_CLI)
+#endif
+#define CO_SDO_CLI_BULK_CNT                                                                                            \
+    ((CO_SDO_CLI_BULK_AVAIL < CO_CONFIG_SDO_CLI_BULK_COUNT) ? CO_SDO_CLI_BULK_AVAIL : CO_CONFIG_SDO_CLI_BULK_COUNT)
+#define CO_SDO_CLI_BULK_FIRST (CO_GET_CNT(SDO_CLI) - CO_SDO_CLI_BULK_CNT)
+#else
+#define CO_SDO_CLI_BULK_FIRST CO_GET_CNT(SDO_CLI)
+#endif
+
+/* Number of SDO clients in the pool, shared by gateway-ascii sessions: SDOclient[0] ... SDOclient[CO_GTWA_SDO_CNT-1],
+ * up to one per session. SDO clients of the bulk engine are excluded. */
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+#define CO_GTWA_SDO_CNT ((CO_GET_CNT(GTWA) < CO_SDO_CLI_BULK_FIRST) ? CO_GET_CNT(GTWA) : CO_SDO_CLI_BULK_FIRST)
+#endif
+
 /* Objects from heap **********************************************************/
 #ifndef CO_USE_GLOBALS
 #include <stdlib.h>
@@ -319,6 +352,136 @@
 
 #endif
 
+#ifdef CO_USE_ARENA
+/* Arena allocation strategy **************************************************/
+#ifndef CO_arena_alloc
+/* Allocate zeroed block, aligned to CO_ARENA_ALIGN. Pointer from calloc() is stored in front of the block. */
+static void*
+CO_arena_allocDefault(size_t size) {
+    uint8_t* raw = calloc(1U, size + CO_ARENA_ALIGN + sizeof(void*));
+    if (raw == NULL) {
+        return NULL;
+    }
+    uintptr_t aligned = ((uintptr_t)raw + sizeof(void*) + CO_ARENA_ALIGN - 1U) & ~(uintptr_t)(CO_ARENA_ALIGN - 1U);
+    ((void**)aligned)[-1] = raw;
+    return (void*)aligned;
+}
+
+static void
+CO_arena_freeDefault(void* ptr) {
+    if (ptr != NULL) {
+        free(((void**)ptr)[-1]);
+    }
+}
+
+#define CO_arena_alloc(size) CO_arena_allocDefault(size)
+#define CO_arena_free(ptr)   CO_arena_freeDefault(ptr)
+#endif
+
+/* Objects are freed together with the arena */
+#undef CO_free
+#define CO_free(ptr) (void)(ptr)
+
+/* Objects reserved inside CO_new(), before the arena is allocated */
+typedef struct {
+    CO_t* co;      /* temporary CANopen object, its contents is copied into arena */
+    uint8_t count; /* number of reserved objects, including CANopen object */
+    struct {
+        const char* name;
+        uint32_t size;
+        size_t slot; /* offset of the pointer to the object inside CO_t */
+    } res[CO_ARENA_ENTRIES];
+} CO_arenaReserve_t;
+
+/* Objects used on each received CAN message and in realtime processing, placed first after CO_t, in this order */
+static const char* const CO_arenaHot[] = {"CANrx", "CANmodule", "CANtx", "SYNC", "RPDO", "TPDO", "SRDOGuard", "SRDO"};
+
+/* Reserve object for the arena. First reserved object must be CANopen object, which is allocated temporary. */
+static bool_t
+CO_arena_reserve(CO_arenaReserve_t* ar, void* slot, size_t num, size_t size, const char* name) {
+    if (ar->count >= CO_ARENA_ENTRIES) {
+        return false;
+    }
+    if (ar->co == NULL) {
+        ar->co = calloc(1U, sizeof(CO_t));
+        if (ar->co == NULL) {
+            return false;
+        }
+        (void)memcpy(slot, (void*)&ar->co, sizeof(void*));
+    } else {
+        ar->res[ar->count].slot = (size_t)((uint8_t*)slot - (uint8_t*)ar->co);
+    }
+    if (strncmp(name, "co->", 4) == 0) {
+        name += 4;
+    }
+    ar->res[ar->count].name = name;
+    ar->res[ar->count].size = (uint32_t)(num * size);
+    ar->count++;
+    return true;
+}
+
+/* Calculate layout, allocate the arena and move reserved objects into it. Return CANopen object inside arena. */
+static CO_t*
+CO_arena_commit(CO_arenaReserve_t* ar) {
+    uint8_t order[CO_ARENA_ENTRIES];
+    bool_t placed[CO_ARENA_ENTRIES] = {false};
+    uint8_t n = 0;
+    uint32_t size = 0;
+
+    /* CANopen object first, then hot objects, then others in the order of reservation */
+    order[n++] = 0;
+    placed[0] = true;
+    for (uint8_t h = 0; h < (sizeof(CO_arenaHot) / sizeof(CO_arenaHot[0])); h++) {
+        for (uint8_t i = 1; i < ar->count; i++) {
+            if (!placed[i] && strcmp(ar->res[i].name, CO_arenaHot[h]) == 0) {
+                order[n++] = i;
+                placed[i] = true;
+            }
+        }
+    }
+    for (uint8_t i = 1; i < ar->count; i++) {
+        if (!placed[i]) {
+            order[n++] = i;
+        }
+    }
+
+    for (uint8_t i = 0; i < n; i++) {
+        size += (ar->res[order[i]].size + CO_ARENA_ALIGN - 1U) & ~(uint32_t)(CO_ARENA_ALIGN - 1U);
+    }
+    uint8_t* arena = CO_arena_alloc(size);
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    CO_t* co = (CO_t*)arena;
+    (void)memcpy(co, ar->co, sizeof(CO_t));
+    co->arena = arena;
+    co->arenaSize = size;
+    co->arenaEntries = n;
+    uint32_t offset = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t r = order[i];
+        void* ptr = &arena[offset];
+        if (r != 0U) {
+            (void)memcpy((uint8_t*)co + ar->res[r].slot, (void*)&ptr, sizeof(void*));
+        }
+        co->arenaLayout[i].name = ar->res[r].name;
+        co->arenaLayout[i].offset = offset;
+        co->arenaLayout[i].size = ar->res[r].size;
+        offset += (ar->res[r].size + CO_ARENA_ALIGN - 1U) & ~(uint32_t)(CO_ARENA_ALIGN - 1U);
+    }
+    return co;
+}
+
+/* Define macros for allocation. Inside CO_new() objects are only reserved, see CO_arena_commit(). */
+#define CO_alloc_break_on_fail(var, num, size)                                                                         \
+    {                                                                                                                  \
+        if (!CO_arena_reserve(&arenaReserve, (void*)&(var), (num), (size), #var)) {                                    \
+            break;                                                                                                     \
+        }                                                                                                              \
+        mem += (size) * (num);                                                                                         \
+    }
+#else
 /* Define macros for allocation */
 #define CO_alloc_break_on_fail(var, num, size)                                                                         \
     {                                                                                                                  \
@@ -329,6 +492,7 @@
             break;                                                                                                     \
         }                                                                                                              \
     }
+#endif /* CO_USE_ARENA */
 
 #ifdef CO_MULTIPLE_OD
 #define ON_MULTI_OD(sentence) sentence
@@ -342,6 +506,9 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
     /* return values */
     CO_t* coFinal = NULL;
     uint32_t mem = 0;
+#ifdef CO_USE_ARENA
+    CO_arenaReserve_t arenaReserve = {0};
+#endif
 
     /* For each object:
      * - allocate memory, verify allocation and calculate size of heap used
@@ -356,7 +523,8 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
         if (config == NULL || config->CNT_NMT > 1 || config->CNT_HB_CONS > 1 || config->CNT_EM > 1
             || config->CNT_SDO_SRV > 128 || config->CNT_SDO_CLI > 128 || config->CNT_SYNC > 1 || config->CNT_RPDO > 512
             || config->CNT_TPDO > 512 || config->CNT_TIME > 1 || config->CNT_LEDS > 1 || config->CNT_GFC > 1
-            || config->CNT_SRDO > 64 || config->CNT_LSS_SLV > 1 || config->CNT_LSS_MST > 1 || config->CNT_GTWA > 1) {
+            || config->CNT_SRDO > 64 || config->CNT_LSS_SLV > 1 || config->CNT_LSS_MST > 1
+            || config->CNT_GTWA > CO_CONFIG_GTWA_SESSIONS) {
             break;
         }
 #else
@@ -385,11 +553,18 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
 
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
         ON_MULTI_OD(uint8_t RX_CNT_HB_CONS = 0);
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+        ON_MULTI_OD(uint8_t RX_CNT_HB_NET = 0);
+#endif
         if (CO_GET_CNT(HB_CONS) == 1U) {
             uint8_t countOfMonitoredNodes = CO_GET_CNT(ARR_1016);
             CO_alloc_break_on_fail(co->HBcons, CO_GET_CNT(HB_CONS), sizeof(*co->HBcons));
             CO_alloc_break_on_fail(co->HBconsMonitoredNodes, countOfMonitoredNodes, sizeof(*co->HBconsMonitoredNodes));
             ON_MULTI_OD(RX_CNT_HB_CONS = countOfMonitoredNodes);
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+            CO_alloc_break_on_fail(co->HBconsNetTable, 1, sizeof(*co->HBconsNetTable));
+            ON_MULTI_OD(RX_CNT_HB_NET = 1);
+#endif
         }
 #endif
 
@@ -437,6 +612,17 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
             ON_MULTI_OD(RX_CNT_SDO_CLI = config->CNT_SDO_CLI);
             ON_MULTI_OD(TX_CNT_SDO_CLI = config->CNT_SDO_CLI);
         }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+        if (CO_GET_CNT(SDO_CLI) > 0U) {
+            CO_alloc_break_on_fail(co->SDOclientNodeStat, CO_SDO_CLI_NODE_STAT_COUNT,
+                                   sizeof(*co->SDOclientNodeStat));
+        }
+#endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+        if (CO_GET_CNT(SDO_CLI) > CO_SDO_CLI_BULK_FIRST) {
+            CO_alloc_break_on_fail(co->SDObulk, 1, sizeof(*co->SDObulk));
+        }
+#endif
 #endif
 
 #if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_ENABLE) != 0
@@ -527,8 +713,14 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
 #endif
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-        if (CO_GET_CNT(GTWA) == 1U) {
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+        ON_MULTI_OD(uint16_t RX_CNT_GTWA_SUB = 0);
+#endif
+        if (CO_GET_CNT(GTWA) > 0U) {
             CO_alloc_break_on_fail(co->gtwa, CO_GET_CNT(GTWA), sizeof(*co->gtwa));
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+            ON_MULTI_OD(RX_CNT_GTWA_SUB = CO_GET_CNT(GTWA) * CO_CONFIG_GTWA_SUBSCRIPTIONS);
+#endif
         }
 #endif
 
@@ -591,6 +783,15 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
 #if ((CO_CONFIG_LSS)&CO_CONFIG_LSS_MASTER) != 0
         co->RX_IDX_LSS_MST = idxRx;
         idxRx += RX_CNT_LSS_MST;
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0) && (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0)
+        co->RX_IDX_GTWA_SUB = idxRx;
+        idxRx += RX_CNT_GTWA_SUB;
+#endif
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+        /* catch-all heartbeat buffer must be after all other buffers, which receive heartbeat messages */
+        co->RX_IDX_HB_NET = idxRx;
+        idxRx += RX_CNT_HB_NET;
 #endif
         co->CNT_ALL_RX_MSGS = idxRx;
 
@@ -660,9 +861,17 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
         coFinal = co;
     } while (false);
 
+#ifdef CO_USE_ARENA
+    if (coFinal != NULL) {
+        coFinal = CO_arena_commit(&arenaReserve);
+        mem = (coFinal != NULL) ? coFinal->arenaSize : mem;
+    }
+    free(arenaReserve.co);
+#else
     if (coFinal == NULL) {
         CO_delete(co);
     }
+#endif
     if (heapMemoryUsed != NULL) {
         *heapMemoryUsed = mem;
     }
@@ -728,6 +937,12 @@ CO_delete(CO_t* co) {
 #endif
 
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+    CO_free(co->SDObulk);
+#endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+    CO_free(co->SDOclientNodeStat);
+#endif
     CO_free(co->SDOclient);
 #endif
 
@@ -748,6 +963,9 @@ CO_delete(CO_t* co) {
 #endif
 
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+    CO_free(co->HBconsNetTable);
+#endif
     CO_free(co->HBconsMonitoredNodes);
     CO_free(co->HBcons);
 #endif
@@ -756,7 +974,11 @@ CO_delete(CO_t* co) {
     CO_free(co->NMT);
 
     /* CANopen object */
+#ifdef CO_USE_ARENA
+    CO_arena_free(co->arena);
+#else
     CO_free(co);
+#endif
 }
 #endif /* #ifndef CO_USE_GLOBALS */
 
@@ -765,6 +987,9 @@ CO_delete(CO_t* co) {
 #ifdef CO_MULTIPLE_OD
 #error CO_MULTIPLE_OD can not be used with CO_USE_GLOBALS
 #endif
+#ifdef CO_USE_ARENA
+#error CO_USE_ARENA can not be used with CO_USE_GLOBALS
+#endif
 static CO_t COO;
 static CO_CANmodule_t COO_CANmodule;
 static CO_CANrx_t COO_CANmodule_rxArray[CO_CNT_ALL_RX_MSGS];
@@ -773,6 +998,9 @@ static CO_NMT_t COO_NMT;
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
 static CO_HBconsumer_t COO_HBcons;
 static CO_HBconsNode_t COO_HBconsMonitoredNodes[OD_CNT_ARR_1016];
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+static CO_HBconsumer_netTable_t COO_HBconsNetTable;
+#endif
 #endif
 #if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE) != 0
 static CO_nodeGuardingSlave_t COO_NGslave;
@@ -787,6 +1015,12 @@ static CO_EM_fifo_t COO_EM_FIFO[CO_GET_CNT(ARR_1003) + 1U];
 static CO_SDOserver_t COO_SDOserver[OD_CNT_SDO_SRV];
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
 static CO_SDOclient_t COO_SDOclient[OD_CNT_SDO_CLI];
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+static CO_SDObulk_t COO_SDObulk;
+#endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+static CO_SDOclient_nodeStat_t COO_SDOclientNodeStat[CO_SDO_CLI_NODE_STAT_COUNT];
+#endif
 #endif
 #if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_ENABLE) != 0
 static CO_TIME_t COO_TIME;
@@ -817,15 +1051,10 @@ static CO_LSSslave_t COO_LSSslave;
 static CO_LSSmaster_t COO_LSSmaster;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-static CO_GTWA_t COO_gtwa;
-#endif
-#if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) != 0
-#ifndef CO_TRACE_BUFFER_SIZE_FIXED
-#define CO_TRACE_BUFFER_SIZE_FIXED 100
+static CO_GTWA_t COO_gtwa[OD_CNT_GTWA];
 #endif
+#if (((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) != 0) && (OD_CNT_TRACE > 0)
 static CO_trace_t COO_trace[OD_CNT_TRACE];
-static uint32_t COO_traceTimeBuffers[OD_CNT_TRACE][CO_TRACE_BUFFER_SIZE_FIXED];
-static int32_t COO_traceValueBuffers[OD_CNT_TRACE][CO_TRACE_BUFFER_SIZE_FIXED];
 #endif
 
 CO_t*
@@ -843,6 +1072,9 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
     co->HBcons = &COO_HBcons;
     co->HBconsMonitoredNodes = &COO_HBconsMonitoredNodes[0];
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+    co->HBconsNetTable = &COO_HBconsNetTable;
+#endif
 #endif
 #if ((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE) != 0
     co->NGslave = &COO_NGslave;
@@ -857,6 +1089,12 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
     co->SDOserver = &COO_SDOserver[0];
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
     co->SDOclient = &COO_SDOclient[0];
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+    co->SDObulk = (CO_GET_CNT(SDO_CLI) > CO_SDO_CLI_BULK_FIRST) ? &COO_SDObulk : NULL;
+#endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+    co->SDOclientNodeStat = &COO_SDOclientNodeStat[0];
+#endif
 #endif
 #if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_ENABLE) != 0
     co->TIME = &COO_TIME;
@@ -887,13 +1125,14 @@ CO_new(CO_config_t* config, uint32_t* heapMemoryUsed) {
     co->LSSmaster = &COO_LSSmaster;
 #endif
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-    co->gtwa = &COO_gtwa;
+    co->gtwa = &COO_gtwa[0];
 #endif
 #if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) != 0
+#if OD_CNT_TRACE > 0
     co->trace = &COO_trace[0];
-    co->traceTimeBuffers = &COO_traceTimeBuffers[0][0];
-    co->traceValueBuffers = &COO_traceValueBuffers[0][0];
-    co->traceBufferSize = CO_TRACE_BUFFER_SIZE_FIXED;
+#else
+    co->trace = NULL;
+#endif
 #endif
 
     return co;
@@ -1056,6 +1295,12 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
         if (err != CO_ERROR_NO) {
             return err;
         }
+#if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0
+        err = CO_HBconsumer_initNetTable(co->HBcons, co->HBconsNetTable, co->CANmodule, CO_GET_CO(RX_IDX_HB_NET));
+        if (err != CO_ERROR_NO) {
+            return err;
+        }
+#endif
     }
 #endif
 
@@ -1101,8 +1346,20 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
             if (err != CO_ERROR_NO) {
                 return err;
             }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0
+            CO_SDOclient_initNodeStat(&co->SDOclient[i], co->SDOclientNodeStat);
+#endif
         }
     }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+    if (co->SDObulk != NULL) {
+        err = CO_SDObulk_init(co->SDObulk, &co->SDOclient[CO_SDO_CLI_BULK_FIRST], CO_SDO_CLI_BULK_CNT,
+                              SDOclientTimeoutTime_ms, SDOclientBlockTransfer);
+        if (err != CO_ERROR_NO) {
+            return err;
+        }
+    }
+#endif
 #endif
 
 #if ((CO_CONFIG_TIME)&CO_CONFIG_TIME_ENABLE) != 0
@@ -1130,6 +1387,9 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
         if (err != CO_ERROR_NO) {
             return err;
         }
+#if ((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0
+        CO_SYNC_initStatistics(co->SYNC, OD_find(od, OD_INDEX_SYNC_STATISTICS));
+#endif
     }
 #endif
 
@@ -1144,8 +1404,20 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
 #endif
 
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-    if (CO_GET_CNT(GTWA) == 1U) {
-        err = CO_GTWA_init(co->gtwa,
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+    co->gtwaSDOpool.SDO_C = co->SDOclient;
+    co->gtwaSDOpool.count = CO_GTWA_SDO_CNT;
+    co->gtwaSDOpool.busy = 0;
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0)
+    co->gtwaSDObulk.bulk = co->SDObulk;
+    co->gtwaSDObulk.owner = NULL;
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+    co->gtwaLSSlock.owner = NULL;
+#endif
+    for (uint8_t i = 0; i < CO_GET_CNT(GTWA); i++) {
+        err = CO_GTWA_init(&co->gtwa[i],
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
                            &co->SDOclient[0], SDOclientTimeoutTime_ms, SDOclientBlockTransfer,
 #endif
@@ -1162,21 +1434,28 @@ CO_CANopenInit(CO_t* co, CO_NMT_t* NMT, CO_EM_t* em, OD_t* od, OD_entry_t* OD_st
         if (err != CO_ERROR_NO) {
             return err;
         }
-    }
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0
+        CO_GTWA_initSDOpool(&co->gtwa[i], &co->gtwaSDOpool);
 #endif
-
-#if (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE
-    if (CO_GET_CNT(TRACE) > 0) {
-        for (uint16_t i = 0; i < CO_GET_CNT(TRACE); i++) {
-            err = CO_trace_init(co->trace[i], co->SDO[0], OD_traceConfig[i].axisNo, CO_traceTimeBuffers[i],
-                                CO_traceValueBuffers[i], CO_traceBufferSize[i], &OD_traceConfig[i].map,
-                                &OD_traceConfig[i].format, &OD_traceConfig[i].trigger, &OD_traceConfig[i].threshold,
-                                &OD_trace[i].value, &OD_trace[i].min, &OD_trace[i].max, &OD_trace[i].triggerTime,
-                                OD_INDEX_TRACE_CONFIG + i, OD_INDEX_TRACE + i);
-            if (err) {
-                return err;
-            }
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0)
+        CO_GTWA_initSDObulk(&co->gtwa[i], &co->gtwaSDObulk);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0
+        CO_GTWA_initLSSlock(&co->gtwa[i], &co->gtwaLSSlock);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0
+        err = CO_GTWA_initSubscriptions(&co->gtwa[i], od, co->CANmodule,
+                                        CO_GET_CO(RX_IDX_GTWA_SUB) + (i * CO_CONFIG_GTWA_SUBSCRIPTIONS));
+        if (err != CO_ERROR_NO) {
+            return err;
         }
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_NODES) != 0
+        CO_GTWA_initNetTable(&co->gtwa[i], co->HBconsNetTable);
+#endif
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_EMCY) != 0
+        CO_GTWA_initEmcy(&co->gtwa[i], co->em);
+#endif
     }
 #endif
 
@@ -1369,9 +1648,18 @@ CO_process(CO_t* co, bool_t enableGateway, uint32_t timeDifference_us, uint32_t*
     }
     NMTisPreOrOperational = ((NMTstate == CO_NMT_PRE_OPERATIONAL) || (NMTstate == CO_NMT_OPERATIONAL));
 
-    /* SDOserver */
-    for (uint8_t i = 0; i < CO_GET_CNT(SDO_SRV); i++) {
-        (void)CO_SDOserver_process(&co->SDOserver[i], NMTisPreOrOperational, timeDifference_us, timerNext_us);
+    /* SDOserver. Each channel sends at most one segment per call. Start with a different channel each time, so with
+     * full CAN transmit queue the same channel does not always win and concurrent transfers progress evenly. */
+    if (CO_GET_CNT(SDO_SRV) > 0U) {
+        uint8_t i = co->SDOserverFirst;
+        if (i >= CO_GET_CNT(SDO_SRV)) {
+            i = 0;
+        }
+        co->SDOserverFirst = ((uint16_t)i + 1U < CO_GET_CNT(SDO_SRV)) ? (i + 1U) : 0U;
+        for (uint16_t n = 0; n < CO_GET_CNT(SDO_SRV); n++) {
+            (void)CO_SDOserver_process(&co->SDOserver[i], NMTisPreOrOperational, timeDifference_us, timerNext_us);
+            i = ((uint16_t)i + 1U < CO_GET_CNT(SDO_SRV)) ? (i + 1U) : 0U;
+        }
     }
 
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
@@ -1394,9 +1682,14 @@ CO_process(CO_t* co, bool_t enableGateway, uint32_t timeDifference_us, uint32_t*
     }
 #endif
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+    /* before the gateway, so 'bulk' command sees finished batch in the same cycle */
+    (void)CO_SDObulk_process(co->SDObulk, timeDifference_us, timerNext_us);
+#endif
+
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
-    if (CO_GET_CNT(GTWA) == 1U) {
-        CO_GTWA_process(co->gtwa, enableGateway, timeDifference_us, timerNext_us);
+    for (uint8_t i = 0; i < CO_GET_CNT(GTWA); i++) {
+        CO_GTWA_process(&co->gtwa[i], enableGateway, timeDifference_us, timerNext_us);
     }
 #endif
 
@@ -40,6 +40,7 @@
 #include "305/CO_LSSmaster.h"
 #include "309/CO_gateway_ascii.h"
 #include "extra/CO_trace.h"
+#include "extra/CO_SDObulk.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -170,6 +171,40 @@ extern "C" {
 #define CO_USE_GLOBALS
 #endif
 
+/**
+ * If macro is defined externally, then CO_new() allocates all CANopenNode objects from one contiguous block of memory
+ * (arena) instead of separate heap allocations. CO_new() first reserves all objects, then it calculates the layout,
+ * where each object is aligned to @ref CO_ARENA_ALIGN. Objects used on each received CAN message and in realtime processing
+ * (CO_t, CANrx, CANmodule, CANtx, SYNC, RPDO, TPDO, SRDO) are placed first, so they share as few cache lines and memory
+ * pages as possible. Layout is available in @ref CO_t::arenaLayout.
+ *
+ * Target may define CO_arena_alloc(size) and CO_arena_free(ptr), which must return memory, filled with zeros and
+ * aligned to CO_ARENA_ALIGN. Otherwise calloc() is used. CO_USE_ARENA can not be used with CO_USE_GLOBALS.
+ */
+#ifdef CO_DOXYGEN
+#define CO_USE_ARENA
+#endif
+
+#if defined CO_USE_ARENA || defined CO_DOXYGEN
+/** Alignment of each object inside arena, size of the cache line */
+#ifndef CO_ARENA_ALIGN
+#define CO_ARENA_ALIGN 64U
+#endif
+/** Maximum number of objects inside arena, one for each allocation in CO_new() */
+#ifndef CO_ARENA_ENTRIES
+#define CO_ARENA_ENTRIES 40U
+#endif
+
+/**
+ * Position of one object inside arena, see @ref CO_USE_ARENA
+ */
+typedef struct {
+    const char* name; /**< Name of the object (member of CO_t) */
+    uint32_t offset;  /**< Offset of the object from the start of the arena */
+    uint32_t size;    /**< Size of the object (all elements of the array) in bytes */
+} CO_arenaEntry_t;
+#endif
+
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
 /**
  * CANopen configuration, used with @ref CO_new()
@@ -227,7 +262,7 @@ typedef struct {
     OD_entry_t* ENTRY_H13FF; /**< OD entry for @ref CO_SRDO_init() */
     uint8_t CNT_LSS_SLV;     /**< Number of LSSslave objects, 0 or 1 (CANrx + CANtx). */
     uint8_t CNT_LSS_MST;     /**< Number of LSSmaster objects, 0 or 1 (CANrx + CANtx). */
-    uint8_t CNT_GTWA;        /**< Number of gateway ascii objects, 0 or 1. */
+    uint8_t CNT_GTWA;        /**< Number of gateway ascii objects (sessions), 0 to @ref CO_CONFIG_GTWA_SESSIONS. */
     uint16_t CNT_TRACE;      /**< Number of trace objects, 0 or more. */
 } CO_config_t;
 #else
@@ -261,6 +296,13 @@ typedef struct {
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
     uint16_t RX_IDX_HB_CONS; /**< Start index in CANrx. */
 #endif
+#if (((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_NET_TABLE) != 0) || defined CO_DOXYGEN
+    CO_HBconsumer_netTable_t* HBconsNetTable; /**< State of all nodes on the network, initialised by
+                                                 @ref CO_HBconsumer_initNetTable() */
+#if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
+    uint16_t RX_IDX_HB_NET; /**< Index in CANrx, after all other buffers. */
+#endif
+#endif
 #endif
 #if (((CO_CONFIG_NODE_GUARDING)&CO_CONFIG_NODE_GUARDING_SLAVE_ENABLE) != 0) || defined CO_DOXYGEN
     CO_nodeGuardingSlave_t* NGslave; /**< Node guarding slave object, initialised by @ref CO_nodeGuardingSlave_init() */
@@ -286,6 +328,9 @@ typedef struct {
     CO_EM_fifo_t* em_fifo; /**< FIFO for emergency object, initialised by @ref CO_EM_init() */
 #endif
     CO_SDOserver_t* SDOserver; /**< SDO server objects, initialised by @ref CO_SDOserver_init() */
+    uint8_t SDOserverFirst;    /**< SDO server channel, which is processed first in next CO_process() call. Rotated
+                                  round-robin, so additional channels (0x1201+) get their fair share of CAN transmit
+                                  capacity. */
 #if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
     uint16_t RX_IDX_SDO_SRV; /**< Start index in CANrx. */
     uint16_t TX_IDX_SDO_SRV; /**< Start index in CANtx. */
@@ -296,6 +341,14 @@ typedef struct {
     uint16_t RX_IDX_SDO_CLI; /**< Start index in CANrx. */
     uint16_t TX_IDX_SDO_CLI; /**< Start index in CANtx. */
 #endif
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    CO_SDOclient_nodeStat_t* SDOclientNodeStat; /**< Statistics of remote nodes, shared by all SDO clients, see
+                                                   @ref CO_SDOclient_initNodeStat(). */
+#endif
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0) || defined CO_DOXYGEN
+    CO_SDObulk_t* SDObulk; /**< SDO bulk engine, initialised by @ref CO_SDObulk_init(). NULL, if there are no spare SDO
+                              clients. */
+#endif
 #endif
 #if (((CO_CONFIG_TIME)&CO_CONFIG_TIME_ENABLE) != 0) || defined CO_DOXYGEN
     CO_TIME_t* TIME; /**< TIME object, initialised by @ref CO_TIME_init() */
@@ -357,27 +410,48 @@ typedef struct {
 #endif
 #endif
 #if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0) || defined CO_DOXYGEN
-    CO_GTWA_t* gtwa; /**< Gateway-ascii object, initialised by @ref CO_GTWA_init(). */
-#if defined CO_MULTIPLE_OD || defined CO_DOXYGEN
+    CO_GTWA_t* gtwa; /**< Gateway-ascii objects, one per session, initialised by @ref CO_GTWA_init(). */
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) || defined CO_DOXYGEN
+    CO_GTWA_SDOpool_t gtwaSDOpool; /**< SDO clients shared by gateway-ascii sessions, see @ref CO_GTWA_initSDOpool().
+                                      First SDO client objects are used, up to one per session. */
+#endif
+#if ((((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SDO) != 0) && (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0))     \
+    || defined CO_DOXYGEN
+    CO_GTWA_SDObulk_t gtwaSDObulk; /**< SDO bulk engine for 'bulk' command of gateway-ascii sessions, see
+                                      @ref CO_GTWA_initSDObulk(). */
+#endif
+#if (((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_LSS) != 0) || defined CO_DOXYGEN
+    CO_GTWA_LSSlock_t gtwaLSSlock; /**< Owner of LSS master among gateway-ascii sessions, see @ref CO_GTWA_initLSSlock(). */
+#endif
+#if ((((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII_SUBSCRIBE) != 0) && defined CO_MULTIPLE_OD) || defined CO_DOXYGEN
+    uint16_t RX_IDX_GTWA_SUB; /**< Start index in CANrx, @ref CO_CONFIG_GTWA_SUBSCRIPTIONS buffers per session. */
 #endif
 #endif
 #if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) || defined CO_DOXYGEN
-    CO_trace_t* trace; /**< Trace object, initialised by @ref CO_trace_init(). */
+    CO_trace_t* trace; /**< Trace objects, CNT_TRACE of them. Each must be initialised by application with
+                          @ref CO_trace_init(), which also provides memory for the ring buffer. */
+#endif
+#if defined CO_USE_ARENA || defined CO_DOXYGEN
+    void* arena;                                   /**< Memory block with all objects, from CO_arena_alloc() */
+    uint32_t arenaSize;                            /**< Size of the arena in bytes */
+    uint8_t arenaEntries;                          /**< Number of objects inside arena */
+    CO_arenaEntry_t arenaLayout[CO_ARENA_ENTRIES]; /**< Layout of the arena, sorted by offset */
 #endif
 } CO_t;
 
 /**
  * Create new CANopen object
  *
- * If CO_USE_GLOBALS is defined, then function uses global static variables for all the CANopenNode objects. Otherwise
- * it allocates all objects from heap.
+ * If CO_USE_GLOBALS is defined, then function uses global static variables for all the CANopenNode objects. If
+ * CO_USE_ARENA is defined, then it allocates all objects inside one block of memory. Otherwise it allocates all objects
+ * from heap.
  *
  * @remark
  * With some microcontrollers it is necessary to specify Heap size within linker configuration, if heap is used.
  *
  * @param config Configuration structure, used if @ref CO_MULTIPLE_OD is defined. It must stay in memory permanently. If
  * CO_MULTIPLE_OD is not defined, config should be NULL and parameters are retrieved from default "OD.h" file.
- * @param [out] heapMemoryUsed Information about heap memory used. Ignored if NULL.
+ * @param [out] heapMemoryUsed Information about heap memory used, size of the arena with CO_USE_ARENA. Ignored if NULL.
  *
  * @return Successfully allocated and configured CO_t object or NULL.
  */
@@ -447,7 +521,7 @@ CO_ReturnError_t CO_LSSinit(CO_t* co, CO_LSS_address_t* lssAddress, uint8_t* pen
  * @param SDOclientTimeoutTime_ms Default timeout in milliseconds for SDO client, 500 typically. SDO client is
  * configured from CO_GTWA_init().
  * @param SDOclientBlockTransfer If true, block transfer will be set in SDO client by default. SDO client is configured
- * from by CO_GTWA_init().
+ * from by CO_GTWA_init(), for each gateway session. Both SDO client arguments are also passed to CO_SDObulk_init().
  * @param nodeId CANopen Node ID (1 ... 127) or 0xFF(unconfigured). In the CANopen initialization it is the same as
  * pendingBitRate from CO_LSSinit(). If it is unconfigured, then some CANopen objects will not be initialized nor
  * processed.
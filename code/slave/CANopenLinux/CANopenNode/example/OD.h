@@ -43,9 +43,10 @@
 #define OD_CNT_HB_CONS 1
 #define OD_CNT_HB_PROD 1
 #define OD_CNT_SDO_SRV 1
-#define OD_CNT_SDO_CLI 1
+#define OD_CNT_SDO_CLI 14
 #define OD_CNT_RPDO 4
 #define OD_CNT_TPDO 4
+#define OD_CNT_TRACE 1
 
 
 /*******************************************************************************
@@ -85,6 +86,84 @@ typedef struct {
         uint32_t COB_IDServerToClientRx;
         uint8_t node_IDOfTheSDOServer;
     } x1280_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1281_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1282_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1283_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1284_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1285_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1286_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1287_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1288_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x1289_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x128A_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x128B_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x128C_SDOClientParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t node_IDOfTheSDOServer;
+    } x128D_SDOClientParameter;
     struct {
         uint8_t highestSub_indexSupported;
         uint32_t COB_IDUsedByRPDO;
@@ -243,6 +322,24 @@ typedef struct {
         uint32_t COB_IDServerToClientTx;
     } x1200_SDOServerParameter;
     uint32_t x2000_temperature;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint8_t enabled;
+        uint32_t samplingPeriod;
+        uint32_t mappedVariable1;
+        uint32_t mappedVariable2;
+        uint32_t mappedVariable3;
+        uint32_t mappedVariable4;
+        uint32_t mappedVariable5;
+        uint32_t mappedVariable6;
+        uint32_t mappedVariable7;
+        uint32_t mappedVariable8;
+    } x2301_traceConfiguration;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t numberOfRecords;
+        uint32_t numberOfLostRecords;
+    } x2401_trace;
 } OD_RAM_t;
 
 #ifndef OD_ATTR_PERSIST_COMM
@@ -281,23 +378,38 @@ extern OD_ATTR_OD OD_t *OD;
 #define OD_ENTRY_H1019 &OD->list[14]
 #define OD_ENTRY_H1200 &OD->list[15]
 #define OD_ENTRY_H1280 &OD->list[16]
-#define OD_ENTRY_H1400 &OD->list[17]
-#define OD_ENTRY_H1401 &OD->list[18]
-#define OD_ENTRY_H1402 &OD->list[19]
-#define OD_ENTRY_H1403 &OD->list[20]
-#define OD_ENTRY_H1600 &OD->list[21]
-#define OD_ENTRY_H1601 &OD->list[22]
-#define OD_ENTRY_H1602 &OD->list[23]
-#define OD_ENTRY_H1603 &OD->list[24]
-#define OD_ENTRY_H1800 &OD->list[25]
-#define OD_ENTRY_H1801 &OD->list[26]
-#define OD_ENTRY_H1802 &OD->list[27]
-#define OD_ENTRY_H1803 &OD->list[28]
-#define OD_ENTRY_H1A00 &OD->list[29]
-#define OD_ENTRY_H1A01 &OD->list[30]
-#define OD_ENTRY_H1A02 &OD->list[31]
-#define OD_ENTRY_H1A03 &OD->list[32]
-#define OD_ENTRY_H2000 &OD->list[33]
+#define OD_ENTRY_H1281 &OD->list[17]
+#define OD_ENTRY_H1282 &OD->list[18]
+#define OD_ENTRY_H1283 &OD->list[19]
+#define OD_ENTRY_H1284 &OD->list[20]
+#define OD_ENTRY_H1285 &OD->list[21]
+#define OD_ENTRY_H1286 &OD->list[22]
+#define OD_ENTRY_H1287 &OD->list[23]
+#define OD_ENTRY_H1288 &OD->list[24]
+#define OD_ENTRY_H1289 &OD->list[25]
+#define OD_ENTRY_H128A &OD->list[26]
+#define OD_ENTRY_H128B &OD->list[27]
+#define OD_ENTRY_H128C &OD->list[28]
+#define OD_ENTRY_H128D &OD->list[29]
+#define OD_ENTRY_H1400 &OD->list[30]
+#define OD_ENTRY_H1401 &OD->list[31]
+#define OD_ENTRY_H1402 &OD->list[32]
+#define OD_ENTRY_H1403 &OD->list[33]
+#define OD_ENTRY_H1600 &OD->list[34]
+#define OD_ENTRY_H1601 &OD->list[35]
+#define OD_ENTRY_H1602 &OD->list[36]
+#define OD_ENTRY_H1603 &OD->list[37]
+#define OD_ENTRY_H1800 &OD->list[38]
+#define OD_ENTRY_H1801 &OD->list[39]
+#define OD_ENTRY_H1802 &OD->list[40]
+#define OD_ENTRY_H1803 &OD->list[41]
+#define OD_ENTRY_H1A00 &OD->list[42]
+#define OD_ENTRY_H1A01 &OD->list[43]
+#define OD_ENTRY_H1A02 &OD->list[44]
+#define OD_ENTRY_H1A03 &OD->list[45]
+#define OD_ENTRY_H2000 &OD->list[46]
+#define OD_ENTRY_H2301 &OD->list[47]
+#define OD_ENTRY_H2401 &OD->list[48]
 
 
 /*******************************************************************************
@@ -320,23 +432,38 @@ extern OD_ATTR_OD OD_t *OD;
 #define OD_ENTRY_H1019_synchronousCounterOverflowValue &OD->list[14]
 #define OD_ENTRY_H1200_SDOServerParameter &OD->list[15]
 #define OD_ENTRY_H1280_SDOClientParameter &OD->list[16]
-#define OD_ENTRY_H1400_RPDOCommunicationParameter &OD->list[17]
-#define OD_ENTRY_H1401_RPDOCommunicationParameter &OD->list[18]
-#define OD_ENTRY_H1402_RPDOCommunicationParameter &OD->list[19]
-#define OD_ENTRY_H1403_RPDOCommunicationParameter &OD->list[20]
-#define OD_ENTRY_H1600_RPDOMappingParameter &OD->list[21]
-#define OD_ENTRY_H1601_RPDOMappingParameter &OD->list[22]
-#define OD_ENTRY_H1602_RPDOMappingParameter &OD->list[23]
-#define OD_ENTRY_H1603_RPDOMappingParameter &OD->list[24]
-#define OD_ENTRY_H1800_TPDOCommunicationParameter &OD->list[25]
-#define OD_ENTRY_H1801_TPDOCommunicationParameter &OD->list[26]
-#define OD_ENTRY_H1802_TPDOCommunicationParameter &OD->list[27]
-#define OD_ENTRY_H1803_TPDOCommunicationParameter &OD->list[28]
-#define OD_ENTRY_H1A00_TPDOMappingParameter &OD->list[29]
-#define OD_ENTRY_H1A01_TPDOMappingParameter &OD->list[30]
-#define OD_ENTRY_H1A02_TPDOMappingParameter &OD->list[31]
-#define OD_ENTRY_H1A03_TPDOMappingParameter &OD->list[32]
-#define OD_ENTRY_H2000_temperature &OD->list[33]
+#define OD_ENTRY_H1281_SDOClientParameter &OD->list[17]
+#define OD_ENTRY_H1282_SDOClientParameter &OD->list[18]
+#define OD_ENTRY_H1283_SDOClientParameter &OD->list[19]
+#define OD_ENTRY_H1284_SDOClientParameter &OD->list[20]
+#define OD_ENTRY_H1285_SDOClientParameter &OD->list[21]
+#define OD_ENTRY_H1286_SDOClientParameter &OD->list[22]
+#define OD_ENTRY_H1287_SDOClientParameter &OD->list[23]
+#define OD_ENTRY_H1288_SDOClientParameter &OD->list[24]
+#define OD_ENTRY_H1289_SDOClientParameter &OD->list[25]
+#define OD_ENTRY_H128A_SDOClientParameter &OD->list[26]
+#define OD_ENTRY_H128B_SDOClientParameter &OD->list[27]
+#define OD_ENTRY_H128C_SDOClientParameter &OD->list[28]
+#define OD_ENTRY_H128D_SDOClientParameter &OD->list[29]
+#define OD_ENTRY_H1400_RPDOCommunicationParameter &OD->list[30]
+#define OD_ENTRY_H1401_RPDOCommunicationParameter &OD->list[31]
+#define OD_ENTRY_H1402_RPDOCommunicationParameter &OD->list[32]
+#define OD_ENTRY_H1403_RPDOCommunicationParameter &OD->list[33]
+#define OD_ENTRY_H1600_RPDOMappingParameter &OD->list[34]
+#define OD_ENTRY_H1601_RPDOMappingParameter &OD->list[35]
+#define OD_ENTRY_H1602_RPDOMappingParameter &OD->list[36]
+#define OD_ENTRY_H1603_RPDOMappingParameter &OD->list[37]
+#define OD_ENTRY_H1800_TPDOCommunicationParameter &OD->list[38]
+#define OD_ENTRY_H1801_TPDOCommunicationParameter &OD->list[39]
+#define OD_ENTRY_H1802_TPDOCommunicationParameter &OD->list[40]
+#define OD_ENTRY_H1803_TPDOCommunicationParameter &OD->list[41]
+#define OD_ENTRY_H1A00_TPDOMappingParameter &OD->list[42]
+#define OD_ENTRY_H1A01_TPDOMappingParameter &OD->list[43]
+#define OD_ENTRY_H1A02_TPDOMappingParameter &OD->list[44]
+#define OD_ENTRY_H1A03_TPDOMappingParameter &OD->list[45]
+#define OD_ENTRY_H2000_temperature &OD->list[46]
+#define OD_ENTRY_H2301_traceConfiguration &OD->list[47]
+#define OD_ENTRY_H2401_trace &OD->list[48]
 
 
 /*******************************************************************************
@@ -383,7 +510,7 @@ extern OD_ATTR_OD OD_t *OD;
     (config).CNT_LSS_SLV = 0;\
     (config).CNT_LSS_MST = 0;\
     (config).CNT_GTWA = 0;\
-    (config).CNT_TRACE = 0;\
+    (config).CNT_TRACE = OD_CNT_TRACE;\
 }
 #endif
 
@@ -0,0 +1,330 @@
+/*
+ * CANopen SDO client bulk transfer engine.
+ *
+ * @file        CO_SDObulk.c
+ * @ingroup     CO_SDObulk
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include <string.h>
+
+#include "extra/CO_SDObulk.h"
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0
+
+CO_ReturnError_t
+CO_SDObulk_init(CO_SDObulk_t* bulk, CO_SDOclient_t* SDO_C, uint8_t channelCount, uint16_t SDOtimeoutTime_ms,
+                bool_t blockEnable) {
+    /* verify arguments */
+    if ((bulk == NULL) || (SDO_C == NULL) || (channelCount == 0U) || (SDOtimeoutTime_ms == 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    /* clear the object */
+    (void)memset(bulk, 0, sizeof(CO_SDObulk_t));
+
+    if (channelCount > CO_CONFIG_SDO_CLI_BULK_CHANNELS) {
+        channelCount = CO_CONFIG_SDO_CLI_BULK_CHANNELS;
+    }
+    for (uint8_t i = 0; i < channelCount; i++) {
+        bulk->channels[i].SDO_C = &SDO_C[i];
+    }
+    bulk->channelCount = channelCount;
+    bulk->SDOtimeoutTime_ms = SDOtimeoutTime_ms;
+    bulk->blockEnable = blockEnable;
+
+    return CO_ERROR_NO;
+}
+
+void
+CO_SDObulk_initCallbackNode(CO_SDObulk_t* bulk, void* object,
+                            void (*pFunctSignal)(void* object, uint8_t nodeId, uint16_t opsOk, uint16_t opsFailed)) {
+    if (bulk != NULL) {
+        bulk->functSignalObject = object;
+        bulk->pFunctSignalNode = pFunctSignal;
+    }
+}
+
+CO_ReturnError_t
+CO_SDObulk_start(CO_SDObulk_t* bulk, CO_SDObulk_op_t* ops, uint16_t opCount) {
+    if ((bulk == NULL) || (ops == NULL) || (opCount == 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+    if (bulk->ops != NULL) {
+        return CO_ERROR_INVALID_STATE;
+    }
+
+    for (uint16_t i = 0; i < opCount; i++) {
+        ops[i].state = CO_SDObulk_op_pending;
+        ops[i].sizeTransferred = 0;
+        ops[i].abortCode = CO_SDO_AB_NONE;
+    }
+    bulk->opCount = opCount;
+    bulk->opFirstPending = 0;
+    bulk->opsOk = 0;
+    bulk->opsFailed = 0;
+    bulk->ops = ops;
+
+    return CO_ERROR_NO;
+}
+
+/* Inform application, if node has no more pending or active operations. */
+static void
+bulk_signalNode(CO_SDObulk_t* bulk, uint8_t nodeId) {
+    uint16_t nodeOk = 0;
+    uint16_t nodeFailed = 0;
+
+    if (bulk->pFunctSignalNode == NULL) {
+        return;
+    }
+    for (uint16_t i = 0; i < bulk->opCount; i++) {
+        CO_SDObulk_op_t* o = &bulk->ops[i];
+        if (o->nodeId != nodeId) {
+            continue;
+        }
+        if ((o->state == CO_SDObulk_op_pending) || (o->state == CO_SDObulk_op_active)) {
+            return; /* node has more work */
+        }
+        if (o->state == CO_SDObulk_op_done) {
+            nodeOk++;
+        } else {
+            nodeFailed++;
+        }
+    }
+    bulk->pFunctSignalNode(bulk->functSignalObject, nodeId, nodeOk, nodeFailed);
+}
+
+/* Mark operation as finished and inform application, if this was the last operation for that node. */
+static void
+bulk_finishOp(CO_SDObulk_t* bulk, CO_SDObulk_channel_t* ch, bool_t success) {
+    CO_SDObulk_op_t* op = ch->op;
+
+    CO_SDOclientClose(ch->SDO_C);
+    ch->op = NULL;
+
+    if (success) {
+        op->state = CO_SDObulk_op_done;
+        bulk->opsOk++;
+    } else {
+        if (op->abortCode == CO_SDO_AB_NONE) {
+            op->abortCode = CO_SDO_AB_GENERAL;
+        }
+        op->state = CO_SDObulk_op_error;
+        bulk->opsFailed++;
+    }
+
+    bulk_signalNode(bulk, op->nodeId);
+}
+
+/* Find next pending operation for a node, which is not served by any channel. Operations for the same node are
+ * started in array order, because earlier operation of the node is always found first. */
+static CO_SDObulk_op_t*
+bulk_nextOp(CO_SDObulk_t* bulk) {
+    /* skip operations, which are already started */
+    while ((bulk->opFirstPending < bulk->opCount) && (bulk->ops[bulk->opFirstPending].state != CO_SDObulk_op_pending)) {
+        bulk->opFirstPending++;
+    }
+
+    for (uint16_t i = bulk->opFirstPending; i < bulk->opCount; i++) {
+        CO_SDObulk_op_t* op = &bulk->ops[i];
+        bool_t nodeBusy = false;
+
+        if (op->state != CO_SDObulk_op_pending) {
+            continue;
+        }
+        for (uint8_t c = 0; c < bulk->channelCount; c++) {
+            if ((bulk->channels[c].op != NULL) && (bulk->channels[c].op->nodeId == op->nodeId)) {
+                nodeBusy = true;
+                break;
+            }
+        }
+        if (!nodeBusy) {
+            /* Also earlier pending operation of the same node, if any, would be found first. */
+            return op;
+        }
+    }
+    return NULL;
+}
+
+/* Assign operation to the channel and initiate SDO transfer. Return false, if initiation failed. */
+static bool_t
+bulk_startOp(CO_SDObulk_t* bulk, CO_SDObulk_channel_t* ch, CO_SDObulk_op_t* op) {
+    CO_SDO_return_t SDO_ret;
+
+    ch->op = op;
+    ch->offset = 0;
+    ch->fresh = true;
+    op->state = CO_SDObulk_op_active;
+
+    if ((op->nodeId < 1U) || (op->nodeId > 127U)) {
+        op->abortCode = CO_SDO_AB_GENERAL;
+        return false;
+    }
+
+    SDO_ret = CO_SDOclient_setup(ch->SDO_C, (uint32_t)CO_CAN_ID_SDO_CLI + op->nodeId,
+                                 (uint32_t)CO_CAN_ID_SDO_SRV + op->nodeId, op->nodeId);
+    if (SDO_ret != CO_SDO_RT_ok_communicationEnd) {
+        return false;
+    }
+
+    if (op->write) {
+        SDO_ret = CO_SDOclientDownloadInitiate(ch->SDO_C, op->index, op->subIndex, op->dataSize,
+                                               bulk->SDOtimeoutTime_ms, bulk->blockEnable);
+    } else {
+        SDO_ret = CO_SDOclientUploadInitiate(ch->SDO_C, op->index, op->subIndex, bulk->SDOtimeoutTime_ms,
+                                             bulk->blockEnable);
+    }
+    return SDO_ret == CO_SDO_RT_ok_communicationEnd;
+}
+
+/* Proceed with download on the channel */
+static CO_SDO_return_t
+bulk_download(CO_SDObulk_channel_t* ch, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    CO_SDObulk_op_t* op = ch->op;
+
+    /* refill SDO buffer */
+    if (ch->offset < op->dataSize) {
+        ch->offset += CO_SDOclientDownloadBufWrite(ch->SDO_C, &op->data[ch->offset], op->dataSize - ch->offset);
+    }
+
+    return CO_SDOclientDownload(ch->SDO_C, timeDifference_us, false, ch->offset < op->dataSize, &op->abortCode,
+                                &op->sizeTransferred, timerNext_us);
+}
+
+/* Proceed with upload on the channel */
+static CO_SDO_return_t
+bulk_upload(CO_SDObulk_channel_t* ch, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    CO_SDObulk_op_t* op = ch->op;
+    CO_SDO_return_t ret;
+
+    ret = CO_SDOclientUpload(ch->SDO_C, timeDifference_us, false, &op->abortCode, NULL, NULL, timerNext_us);
+
+    /* empty SDO buffer into user buffer */
+    if ((ret == CO_SDO_RT_uploadDataBufferFull) || (ret == CO_SDO_RT_ok_communicationEnd)) {
+        if (ch->offset < op->dataSize) {
+            ch->offset += CO_SDOclientUploadBufRead(ch->SDO_C, &op->data[ch->offset], op->dataSize - ch->offset);
+        }
+        op->sizeTransferred = ch->offset;
+
+        /* user buffer is too small */
+        if (CO_fifo_getOccupied(&ch->SDO_C->bufFifo) > 0U) {
+            op->abortCode = CO_SDO_AB_OUT_OF_MEM;
+            if (ret != CO_SDO_RT_ok_communicationEnd) {
+                (void)CO_SDOclientUpload(ch->SDO_C, 0, true, &op->abortCode, NULL, NULL, NULL);
+            }
+            ret = CO_SDO_RT_endedWithClientAbort;
+        }
+    }
+
+    return ret;
+}
+
+void
+CO_SDObulk_abort(CO_SDObulk_t* bulk, CO_SDO_abortCode_t abortCode) {
+    uint32_t pendingNodes[4] = {0}; /* bitmask of nodes with pending, but not active operations */
+
+    if ((bulk == NULL) || (bulk->ops == NULL)) {
+        return;
+    }
+
+    /* Pending operations are failed first, so the node is complete, when its active operation is finished below. */
+    for (uint16_t i = bulk->opFirstPending; i < bulk->opCount; i++) {
+        CO_SDObulk_op_t* op = &bulk->ops[i];
+        if (op->state == CO_SDObulk_op_pending) {
+            op->abortCode = abortCode;
+            op->state = CO_SDObulk_op_error;
+            bulk->opsFailed++;
+            pendingNodes[(op->nodeId >> 5) & 0x03U] |= (uint32_t)1U << (op->nodeId & 0x1FU);
+        }
+    }
+
+    for (uint8_t c = 0; c < bulk->channelCount; c++) {
+        CO_SDObulk_channel_t* ch = &bulk->channels[c];
+        if (ch->op != NULL) {
+            CO_SDO_abortCode_t ab = abortCode;
+            uint8_t nodeId = ch->op->nodeId;
+            if (ch->op->write) {
+                (void)CO_SDOclientDownload(ch->SDO_C, 0, true, false, &ab, NULL, NULL);
+            } else {
+                (void)CO_SDOclientUpload(ch->SDO_C, 0, true, &ab, NULL, NULL, NULL);
+            }
+            ch->op->abortCode = abortCode;
+            bulk_finishOp(bulk, ch, false);
+            pendingNodes[(nodeId >> 5) & 0x03U] &= ~((uint32_t)1U << (nodeId & 0x1FU));
+        }
+    }
+
+    /* nodes, which had only pending operations */
+    for (uint16_t n = 0; n < 128U; n++) {
+        if ((pendingNodes[n >> 5] & ((uint32_t)1U << (n & 0x1FU))) != 0U) {
+            bulk_signalNode(bulk, (uint8_t)n);
+        }
+    }
+    bulk->ops = NULL;
+}
+
+CO_SDO_return_t
+CO_SDObulk_process(CO_SDObulk_t* bulk, uint32_t timeDifference_us, uint32_t* timerNext_us) {
+    bool_t active = false;
+
+    if ((bulk == NULL) || (bulk->ops == NULL)) {
+        return CO_SDO_RT_ok_communicationEnd;
+    }
+
+    for (uint8_t c = 0; c < bulk->channelCount; c++) {
+        CO_SDObulk_channel_t* ch = &bulk->channels[c];
+        CO_SDO_return_t ret;
+
+        /* Take new operations for free channel. Failed initiations finish immediately, so try next one. */
+        while (ch->op == NULL) {
+            CO_SDObulk_op_t* op = bulk_nextOp(bulk);
+            if (op == NULL) {
+                break;
+            }
+            if (!bulk_startOp(bulk, ch, op)) {
+                bulk_finishOp(bulk, ch, false);
+            }
+        }
+        if (ch->op == NULL) {
+            continue;
+        }
+
+        /* time has not elapsed for freshly started transfer */
+        ret = ch->op->write ? bulk_download(ch, ch->fresh ? 0U : timeDifference_us, timerNext_us)
+                            : bulk_upload(ch, ch->fresh ? 0U : timeDifference_us, timerNext_us);
+        ch->fresh = false;
+
+        if (ret < CO_SDO_RT_ok_communicationEnd) {
+            bulk_finishOp(bulk, ch, false);
+        } else if (ret == CO_SDO_RT_ok_communicationEnd) {
+            bulk_finishOp(bulk, ch, true);
+        } else {
+            active = true;
+            continue;
+        }
+
+        /* channel is free again, start next operation without delay */
+        if ((timerNext_us != NULL) && (bulk_nextOp(bulk) != NULL)) {
+            *timerNext_us = 0;
+        }
+        active = true;
+    }
+
+    if (!active && (bulk_nextOp(bulk) == NULL)) {
+        bulk->ops = NULL;
+        return CO_SDO_RT_ok_communicationEnd;
+    }
+    return CO_SDO_RT_waitingResponse;
+}
+
+#endif /* (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BULK */
@@ -0,0 +1,208 @@
+/**
+ * CANopen SDO client bulk transfer engine.
+ *
+ * @file        CO_SDObulk.h
+ * @ingroup     CO_SDObulk
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_SDO_BULK_H
+#define CO_SDO_BULK_H
+
+#include "301/CO_driver.h"
+#include "301/CO_SDOclient.h"
+
+/* default configuration, see CO_config.h */
+#ifndef CO_CONFIG_SDO_CLI
+#define CO_CONFIG_SDO_CLI (0)
+#endif
+#ifndef CO_CONFIG_SDO_CLI_BULK_CHANNELS
+#define CO_CONFIG_SDO_CLI_BULK_CHANNELS 8U
+#endif
+#ifndef CO_CONFIG_SDO_CLI_BULK_COUNT
+#define CO_CONFIG_SDO_CLI_BULK_COUNT CO_CONFIG_SDO_CLI_BULK_CHANNELS
+#endif
+#if (CO_CONFIG_SDO_CLI_BULK_COUNT) > (CO_CONFIG_SDO_CLI_BULK_CHANNELS)
+#error CO_CONFIG_SDO_CLI_BULK_COUNT must not be larger than CO_CONFIG_SDO_CLI_BULK_CHANNELS.
+#endif
+
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BULK) != 0) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_SDObulk SDO bulk
+ * Concurrent SDO client transfers to many remote nodes.
+ *
+ * @ingroup CO_CANopen_extra
+ * @{
+ * Single SDO client object handles one transfer at a time, so configuration of many nodes with the same client is
+ * strictly sequential and pays a full round trip per object. SDO bulk engine takes a batch of operations (node, index,
+ * subindex, data) and runs them concurrently over multiple SDO client channels, each channel serving a different
+ * remote node. Operations for the same node are executed in the order, in which they are listed in the batch.
+ *
+ * Application (or gateway) prepares an array of #CO_SDObulk_op_t, starts it with CO_SDObulk_start() and then calls
+ * CO_SDObulk_process() cyclically (CO_process() does this for the object inside #CO_t). Result of each operation is
+ * written back into the array. Optional callback is called when all operations for the specific node are finished.
+ *
+ * Each SDO client channel is configured with default SDO COB-IDs of the served node (0x600+node, 0x580+node) before
+ * each transfer.
+ *
+ * Inside #CO_t the engine uses the last @ref CO_CONFIG_SDO_CLI_BULK_COUNT SDO clients from Object Dictionary (0x1280+).
+ * If gateway uses SDO, first SDO client is always left to it. Object Dictionary should have
+ * @ref CO_CONFIG_GTWA_SESSIONS + @ref CO_CONFIG_SDO_CLI_BULK_COUNT SDO clients, so gateway sessions keep one SDO client
+ * each. Gateway command 'bulk' starts a batch with the same object on a range of nodes, see @ref CO_CANopen_309_3.
+ */
+
+/**
+ * State of single SDO bulk operation.
+ */
+typedef enum {
+    CO_SDObulk_op_pending = 0, /**< Operation is waiting for free channel */
+    CO_SDObulk_op_active = 1,  /**< Operation is in progress on one of the channels */
+    CO_SDObulk_op_done = 2,    /**< Operation finished successfully */
+    CO_SDObulk_op_error = 3    /**< Operation failed, see abortCode */
+} CO_SDObulk_opState_t;
+
+/**
+ * Single operation in SDO bulk batch.
+ */
+typedef struct {
+    uint8_t nodeId;                /**< Node-ID of the SDO server, 1..127 */
+    uint16_t index;                /**< Index of the object in the remote Object Dictionary */
+    uint8_t subIndex;              /**< Subindex of the object in the remote Object Dictionary */
+    bool_t write;                  /**< If true, data are downloaded (written), otherwise uploaded (read). */
+    uint8_t* data;                 /**< Download: source data. Upload: destination buffer. */
+    size_t dataSize;               /**< Download: size of data. Upload: size of destination buffer. */
+    size_t sizeTransferred;        /**< [out] Number of bytes actually transferred. */
+    CO_SDO_abortCode_t abortCode;  /**< [out] SDO abort code, if operation failed. */
+    CO_SDObulk_opState_t state;    /**< [out] State of the operation, set to pending by CO_SDObulk_start(). */
+} CO_SDObulk_op_t;
+
+/**
+ * SDO client channel used by SDO bulk engine.
+ */
+typedef struct {
+    CO_SDOclient_t* SDO_C; /**< SDO client object */
+    CO_SDObulk_op_t* op;   /**< Operation currently served by this channel or NULL */
+    size_t offset;         /**< Number of bytes of op->data already copied from / to SDO client buffer */
+    bool_t fresh;          /**< True, if operation has just been started and was not processed yet */
+} CO_SDObulk_channel_t;
+
+/**
+ * SDO bulk engine object.
+ */
+typedef struct {
+    CO_SDObulk_channel_t channels[CO_CONFIG_SDO_CLI_BULK_CHANNELS]; /**< SDO client channels */
+    uint8_t channelCount;                                           /**< Number of used channels */
+    CO_SDObulk_op_t* ops;        /**< Array of operations from CO_SDObulk_start() or NULL if idle */
+    uint16_t opCount;            /**< Number of operations in the array */
+    uint16_t opFirstPending;     /**< All operations before this index are already active or finished */
+    uint16_t opsOk;              /**< Number of successfully finished operations in current batch */
+    uint16_t opsFailed;          /**< Number of failed operations in current batch */
+    uint16_t SDOtimeoutTime_ms;  /**< Timeout time for each SDO transfer */
+    bool_t blockEnable;          /**< Try to use block transfer */
+    void (*pFunctSignalNode)(void* object, uint8_t nodeId, uint16_t opsOk, uint16_t opsFailed); /**< From
+                                    CO_SDObulk_initCallbackNode() or NULL */
+    void* functSignalObject;     /**< From CO_SDObulk_initCallbackNode() or NULL */
+} CO_SDObulk_t;
+
+/**
+ * Initialize SDO bulk engine.
+ *
+ * @param bulk This object will be initialized.
+ * @param SDO_C Array of SDO client objects, which will be used exclusively by the bulk engine.
+ * @param channelCount Number of SDO client objects in array, 1 to @ref CO_CONFIG_SDO_CLI_BULK_CHANNELS. More clients
+ * than that are ignored.
+ * @param SDOtimeoutTime_ms Timeout time for each SDO transfer in milliseconds.
+ * @param blockEnable Try to use block transfer for longer data.
+ *
+ * @return #CO_ReturnError_t: CO_ERROR_NO or CO_ERROR_ILLEGAL_ARGUMENT.
+ */
+CO_ReturnError_t CO_SDObulk_init(CO_SDObulk_t* bulk, CO_SDOclient_t* SDO_C, uint8_t channelCount,
+                                 uint16_t SDOtimeoutTime_ms, bool_t blockEnable);
+
+/**
+ * Initialize callback, which is called, when all operations for one node are finished.
+ *
+ * @param bulk This object.
+ * @param object Pointer to object, which will be passed to pFunctSignal(). Can be NULL.
+ * @param pFunctSignal Pointer to the callback function. Arguments are node-ID and number of successful and failed
+ * operations for that node in current batch. Not called if NULL.
+ */
+void CO_SDObulk_initCallbackNode(CO_SDObulk_t* bulk, void* object,
+                                 void (*pFunctSignal)(void* object, uint8_t nodeId, uint16_t opsOk,
+                                                      uint16_t opsFailed));
+
+/**
+ * Start new batch of operations.
+ *
+ * Array of operations must stay valid until CO_SDObulk_process() returns other than #CO_SDO_RT_waitingResponse.
+ *
+ * @param bulk This object.
+ * @param ops Array of operations. State of each operation is set to #CO_SDObulk_op_pending.
+ * @param opCount Number of operations in array.
+ *
+ * @return #CO_ReturnError_t: CO_ERROR_NO, CO_ERROR_ILLEGAL_ARGUMENT or CO_ERROR_INVALID_STATE, if previous batch is
+ * still in progress.
+ */
+CO_ReturnError_t CO_SDObulk_start(CO_SDObulk_t* bulk, CO_SDObulk_op_t* ops, uint16_t opCount);
+
+/**
+ * Test if batch is in progress.
+ *
+ * @param bulk This object.
+ *
+ * @return true, if there is batch in progress.
+ */
+static inline bool_t
+CO_SDObulk_busy(CO_SDObulk_t* bulk) {
+    return (bulk != NULL) && (bulk->ops != NULL);
+}
+
+/**
+ * Abort current batch.
+ *
+ * Active transfers are aborted with SDO abort message, pending operations are marked as failed. Callback from
+ * CO_SDObulk_initCallbackNode() is called for each node with unfinished operations.
+ *
+ * @param bulk This object.
+ * @param abortCode SDO abort code, which is sent to the servers and written to unfinished operations.
+ */
+void CO_SDObulk_abort(CO_SDObulk_t* bulk, CO_SDO_abortCode_t abortCode);
+
+/**
+ * Process SDO bulk engine.
+ *
+ * Function must be called cyclically. It is non-blocking.
+ *
+ * @param bulk This object.
+ * @param timeDifference_us Time difference from previous function call in [microseconds].
+ * @param [out] timerNext_us info to OS - see CO_process(). Ignored if NULL.
+ *
+ * @return #CO_SDO_RT_waitingResponse, if batch is in progress or #CO_SDO_RT_ok_communicationEnd, if no batch is in
+ * progress (last batch has finished). Results are in the array of operations.
+ */
+CO_SDO_return_t CO_SDObulk_process(CO_SDObulk_t* bulk, uint32_t timeDifference_us, uint32_t* timerNext_us);
+
+/** @} */ /* CO_SDObulk */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BULK */
+
+#endif /* CO_SDO_BULK_H */
@@ -17,490 +17,487 @@
  * See the License for the specific language governing permissions and limitations under the License.
  */
 
-#include "extra/CO_trace.h"
-
-#if (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE
-
-#include <stdio.h>
 #include <string.h>
-#if !((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_OWN_INTTYPES)
-#include <inttypes.h> /* for PRIu32("u" or "lu") and PRId32("d" or "ld") */
-#endif
-
-/* Different functions for processing value for different data types. */
-static int32_t getValueI8 (void *OD_variable) { return (int32_t) *((int8_t*)   OD_variable);}
-static int32_t getValueI16(void *OD_variable) { return (int32_t) *((int16_t*)  OD_variable);}
-static int32_t getValueI32(void *OD_variable) { return           *((int32_t*)  OD_variable);}
-static int32_t getValueU8 (void *OD_variable) { return (int32_t) *((uint8_t*)  OD_variable);}
-static int32_t getValueU16(void *OD_variable) { return (int32_t) *((uint16_t*) OD_variable);}
-static int32_t getValueU32(void *OD_variable) { return           *((int32_t*)  OD_variable);}
 
+#include "extra/CO_trace.h"
 
-/* Different functions for printing points for different data types. */
-static uint32_t printPointCsv(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "%" PRIu32 ";%" PRId32 "\n", timeStamp,              value);
-}
-static uint32_t printPointCsvUnsigned(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "%" PRIu32 ";%" PRIu32 "\n", timeStamp, (uint32_t)   value);
-}
-static uint32_t printPointBinary(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    if(size < 8) return 0;
-    uint32_t timeStampSw = CO_SWAP_32(timeStamp);
-    int32_t valueSw = CO_SWAP_32(value);
-    memcpy(s, &timeStampSw, sizeof(timeStampSw));
-    memcpy(s+4, &valueSw, sizeof(valueSw));
-    return 8;
-}
-static uint32_t printPointSvgStart(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "M%" PRIu32 ",%" PRId32, timeStamp,             value);
-}
-static uint32_t printPointSvgStartUnsigned(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "M%" PRIu32 ",%" PRIu32, timeStamp, (uint32_t)  value);
-}
-static uint32_t printPointSvg(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "H%" PRIu32 "V%" PRId32, timeStamp,             value);
-}
-static uint32_t printPointSvgUnsigned(char *s, uint32_t size, uint32_t timeStamp, int32_t value) {
-    return snprintf(s, size, "H%" PRIu32 "V%" PRIu32, timeStamp, (uint32_t)  value);
-}
+#if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) != 0
 
+/* values for configRequest */
+#define TRACE_REQUEST_NONE  0U
+#define TRACE_REQUEST_START 1U
+#define TRACE_REQUEST_STOP  2U
 
-/* Collection of function pointers for fast processing based on specific data type. */
-/* Rules for the array: There must be groups of six members (I8, I16, I32, U8, U16, U32)
- * in correct order and sequence, so findVariable() finds correct member. */
-static const CO_trace_dataType_t dataTypes[] = {
-    {getValueI8,  printPointCsv,              printPointCsv,         printPointCsv},
-    {getValueI16, printPointCsv,              printPointCsv,         printPointCsv},
-    {getValueI32, printPointCsv,              printPointCsv,         printPointCsv},
-    {getValueU8,  printPointCsvUnsigned,      printPointCsvUnsigned, printPointCsvUnsigned},
-    {getValueU16, printPointCsvUnsigned,      printPointCsvUnsigned, printPointCsvUnsigned},
-    {getValueU32, printPointCsvUnsigned,      printPointCsvUnsigned, printPointCsvUnsigned},
-    {getValueI8,  printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueI16, printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueI32, printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueU8,  printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueU16, printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueU32, printPointBinary,           printPointBinary,      printPointBinary},
-    {getValueI8,  printPointSvgStart,         printPointSvg,         printPointSvg},
-    {getValueI16, printPointSvgStart,         printPointSvg,         printPointSvg},
-    {getValueI32, printPointSvgStart,         printPointSvg,         printPointSvg},
-    {getValueU8,  printPointSvgStartUnsigned, printPointSvgUnsigned, printPointSvgUnsigned},
-    {getValueU16, printPointSvgStartUnsigned, printPointSvgUnsigned, printPointSvgUnsigned},
-    {getValueU32, printPointSvgStartUnsigned, printPointSvgUnsigned, printPointSvgUnsigned}
-};
-
-
-/* Find variable in Object Dictionary *****************************************/
-static void findVariable(CO_trace_t *trace) {
-    bool_t err = false;
-    uint16_t index;
-    uint8_t subIndex;
-    uint8_t dataLen;
-    void *OdDataPtr = NULL;
-    unsigned dtIndex = 0;
-
-    /* parse mapping */
-    index = (uint16_t) ((*trace->map) >> 16);
-    subIndex = (uint8_t) ((*trace->map) >> 8);
-    dataLen = (uint8_t) (*trace->map);
-    if((dataLen & 0x07) != 0) { /* data length must be byte aligned */
-        err = true;
-    }
-    dataLen >>= 3;   /* in bytes now */
-    if(dataLen == 0) {
-        dataLen = 4;
-    }
+/* sub-indexes of OD object "Trace configuration" */
+#define TRACE_CONFIG_SUB_ENABLED 1U
+#define TRACE_CONFIG_SUB_PERIOD  2U
+#define TRACE_CONFIG_SUB_MAP     3U
 
-    /* find mapped variable, if map available */
-    if(!err && (index != 0 || subIndex != 0)) {
-        uint16_t entryNo = CO_OD_find(trace->SDO, index);
+/* sub-indexes of OD object "Trace" */
+#define TRACE_SUB_COUNT 1U
+#define TRACE_SUB_LOST  2U
+#define TRACE_SUB_DATA  3U
 
-        if(index >= 0x1000 && entryNo != 0xFFFF && subIndex <= trace->SDO->OD[entryNo].maxSubIndex) {
-            OdDataPtr = CO_OD_getDataPointer(trace->SDO, entryNo, subIndex);
+/*
+ * Resolve mapping from OD object "Trace configuration" into trace->configPending
+ *
+ * @param trace This object.
+ *
+ * @return ODR_OK or ODR_NO_MAP, if mapping is not valid, or ODR_OUT_OF_MEM, if record does not fit into buffer.
+ */
+static ODR_t
+traceConfigure(CO_trace_t* trace) {
+    CO_trace_config_t* cfg = &trace->configPending;
+    uint8_t maxSubIndex = 0;
+    uint32_t recordSize = sizeof(uint64_t);
+
+    (void)memset(cfg, 0, sizeof(CO_trace_config_t));
+    (void)OD_get_u8(trace->OD_traceConfig, 0, &maxSubIndex, true);
+    (void)OD_get_u32(trace->OD_traceConfig, TRACE_CONFIG_SUB_PERIOD, &cfg->period_us, true);
+
+    for (uint8_t sub = TRACE_CONFIG_SUB_MAP; sub <= maxSubIndex; sub++) {
+        uint32_t map = 0;
+        OD_IO_t OD_IO;
+
+        if ((OD_get_u32(trace->OD_traceConfig, sub, &map, true) != ODR_OK) || (map == 0U)) {
+            break;
+        }
+        if (cfg->variableCount >= CO_TRACE_VARIABLES_MAX) {
+            return ODR_MAP_LEN;
         }
 
-        if(OdDataPtr != NULL) {
-            uint16_t len = CO_OD_getLength(trace->SDO, entryNo, subIndex);
+        uint16_t index = (uint16_t)(map >> 16);
+        uint8_t subIndex = (uint8_t)(map >> 8);
+        uint8_t lengthBits = (uint8_t)map;
+        uint8_t length = lengthBits >> 3;
 
-            if(len < dataLen) {
-                dataLen = len;
-            }
-        }
-        else {
-            err = true;
+        if (((lengthBits & 0x07U) != 0U) || (length == 0U) || (length > 8U)
+            || (OD_getSub(OD_find(trace->OD, index), subIndex, &OD_IO, true) != ODR_OK)
+            || (OD_IO.stream.dataOrig == NULL) || (OD_IO.stream.dataLength < length)) {
+            return ODR_NO_MAP;
         }
+
+        cfg->variable[cfg->variableCount] = OD_IO.stream.dataOrig;
+        cfg->variableLength[cfg->variableCount] = length;
+        cfg->map[cfg->variableCount] = map;
+        cfg->variableCount++;
+        recordSize += length;
     }
 
-    /* Get function pointers for correct data type */
-    if(!err) {
-        /* first sequence: data length */
-        switch(dataLen) {
-            case 1: dtIndex = 0; break;
-            case 2: dtIndex = 1; break;
-            case 4: dtIndex = 2; break;
-            default: err = true; break;
-        }
-        /* second sequence: signed or unsigned */
-        if(((*trace->format) & 1) == 1) {
-            dtIndex += 3;
-        }
-        /* third sequence: Output type */
-        dtIndex += ((*trace->format) >> 1) * 6;
+    /* records are aligned to 8 bytes, their number is power of 2 */
+    cfg->recordSize = (recordSize + 7U) & ~7UL;
+    size_t recordsMax = (trace->bufferSize - trace->ring->headerSize) / cfg->recordSize;
+    if (recordsMax == 0U) {
+        return ODR_OUT_OF_MEM;
+    }
+    cfg->recordCount = 1;
+    while ((cfg->recordCount <= (recordsMax / 2U)) && (cfg->recordCount < 0x80000000UL)) {
+        cfg->recordCount <<= 1;
+    }
 
-        if(dtIndex > (sizeof(dataTypes) / sizeof(CO_trace_dataType_t))) {
-            err = true;
-        }
+    return ODR_OK;
+}
+
+/*
+ * Apply start or stop request. Called only by the producer of the ring.
+ */
+static void
+traceApply(CO_trace_t* trace) {
+    CO_trace_ring_t* ring = trace->ring;
+
+    trace->running = false;
+    ring->running = 0;
+
+    if (trace->configRequest == TRACE_REQUEST_START) {
+        ring->configCounter++;
+        CO_TRACE_BARRIER();
+
+        trace->config = trace->configPending;
+        ring->recordSize = trace->config.recordSize;
+        ring->recordCount = trace->config.recordCount;
+        ring->period_us = trace->config.period_us;
+        ring->variableCount = trace->config.variableCount;
+        (void)memcpy(ring->map, trace->config.map, sizeof(ring->map));
+        ring->writeCount = 0;
+
+        CO_TRACE_BARRIER();
+        ring->configCounter++;
+
+        trace->timeNext_us = 0;
+        trace->running = true;
+        ring->running = 1;
     }
 
-    /* set output variables */
-    if(!err) {
-        if(OdDataPtr != NULL) {
-            trace->OD_variable = OdDataPtr;
-        }
-        else {
-            trace->OD_variable = trace->value;
+    CO_TRACE_BARRIER();
+    trace->configRequest = TRACE_REQUEST_NONE;
+}
+
+/*
+ * Synchronize SDO reader with the ring. Reset it, if configuration has changed, and skip overwritten records.
+ *
+ * @return writeCount from the ring or readCount, if configuration is being changed.
+ */
+static uint32_t
+traceReadSync(CO_trace_t* trace) {
+    CO_trace_ring_t* ring = trace->ring;
+    uint32_t configCounter = ring->configCounter;
+
+    if ((configCounter & 1U) != 0U) {
+        return trace->readCount;
+    }
+    if (configCounter != trace->readConfigCounter) {
+        trace->readConfigCounter = configCounter;
+        trace->readCount = 0;
+        trace->lost = 0;
+        trace->lostExported = 0;
+        trace->exportRecordSize = sizeof(uint64_t);
+        for (uint8_t i = 0; i < ring->variableCount; i++) {
+            trace->exportRecordSize += (uint8_t)ring->map[i] >> 3;
         }
-        trace->dt = &dataTypes[dtIndex];
     }
-    else  {
-        trace->OD_variable = NULL;
-        trace->dt = NULL;
+
+    /* the oldest record in the ring may be just overwritten by the producer, so it is not readable */
+    uint32_t writeCount = ring->writeCount;
+    uint32_t readable = (ring->recordCount > 0U) ? (ring->recordCount - 1U) : 0U;
+    CO_TRACE_BARRIER();
+    if ((writeCount - trace->readCount) > readable) {
+        trace->lost += writeCount - readable - trace->readCount;
+        trace->readCount = writeCount - readable;
     }
+    return writeCount;
 }
 
+/*
+ * Copy next record for the SDO export into trace->exportChunk.
+ *
+ * @return true, if record was copied, false if there are no more records for current export.
+ */
+static bool_t
+traceExportRecord(CO_trace_t* trace) {
+    CO_trace_ring_t* ring = trace->ring;
+
+    while (trace->readCount != trace->exportEnd) {
+        uint32_t seq = trace->readCount;
+        uint32_t writeCount = ring->writeCount;
+
+        if ((writeCount - seq) >= ring->recordCount) {
+            /* producer was faster, skip overwritten records */
+            uint32_t oldest = writeCount - ring->recordCount + 1U;
+            if ((int32_t)(trace->exportEnd - oldest) <= 0) {
+                trace->lost += trace->exportEnd - seq;
+                trace->readCount = trace->exportEnd;
+                break;
+            }
+            trace->lost += oldest - seq;
+            seq = oldest;
+        }
 
-/* OD function for accessing _OD_traceConfig_ (index 0x2300+) from SDO server.
- * For more information see file CO_SDOserver.h. */
-static CO_SDO_abortCode_t CO_ODF_traceConfig(CO_ODF_arg_t *ODF_arg) {
-    CO_trace_t *trace;
-    CO_SDO_abortCode_t ret = CO_SDO_AB_NONE;
-
-    trace = (CO_trace_t*) ODF_arg->object;
+        (void)memcpy(trace->exportChunk, &trace->records[(seq & (ring->recordCount - 1U)) * ring->recordSize],
+                     trace->exportRecordSize);
+        CO_TRACE_BARRIER();
+        writeCount = ring->writeCount;
+        trace->readCount = seq + 1U;
 
-    switch(ODF_arg->subIndex) {
-    case 1:     /* size */
-        if(ODF_arg->reading) {
-            CO_setUint32(ODF_arg->data, trace->bufferSize);
+        if ((writeCount - seq) >= ring->recordCount) {
+            /* record was overwritten during the copy */
+            trace->lost++;
+            continue;
         }
-        break;
 
-    case 2:     /* axisNo (trace enabled if nonzero) */
-        if(ODF_arg->reading) {
-            uint8_t *value = (uint8_t*) ODF_arg->data;
-            if(!trace->enabled) {
-                *value = 0;
+#ifdef CO_BIG_ENDIAN
+        /* convert timestamp and all values to little-endian */
+        uint8_t* p = &trace->exportChunk[0];
+        for (uint8_t i = 0; i <= ring->variableCount; i++) {
+            uint8_t len = (i == 0U) ? sizeof(uint64_t) : ((uint8_t)ring->map[i - 1U] >> 3);
+            for (uint8_t j = 0; j < (len / 2U); j++) {
+                uint8_t b = p[j];
+                p[j] = p[len - 1U - j];
+                p[len - 1U - j] = b;
             }
+            p += len;
         }
-        else {
-            uint8_t *value = (uint8_t*) ODF_arg->data;
+#endif
+        trace->exportChunkLen = trace->exportRecordSize;
+        trace->exportChunkPos = 0;
+        return true;
+    }
+    return false;
+}
 
-            if(*value == 0) {
-                trace->enabled = false;
-            }
-            else if(!trace->enabled) {
-                if(trace->bufferSize == 0) {
-                    ret = CO_SDO_AB_OUT_OF_MEM;
-                }
-                else {
-                    /* set trace->OD_variable and trace->dt, based on 'map' and 'format' */
-                    findVariable(trace);
-
-                    if(trace->OD_variable != NULL) {
-                        *trace->value = 0;
-                        *trace->minValue = 0;
-                        *trace->maxValue = 0;
-                        *trace->triggerTime = 0;
-                        trace->valuePrev = 0;
-                        trace->readPtr = 0;
-                        trace->writePtr = 0;
-                        trace->enabled = true;
-                    }
-                    else {
-                        ret = CO_SDO_AB_NO_MAP;
-                    }
-                }
-            }
+/*
+ * Read binary export of the records, OD object "Trace", sub-index 3.
+ */
+static ODR_t
+traceExport(CO_trace_t* trace, OD_stream_t* stream, uint8_t* buf, OD_size_t count, OD_size_t* countRead) {
+    CO_trace_ring_t* ring = trace->ring;
+    OD_size_t n = 0;
+
+    if (stream->dataOffset == 0U) {
+        /* first segment, prepare header and determine records for this export */
+        uint32_t writeCount = traceReadSync(trace);
+        if (((ring->configCounter & 1U) != 0U) || (ring->recordCount == 0U)) {
+            return ODR_NO_DATA;
+        }
+        trace->exportEnd = writeCount;
+
+        uint8_t* h = &trace->exportChunk[0];
+        (void)CO_setUint32(&h[0], CO_SWAP_32(CO_TRACE_MAGIC));
+        (void)CO_setUint16(&h[4], CO_SWAP_16(CO_TRACE_VERSION));
+        h[6] = ring->variableCount;
+        h[7] = trace->exportRecordSize;
+        (void)CO_setUint32(&h[8], CO_SWAP_32(ring->period_us));
+        (void)CO_setUint32(&h[12], CO_SWAP_32(trace->readCount));
+        (void)CO_setUint32(&h[16], CO_SWAP_32(trace->lost - trace->lostExported));
+        for (uint8_t i = 0; i < ring->variableCount; i++) {
+            (void)CO_setUint32(&h[CO_TRACE_EXPORT_HEADER_SIZE + (4U * i)], CO_SWAP_32(ring->map[i]));
         }
-        break;
+        trace->lostExported = trace->lost;
+        trace->exportChunkLen = CO_TRACE_EXPORT_HEADER_SIZE + (4U * ring->variableCount);
+        trace->exportChunkPos = 0;
+    } else if (ring->configCounter != trace->readConfigCounter) {
+        return ODR_DATA_DEV_STATE;
+    } else { /* MISRA C 2004 14.10 */
+    }
 
-    case 5:     /* map */
-    case 6:     /* format */
-        if(!ODF_arg->reading) {
-            if(trace->enabled) {
-                ret = CO_SDO_AB_INVALID_VALUE;
+    while (n < count) {
+        if (trace->exportChunkPos < trace->exportChunkLen) {
+            OD_size_t len = trace->exportChunkLen - trace->exportChunkPos;
+            if (len > (count - n)) {
+                len = count - n;
             }
+            (void)memcpy(&buf[n], &trace->exportChunk[trace->exportChunkPos], len);
+            trace->exportChunkPos += (uint8_t)len;
+            n += len;
+        } else if (!traceExportRecord(trace)) {
+            break;
+        } else { /* MISRA C 2004 14.10 */
         }
-        break;
-    default:
-        /* MISRA C 2004 15.3 */
-        break;
     }
 
-    return ret;
-}
-
+    stream->dataOffset += n;
+    *countRead = n;
 
-/* OD function for accessing _OD_trace_ (index 0x2400+) from SDO server.
- * For more information see file CO_SDOserver.h. */
-static CO_SDO_abortCode_t CO_ODF_trace(CO_ODF_arg_t *ODF_arg) {
-    CO_trace_t *trace;
-    CO_SDO_abortCode_t ret = CO_SDO_AB_NONE;
+    if ((trace->exportChunkPos < trace->exportChunkLen) || (trace->readCount != trace->exportEnd)) {
+        return ODR_PARTIAL;
+    }
+    stream->dataOffset = 0;
+    return ODR_OK;
+}
 
-    trace = (CO_trace_t*) ODF_arg->object;
+/*
+ * Custom function for writing OD object "Trace configuration"
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_write_traceConfig(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    if ((stream == NULL) || (buf == NULL) || (countWritten == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
 
-    switch(ODF_arg->subIndex) {
-    case 1:     /* size */
-        if(ODF_arg->reading) {
-            uint32_t size = trace->bufferSize;
-            uint32_t wp = trace->writePtr;
-            uint32_t rp = trace->readPtr;
+    CO_trace_t* trace = stream->object;
+    uint8_t request = TRACE_REQUEST_NONE;
 
-            if(wp >= rp) {
-                CO_setUint32(ODF_arg->data,  wp - rp);
-            }
-            else {
-                CO_setUint32(ODF_arg->data, size - rp + wp);
-            }
+    if (stream->subIndex == TRACE_CONFIG_SUB_ENABLED) {
+        if (trace->configRequest != TRACE_REQUEST_NONE) {
+            return ODR_DATA_DEV_STATE;
         }
-        else {
-            if(CO_getUint32(ODF_arg->data) == 0) {
-                /* clear buffer, handle race conditions */
-                while(trace->readPtr != 0 || trace->writePtr != 0) {
-                    trace->readPtr = 0;
-                    trace->writePtr = 0;
-                    *trace->triggerTime = 0;
-                }
-            }
-            else {
-                ret = CO_SDO_AB_INVALID_VALUE;
+        request = TRACE_REQUEST_STOP;
+        if ((count == sizeof(uint8_t)) && (CO_getUint8(buf) != 0U)) {
+            ODR_t odRet = traceConfigure(trace);
+            if (odRet != ODR_OK) {
+                return odRet;
             }
+            request = TRACE_REQUEST_START;
         }
-        break;
-
-    case 5:     /* plot */
-        if(ODF_arg->reading) {
-            /* This plot will be transmitted as domain data type. String data
-             * will be printed directly to SDO buffer. If there is more data
-             * to print, than is the size of SDO buffer, then this function
-             * will be called multiple times until internal trace buffer is
-             * empty. Internal trace buffer is circular buffer. It is accessed
-             * by this function and by higher priority thread. If this buffer
-             * is full, there is a danger for race condition. First records
-             * from trace buffer may be overwritten somewhere between. If this
-             * is detected, then do{}while() loop tries printing again. */
-            if(trace->bufferSize == 0 || ODF_arg->dataLength < 100) {
-                ret = CO_SDO_AB_OUT_OF_MEM;
-            }
-            else if(trace->readPtr == trace->writePtr) {
-                ret = CO_SDO_AB_NO_DATA;
-            }
-            else {
-                uint32_t rp, t, v, len, freeLen;
-                char *s;
-                bool_t readPtrOverflowed; /* for handling race conditions */
-
-                /* repeat everything, if trace->readPtr was overflowed in CO_trace_process */
-                do {
-                    readPtrOverflowed = false;
-                    s = (char*) ODF_arg->data;
-                    freeLen = ODF_arg->dataLength;
-
-                    rp = trace->readPtr;
-
-                    /* start plot, increment variables, verify overflow */
-                    if(ODF_arg->firstSegment) {
-                        t = trace->timeBuffer[rp];
-                        v = trace->valueBuffer[rp];
-                        rp ++;
-                        if(++trace->readPtr == trace->bufferSize) {
-                            trace->readPtr = 0;
-                            if(rp != trace->bufferSize) {
-                                readPtrOverflowed = true;
-                                continue;
-                            }
-                            rp = 0;
-                        }
-                        if(rp != trace->readPtr) {
-                            readPtrOverflowed = true;
-                            continue;
-                        }
-                        len = trace->dt->printPointStart(s, freeLen, t, v);
-                        s += len;
-                        freeLen -= len;
-                    }
-
-                    /* print other points */
-                    if(rp != trace->writePtr) {
-                    for(;;) {
-                        t = trace->timeBuffer[rp];
-                        v = trace->valueBuffer[rp];
-                        rp ++;
-                        if(++trace->readPtr == trace->bufferSize) {
-                            trace->readPtr = 0;
-                            if(rp != trace->bufferSize && ODF_arg->firstSegment) {
-                                readPtrOverflowed = true;
-                                break;
-                            }
-                            rp = 0;
-                        }
-                        if(rp != trace->readPtr && ODF_arg->firstSegment) {
-                            readPtrOverflowed = true;
-                            break;
-                        }
-
-                        /* If internal buffer is empty, end transfer */
-                        if(rp == trace->writePtr) {
-                            /* If there is last time stamp, point will be printed at the end */
-                            if(t != trace->lastTimeStamp) {
-                                len = trace->dt->printPoint(s, freeLen, t, v);
-                                s += len;
-                                freeLen -= len;
-                            }
-                            ODF_arg->lastSegment = true;
-                            break;
-                        }
-                        len = trace->dt->printPoint(s, freeLen, t, v);
-                        s += len;
-                        freeLen -= len;
-
-                        /* if output buffer is full, next data will be sent later */
-                        if(freeLen < 50) {
-                            ODF_arg->lastSegment = false;
-                            break;
-                        }
-                    }
-                    }
-
-                    /* print last point */
-                    if(!readPtrOverflowed && ODF_arg->lastSegment) {
-                        v = trace->valuePrev;
-                        t = trace->lastTimeStamp;
-                        len = trace->dt->printPointEnd(s, freeLen, t, v);
-                        s += len;
-                        freeLen -= len;
-                    }
-                } while(readPtrOverflowed);
-
-                ODF_arg->dataLength -= freeLen;
-            }
+    } else if (stream->subIndex > TRACE_CONFIG_SUB_ENABLED) {
+        uint8_t enabled = 0;
+        (void)OD_get_u8(trace->OD_traceConfig, TRACE_CONFIG_SUB_ENABLED, &enabled, true);
+        if (enabled != 0U) {
+            return ODR_INVALID_VALUE;
         }
-        break;
-    default:
-        /* MISRA C 2004 15.3 */
-        break;
+    } else { /* MISRA C 2004 14.10 */
     }
 
-    return ret;
+    ODR_t returnCode = OD_writeOriginal(stream, buf, count, countWritten);
+
+    if ((returnCode == ODR_OK) && (request != TRACE_REQUEST_NONE)) {
+        /* configuration is applied by the producer of the ring, see CO_trace_process() */
+        CO_TRACE_BARRIER();
+        trace->configRequest = request;
+    }
+    return returnCode;
 }
 
+/*
+ * Custom function for reading OD object "Trace"
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_read_trace(OD_stream_t* stream, void* buf, OD_size_t count, OD_size_t* countRead) {
+    if ((stream == NULL) || (buf == NULL) || (countRead == NULL)) {
+        return ODR_DEV_INCOMPAT;
+    }
 
-void CO_trace_init(
-        CO_trace_t             *trace,
-        CO_SDO_t               *SDO,
-        uint8_t                 enabled,
-        uint32_t               *timeBuffer,
-        int32_t                *valueBuffer,
-        uint32_t                bufferSize,
-        uint32_t               *map,
-        uint8_t                *format,
-        uint8_t                *trigger,
-        int32_t                *threshold,
-        int32_t                *value,
-        int32_t                *minValue,
-        int32_t                *maxValue,
-        uint32_t               *triggerTime,
-        uint16_t                idx_OD_traceConfig,
-        uint16_t                idx_OD_trace)
-{
-    trace->SDO = SDO;
-    trace->enabled = (enabled != 0) ? true : false;
-    trace->timeBuffer = timeBuffer;
-    trace->valueBuffer = valueBuffer;
-    trace->bufferSize = bufferSize;
-    trace->writePtr = 0;
-    trace->readPtr = 0;
-    trace->lastTimeStamp = 0;
-    trace->map = map;
-    trace->format = format;
-    trace->trigger = trigger;
-    trace->threshold = threshold;
-    trace->value = value;
-    trace->minValue = minValue;
-    trace->maxValue = maxValue;
-    trace->triggerTime = triggerTime;
-    *trace->value = 0;
-    *trace->minValue = 0;
-    *trace->maxValue = 0;
-    *trace->triggerTime = 0;
-    trace->valuePrev = 0;
-
-    /* set trace->OD_variable and trace->dt, based on 'map' and 'format' */
-    findVariable(trace);
-
-    if(timeBuffer == NULL || valueBuffer == NULL) {
-        trace->bufferSize = 0;
+    CO_trace_t* trace = stream->object;
+
+    switch (stream->subIndex) {
+        case TRACE_SUB_COUNT:
+        case TRACE_SUB_LOST: {
+            if (count < sizeof(uint32_t)) {
+                return ODR_DEV_INCOMPAT;
+            }
+            uint32_t writeCount = traceReadSync(trace);
+            uint32_t value = (stream->subIndex == TRACE_SUB_COUNT) ? (writeCount - trace->readCount) : trace->lost;
+            *countRead = CO_setUint32(buf, value);
+            return ODR_OK;
+        }
+        case TRACE_SUB_DATA: return traceExport(trace, stream, (uint8_t*)buf, count, countRead);
+        default: return OD_readOriginal(stream, buf, count, countRead);
+    }
+}
+
+/*
+ * Custom function for writing OD object "Trace"
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t
+OD_write_trace(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t* countWritten) {
+    if ((stream == NULL) || (buf == NULL) || (countWritten == NULL)) {
+        return ODR_DEV_INCOMPAT;
     }
 
-    if( trace->bufferSize == 0 || trace->OD_variable == NULL) {
-        trace->enabled = false;
+    CO_trace_t* trace = stream->object;
+
+    if (stream->subIndex != TRACE_SUB_COUNT) {
+        return ODR_READONLY;
+    }
+    if (count != sizeof(uint32_t)) {
+        return ODR_TYPE_MISMATCH;
+    }
+    if (CO_getUint32(buf) != 0U) {
+        return ODR_INVALID_VALUE;
     }
 
-    CO_OD_configure(SDO, idx_OD_traceConfig, CO_ODF_traceConfig, (void*)trace, 0, 0);
-    CO_OD_configure(SDO, idx_OD_trace, CO_ODF_trace, (void*)trace, 0, 0);
+    /* discard records */
+    trace->readCount = traceReadSync(trace);
+    trace->lost = 0;
+    trace->lostExported = 0;
+    *countWritten = sizeof(uint32_t);
+    return ODR_OK;
 }
 
+CO_ReturnError_t
+CO_trace_init(CO_trace_t* trace, OD_t* OD, OD_entry_t* OD_traceConfig, OD_entry_t* OD_trace, void* buffer,
+              size_t bufferSize, uint32_t* errInfo) {
+    /* verify arguments */
+    if ((trace == NULL) || (OD == NULL) || (OD_traceConfig == NULL) || (OD_trace == NULL) || (buffer == NULL)
+        || (((uintptr_t)buffer & 0x07U) != 0U) || (bufferSize <= sizeof(CO_trace_ring_t))) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
 
-void CO_trace_process(CO_trace_t *trace, uint32_t timestamp) {
-    if(trace->enabled) {
+    uint8_t enabled = 0;
+    uint32_t period_us = 0;
+    if ((OD_get_u8(OD_traceConfig, TRACE_CONFIG_SUB_ENABLED, &enabled, true) != ODR_OK)
+        || (OD_get_u32(OD_traceConfig, TRACE_CONFIG_SUB_PERIOD, &period_us, true) != ODR_OK)) {
+        if (errInfo != NULL) {
+            *errInfo = OD_getIndex(OD_traceConfig);
+        }
+        return CO_ERROR_OD_PARAMETERS;
+    }
 
-        int32_t val = trace->dt->pGetValue(trace->OD_variable);
+    /* Configure object variables and header of the ring buffer */
+    (void)memset(trace, 0, sizeof(CO_trace_t));
+    trace->ring = (CO_trace_ring_t*)buffer;
+    trace->bufferSize = bufferSize;
+    trace->OD = OD;
+    trace->OD_traceConfig = OD_traceConfig;
+
+    (void)memset(trace->ring, 0, sizeof(CO_trace_ring_t));
+    trace->ring->magic = CO_TRACE_MAGIC;
+    trace->ring->version = CO_TRACE_VERSION;
+    trace->ring->headerSize = (uint16_t)((sizeof(CO_trace_ring_t) + 7U) & ~7UL);
+    trace->records = (uint8_t*)buffer + trace->ring->headerSize;
+
+    /* configure extensions */
+    trace->OD_traceConfig_ext.object = trace;
+    trace->OD_traceConfig_ext.read = OD_readOriginal;
+    trace->OD_traceConfig_ext.write = OD_write_traceConfig;
+    (void)OD_extension_init(OD_traceConfig, &trace->OD_traceConfig_ext);
+
+    trace->OD_trace_ext.object = trace;
+    trace->OD_trace_ext.read = OD_read_trace;
+    trace->OD_trace_ext.write = OD_write_trace;
+    (void)OD_extension_init(OD_trace, &trace->OD_trace_ext);
+
+    /* start the trace, if enabled */
+    if (enabled != 0U) {
+        if (traceConfigure(trace) == ODR_OK) {
+            trace->configRequest = TRACE_REQUEST_START;
+            traceApply(trace);
+        } else {
+            (void)OD_set_u8(OD_traceConfig, TRACE_CONFIG_SUB_ENABLED, 0, true);
+        }
+    }
 
-        if(val != trace->valuePrev) {
-            /* Verify, if value passed threshold */
-            if((*trace->trigger & 1) != 0 && trace->valuePrev < *trace->threshold && val >= *trace->threshold) {
-                *trace->triggerTime = timestamp;
-            }
-            if((*trace->trigger & 2) != 0 && trace->valuePrev < *trace->threshold && val >= *trace->threshold) {
-                *trace->triggerTime = timestamp;
-            }
+    return CO_ERROR_NO;
+}
 
-            /* Write value and verify min/max */
-            if(trace->value != trace->OD_variable) {
-                *trace->value = val;
-            }
-            trace->valuePrev = val;
-            if(*trace->minValue > val) {
-                *trace->minValue = val;
-            }
-            if(*trace->maxValue < val) {
-                *trace->maxValue = val;
-            }
+void
+CO_trace_process(CO_trace_t* trace, uint64_t timestamp_us, uint32_t* timerNext_us) {
+    if ((trace == NULL) || (trace->ring == NULL)) {
+        return;
+    }
 
-            /* write buffers and update pointers */
-            trace->timeBuffer[trace->writePtr] = timestamp;
-            trace->valueBuffer[trace->writePtr] = val;
-            if(++trace->writePtr == trace->bufferSize) {
-                trace->writePtr = 0;
-            }
-            if(trace->writePtr == trace->readPtr) {
-                if(++trace->readPtr == trace->bufferSize) {
-                    trace->readPtr = 0;
-                }
+    if (trace->configRequest != TRACE_REQUEST_NONE) {
+        CO_TRACE_BARRIER();
+        traceApply(trace);
+    }
+    if (!trace->running) {
+        return;
+    }
+
+    uint32_t period_us = trace->config.period_us;
+    if (period_us > 0U) {
+        if (timestamp_us < trace->timeNext_us) {
+#if ((CO_CONFIG_TRACE)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+            uint64_t diff = trace->timeNext_us - timestamp_us;
+            if ((timerNext_us != NULL) && (*timerNext_us > diff)) {
+                *timerNext_us = (uint32_t)diff;
             }
+#endif
+            return;
         }
-        else {
-            /* if buffer is empty, make first record */
-            if(trace->writePtr == trace->readPtr) {
-                /* write buffers and update pointers */
-                trace->timeBuffer[trace->writePtr] = timestamp;
-                trace->valueBuffer[trace->writePtr] = val;
-                if(++trace->writePtr == trace->bufferSize) {
-                    trace->writePtr = 0;
-                }
-            }
+        /* samples, which were missed, are not repeated */
+        trace->timeNext_us += period_us;
+        if (trace->timeNext_us <= timestamp_us) {
+            trace->timeNext_us = timestamp_us + period_us;
+        }
+#if ((CO_CONFIG_TRACE)&CO_CONFIG_FLAG_TIMERNEXT) != 0
+        if ((timerNext_us != NULL) && (*timerNext_us > period_us)) {
+            *timerNext_us = period_us;
         }
-        trace->lastTimeStamp = timestamp;
+#endif
+    }
+    (void)timerNext_us;
+
+    /* write the record, then make it visible to the readers */
+    CO_trace_ring_t* ring = trace->ring;
+    uint32_t writeCount = ring->writeCount;
+    uint8_t* record = &trace->records[(writeCount & (trace->config.recordCount - 1U)) * trace->config.recordSize];
+
+    (void)memcpy(record, &timestamp_us, sizeof(uint64_t));
+    record += sizeof(uint64_t);
+    for (uint8_t i = 0; i < trace->config.variableCount; i++) {
+        uint8_t len = trace->config.variableLength[i];
+        (void)memcpy(record, trace->config.variable[i], len);
+        record += len;
     }
+
+    CO_TRACE_BARRIER();
+    ring->writeCount = writeCount + 1U;
 }
 
 #endif /* (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE */
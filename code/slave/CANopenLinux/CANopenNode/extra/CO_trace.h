@@ -22,14 +22,14 @@
 #define CO_TRACE_H
 
 #include "301/CO_driver.h"
-#include "301/CO_SDOserver.h"
+#include "301/CO_ODinterface.h"
 
 /* default configuration, see CO_config.h */
 #ifndef CO_CONFIG_TRACE
 #define CO_CONFIG_TRACE (0)
 #endif
 
-#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) || defined CO_DOXYGEN
+#if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) || defined CO_DOXYGEN
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,122 +41,188 @@ extern "C" {
  *
  * @ingroup CO_CANopen_extra
  * @{
- * In embedded systems there is often a need to monitor some variables over time.
- * Results are then displayed on graph, similar as in oscilloscope.
- *
- * CANopen trace is a configurable object, accessible via CANopen Object
- * Dictionary, which records chosen variable over time. It generates a curve,
- * which can be read via SDO and can then be displayed in a graph.
- *
- * CO_trace_process() runs in 1 ms intervals and monitors one variable. If it
- * changes, it makes a record with timestamp into circular buffer. When trace is
- * accessed by CANopen SDO object, it reads latest points from the the circular
- * buffer, prints a SVG curve into string and sends it as a SDO response. If a
- * SDO request was received from the same device, then no traffic occupies CAN
- * network.
+ * In embedded systems there is often a need to monitor some variables over time. Results are then displayed on graph,
+ * similar as in oscilloscope.
+ *
+ * CANopen trace is a configurable object, accessible via CANopen Object Dictionary, which samples up to
+ * @ref CO_TRACE_VARIABLES_MAX OD variables in constant time intervals. Each sample is a record with timestamp in
+ * microseconds, followed by raw values of all variables. Records are written into a ring buffer, which is provided by
+ * application, see @ref CO_trace_ring_t. Oldest records are overwritten, if ring is full.
+ *
+ * CO_trace_process() is usually called from realtime thread. It only copies mapped variables into the ring, it does not
+ * lock the Object Dictionary and does not wait for readers. Because of that, multi-byte variable, which is written by
+ * other thread at the same time, may be sampled inconsistently.
+ *
+ * Records are read by two ways:
+ * - Via SDO, as a binary domain from OD object "Trace" (@ref OD_INDEX_TRACE), sub-index 3. Each read transfers all
+ *   records, which was not read yet, and removes them from the ring. If SDO request was received from the same device,
+ *   then no traffic occupies CAN network.
+ * - Directly from ring buffer. If ring buffer is located in shared memory (memory mapped file on Linux), other
+ *   processes can read records without copying and without disturbing the CANopen device. Reader must follow rules,
+ *   described in @ref CO_trace_ring_t.
+ *
+ * ### OD object "Trace configuration" (@ref OD_INDEX_TRACE_CONFIG), RECORD:
+ * - Sub index 0: Highest sub-index supported, 3 or more.
+ * - Sub index 1: Enabled, UNSIGNED8, rw. Writing non-zero value (re)starts trace, writing zero stops it. Mapping is
+ *   verified, when trace is started, SDO abort "object cannot be mapped" is returned on error.
+ * - Sub index 2: Sampling period in microseconds, UNSIGNED32, rw. If zero, each CO_trace_process() call makes a sample.
+ * - Sub index 3 and above: Mapped variable, UNSIGNED32, rw. Format is the same as in PDO mapping parameter: index
+ *   (bits 16..31), sub-index (bits 8..15) and length in bits (bits 0..7), which must be 8, 16, 24, ... 64. Zero
+ *   terminates the list.
+ *
+ * Sub-indexes 2 and above can not be written while trace is enabled.
+ *
+ * ### OD object "Trace" (@ref OD_INDEX_TRACE), RECORD:
+ * - Sub index 0: Highest sub-index supported, 3.
+ * - Sub index 1: Number of records available for SDO read, UNSIGNED32, rw. Writing zero discards them.
+ * - Sub index 2: Number of records lost for SDO read (overwritten before read), UNSIGNED32, ro.
+ * - Sub index 3: Records, DOMAIN, ro. Data starts with @ref CO_trace_exportHeader_t, mapped variables follow. Then
+ *   records follow, each with UNSIGNED64 timestamp in microseconds and values of mapped variables, without padding.
+ *   All values are little-endian.
  */
 
-
 /**
  * Start index of traceConfig and Trace objects in Object Dictionary.
  */
 #ifndef OD_INDEX_TRACE_CONFIG
-#define OD_INDEX_TRACE_CONFIG   0x2301
-#define OD_INDEX_TRACE          0x2401
+#define OD_INDEX_TRACE_CONFIG 0x2301
+#define OD_INDEX_TRACE        0x2401
+#endif
+
+/** Maximum number of variables sampled by one trace. */
+#ifndef CO_TRACE_VARIABLES_MAX
+#define CO_TRACE_VARIABLES_MAX 8
 #endif
 
+/** Memory barrier between writing the record and increment of writeCount, see @ref CO_trace_ring_t */
+#ifndef CO_TRACE_BARRIER
+#define CO_TRACE_BARRIER() CO_MemoryBarrier()
+#endif
+
+#define CO_TRACE_MAGIC   0x52544F43UL /**< "COTR", in @ref CO_trace_ring_t and @ref CO_trace_exportHeader_t */
+#define CO_TRACE_VERSION 1U           /**< Version of the ring and export format */
+
+/**
+ * Header of the trace ring buffer.
+ *
+ * Header is at the start of the buffer passed to CO_trace_init(), records follow at offset headerSize. Record with
+ * sequence number n is located at offset headerSize + (n % recordCount) * recordSize. It contains UNSIGNED64 timestamp
+ * in microseconds, followed by values of mapped variables in native byte order, without padding. recordSize is
+ * multiple of 8 and recordCount is power of 2.
+ *
+ * Reader of the ring, which runs concurrently with the producer:
+ * 1. Read configCounter. If odd, configuration is just being changed, try later.
+ * 2. Read writeCount, issue memory barrier. Records with sequence numbers from writeCount - recordCount + 1 to
+ *    writeCount - 1 are available (uint32_t arithmetic). Record writeCount - recordCount may be just overwritten.
+ * 3. Copy the records, issue memory barrier and read writeCount again. Copied record n is valid, if n + recordCount is
+ *    larger than the new writeCount, otherwise it was overwritten during the copy.
+ * 4. If configCounter has changed, discard everything.
+ */
+typedef struct {
+    uint32_t magic;                       /**< CO_TRACE_MAGIC */
+    uint16_t version;                     /**< CO_TRACE_VERSION */
+    uint16_t headerSize;                  /**< Size of this header, offset of the first record */
+    uint32_t recordSize;                  /**< Size of one record in bytes */
+    uint32_t recordCount;                 /**< Number of records in the ring */
+    uint32_t period_us;                   /**< Sampling period in microseconds */
+    uint8_t variableCount;                /**< Number of mapped variables */
+    volatile uint8_t running;             /**< True, if trace is enabled and records are being written */
+    uint8_t reserved[2];                  /**< Reserved */
+    uint32_t map[CO_TRACE_VARIABLES_MAX]; /**< Mapped variables, format is the same as in PDO mapping parameter */
+    volatile uint32_t configCounter;      /**< Incremented before and after the change of configuration */
+    volatile uint32_t writeCount;         /**< Number of records written since start, wraps around */
+} CO_trace_ring_t;
 
 /**
- *  structure for reading variables and printing points for specific data type.
+ * Header of the binary SDO export, see OD object "Trace", sub-index 3. Structure is packed and little-endian, its
+ * size is 20 bytes. Mapped variables (UNSIGNED32, variableCount times) follow, then records.
  */
 typedef struct {
-    /** Function pointer for getting the value from OD variable. **/
-    int32_t (*pGetValue) (void *OD_variable);
-    /** Function pointer for printing the start point to trace.plot */
-    uint32_t (*printPointStart)(char *s, uint32_t size, uint32_t timeStamp, int32_t value);
-    /** Function pointer for printing the point to trace.plot */
-    uint32_t (*printPoint)(char *s, uint32_t size, uint32_t timeStamp, int32_t value);
-    /** Function pointer for printing the end point to trace.plot */
-    uint32_t (*printPointEnd)(char *s, uint32_t size, uint32_t timeStamp, int32_t value);
-} CO_trace_dataType_t;
+    uint32_t magic;         /**< CO_TRACE_MAGIC */
+    uint16_t version;       /**< CO_TRACE_VERSION */
+    uint8_t variableCount;  /**< Number of mapped variables */
+    uint8_t recordSize;     /**< Size of one exported record in bytes: 8 + size of all mapped variables */
+    uint32_t period_us;     /**< Sampling period in microseconds */
+    uint32_t sequence;      /**< Sequence number of the first record */
+    uint32_t lost;          /**< Number of records lost since previous export */
+} CO_trace_exportHeader_t;
+
+/** Size of the @ref CO_trace_exportHeader_t, as exported. */
+#define CO_TRACE_EXPORT_HEADER_SIZE 20U
 
+/**
+ * Trace configuration, resolved from OD object "Trace configuration".
+ */
+typedef struct {
+    uint32_t period_us;                             /**< Sampling period in microseconds */
+    uint32_t recordSize;                            /**< Size of one record in the ring */
+    uint32_t recordCount;                           /**< Number of records in the ring, power of 2 */
+    uint8_t variableCount;                          /**< Number of mapped variables */
+    uint8_t variableLength[CO_TRACE_VARIABLES_MAX]; /**< Lengths of mapped variables in bytes */
+    void* variable[CO_TRACE_VARIABLES_MAX];         /**< Pointers to mapped OD variables */
+    uint32_t map[CO_TRACE_VARIABLES_MAX];           /**< Mapping, as written in OD */
+} CO_trace_config_t;
 
 /**
  * Trace object.
+ *
+ * Ring buffer is written only by CO_trace_process(). If configuration is changed via OD, new configuration is
+ * prepared in configPending and applied by the next CO_trace_process() call.
  */
 typedef struct {
-    bool_t              enabled;        /**< True, if trace is enabled. */
-    CO_SDO_t           *SDO;            /**< From CO_trace_init(). */
-    uint32_t           *timeBuffer;     /**< From CO_trace_init(). */
-    int32_t            *valueBuffer;    /**< From CO_trace_init(). */
-    uint32_t            bufferSize;     /**< From CO_trace_init(). */
-    volatile uint32_t   writePtr;       /**< Location in buffer, which will be next written. */
-    volatile uint32_t   readPtr;        /**< Location in buffer, which will be next read. */
-    uint32_t            lastTimeStamp;  /**< Last time stamp. If zero, then last point contains last timestamp. */
-    void               *OD_variable;    /**< Pointer to variable, which is monitored */
-    const CO_trace_dataType_t *dt;      /**< Data type specific function pointers. **/
-    int32_t             valuePrev;      /**< Previous value of value. */
-    uint32_t           *map;            /**< From CO_trace_init(). */
-    uint8_t            *format;         /**< From CO_trace_init(). */
-    int32_t            *value;          /**< From CO_trace_init(). */
-    int32_t            *minValue;       /**< From CO_trace_init(). */
-    int32_t            *maxValue;       /**< From CO_trace_init(). */
-    uint32_t           *triggerTime;    /**< From CO_trace_init(). */
-    uint8_t            *trigger;        /**< From CO_trace_init(). */
-    int32_t            *threshold;      /**< From CO_trace_init(). */
+    CO_trace_ring_t* ring;          /**< From CO_trace_init() */
+    uint8_t* records;               /**< First record inside the ring buffer */
+    size_t bufferSize;              /**< From CO_trace_init() */
+    OD_t* OD;                       /**< From CO_trace_init() */
+    OD_entry_t* OD_traceConfig;     /**< From CO_trace_init() */
+    CO_trace_config_t config;       /**< Active configuration, used by CO_trace_process() */
+    CO_trace_config_t configPending; /**< Configuration prepared by OD write */
+    volatile uint8_t configRequest; /**< Request for CO_trace_process() to start or stop the trace */
+    bool_t running;                 /**< True, if CO_trace_process() makes records */
+    uint64_t timeNext_us;           /**< Timestamp of the next sample */
+    uint32_t readConfigCounter;     /**< configCounter from the ring, as seen by the SDO read */
+    uint32_t readCount;             /**< Sequence number of the next record for SDO read */
+    uint32_t exportEnd;             /**< Sequence number after the last record of current SDO read */
+    uint32_t lost;                  /**< Number of records lost for SDO read */
+    uint32_t lostExported;          /**< Value of lost at the previous SDO read */
+    uint8_t exportRecordSize;       /**< Size of one record in SDO export */
+    uint8_t exportChunkLen;         /**< Number of bytes in exportChunk */
+    uint8_t exportChunkPos;         /**< Number of bytes from exportChunk already exported */
+    uint8_t exportChunk[CO_TRACE_EXPORT_HEADER_SIZE + (8U * CO_TRACE_VARIABLES_MAX)]; /**< Header or record */
+    OD_extension_t OD_traceConfig_ext; /**< Extension for OD object "Trace configuration" */
+    OD_extension_t OD_trace_ext;    /**< Extension for OD object "Trace" */
 } CO_trace_t;
 
-
 /**
  * Initialize trace object.
  *
- * Function must be called in the communication reset section.
+ * Function may be called once at program startup, before or after initialization of CANopen objects. If "Enabled" in
+ * OD is non-zero and mapping is valid, trace is started. If mapping is not valid, "Enabled" is set to zero.
  *
  * @param trace This object will be initialized.
- * @param SDO SDO server object.
- * @param enabled Is trace enabled.
- * @param timeBuffer Memory block for storing time records.
- * @param valueBuffer Memory block for storing value records.
- * @param bufferSize Size of the above buffers.
- * @param map Map to variable in Object Dictionary, which will be monitored. Same structure as in PDO.
- * @param format Format of the plot. If first bit is 1, above variable is unsigned. For more info see Object Dictionary.
- * @param trigger If different than zero, trigger time is recorded, when variable goes through threshold.
- * @param threshold Used with trigger.
- * @param value Pointer to variable, which will show last value of the variable.
- * @param minValue Pointer to variable, which will show minimum value of the variable.
- * @param maxValue Pointer to variable, which will show maximum value of the variable.
- * @param triggerTime Pointer to variable, which will show last trigger time of the variable.
- * @param idx_OD_traceConfig Index in Object Dictionary.
- * @param idx_OD_trace Index in Object Dictionary.
+ * @param OD Object Dictionary, where mapped variables are searched.
+ * @param OD_traceConfig OD entry for "Trace configuration", see @ref OD_INDEX_TRACE_CONFIG.
+ * @param OD_trace OD entry for "Trace", see @ref OD_INDEX_TRACE.
+ * @param buffer Memory for the ring buffer, aligned to 8 bytes. It may be shared memory.
+ * @param bufferSize Size of the buffer in bytes.
+ * @param [out] errInfo Additional information in case of error, may be NULL.
+ *
+ * @return #CO_ReturnError_t CO_ERROR_NO on success, CO_ERROR_ILLEGAL_ARGUMENT or CO_ERROR_OD_PARAMETERS.
  */
-void CO_trace_init(
-        CO_trace_t             *trace,
-        CO_SDO_t               *SDO,
-        uint8_t                 enabled,
-        uint32_t               *timeBuffer,
-        int32_t                *valueBuffer,
-        uint32_t                bufferSize,
-        uint32_t               *map,
-        uint8_t                *format,
-        uint8_t                *trigger,
-        int32_t                *threshold,
-        int32_t                *value,
-        int32_t                *minValue,
-        int32_t                *maxValue,
-        uint32_t               *triggerTime,
-        uint16_t                idx_OD_traceConfig,
-        uint16_t                idx_OD_trace);
-
+CO_ReturnError_t CO_trace_init(CO_trace_t* trace, OD_t* OD, OD_entry_t* OD_traceConfig, OD_entry_t* OD_trace,
+                               void* buffer, size_t bufferSize, uint32_t* errInfo);
 
 /**
  * Process trace object.
  *
- * Function must be called cyclically in 1ms intervals.
+ * Function must be called cyclically, usually from realtime thread. If sampling period is elapsed, function makes a
+ * record of mapped variables.
  *
  * @param trace This object.
- * @param timestamp Timestamp (usually in millisecond resolution).
+ * @param timestamp_us Monotonic time in microseconds.
+ * @param [out] timerNext_us info to OS - see CO_process().
  */
-void CO_trace_process(CO_trace_t *trace, uint32_t timestamp);
+void CO_trace_process(CO_trace_t* trace, uint64_t timestamp_us, uint32_t* timerNext_us);
 
 /** @} */ /* CO_trace */
 
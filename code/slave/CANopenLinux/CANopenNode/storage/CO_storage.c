@@ -47,8 +47,17 @@ OD_write_1010(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
     /* loop through entries and store relevant */
     uint8_t found = 0;
     ODR_t returnCode = ODR_OK;
+    uint8_t i = 0;
+
+    /* Repeated call, entry is being stored in background. Stream dataOffset contains index of that entry + 1 and
+     * return code from the previous entries. */
+    if (stream->dataOffset > 0U) {
+        i = (uint8_t)(stream->dataOffset & 0xFFU) - 1U;
+        returnCode = (ODR_t)(stream->dataOffset >> 8);
+        found = 2;
+    }
 
-    for (uint8_t i = 0; i < storage->entriesCount; i++) {
+    for (; i < storage->entriesCount; i++) {
         CO_storage_entry_t* entry = &storage->entries[i];
 
         if ((stream->subIndex == 1U) || (entry->subIndexOD == stream->subIndex)) {
@@ -57,13 +66,19 @@ OD_write_1010(OD_stream_t* stream, const void* buf, OD_size_t count, OD_size_t*
             }
             if ((entry->attr & (uint8_t)CO_storage_cmd) != 0U) {
                 ODR_t code = storage->store(entry, storage->CANmodule);
-                if (code != ODR_OK) {
+                if (code == ODR_PARTIAL) {
+                    stream->dataOffset = ((OD_size_t)returnCode << 8) | ((OD_size_t)i + 1U);
+                    *countWritten = 0;
+                    return ODR_PARTIAL;
+                } else if (code != ODR_OK) {
                     returnCode = code;
+                } else { /* MISRA C 2004 14.10 */
                 }
                 found = 2;
             }
         }
     }
+    stream->dataOffset = 0;
 
     if (found != 2U) {
         returnCode = (found == 0U) ? ODR_SUB_NOT_EXIST : ODR_READONLY;
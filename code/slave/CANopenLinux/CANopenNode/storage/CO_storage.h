@@ -116,7 +116,9 @@ typedef struct {
  * @param store Pointer to externally defined function, which will store data specified by @ref CO_storage_entry_t.
  * Function will be called when OD variable 0x1010 will be written. Argument to function is entry, where
  * 'entry->subIndexOD' equals accessed subIndex. Function returns value from
- * @ref ODR_t : "ODR_OK" in case of success, "ODR_HW" in case of hardware error.
+ * @ref ODR_t : "ODR_OK" in case of success, "ODR_HW" in case of hardware error. If data are written in background,
+ * function may return "ODR_PARTIAL". Then it is called again with the same entry (from SDO server, before response),
+ * until it returns the final result.
  * @param restore Same as 'store', but for restoring default data.
  * @param entries Pointer to array of storage entries. Array must be defined and initialized by application and must
  * exist permanently. Structure @ref CO_storage_entry_t is target specific and must be defined by CO_driver_target.h.
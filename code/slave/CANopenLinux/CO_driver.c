@@ -30,6 +30,7 @@
 #include <sys/socket.h>
 #include <asm/socket.h>
 #include <sys/eventfd.h>
+#include <sys/mman.h>
 #include <time.h>
 
 #include "301/CO_driver.h"
@@ -875,3 +876,43 @@ CO_CANrxFromEpoll(CO_CANmodule_t* CANmodule, struct epoll_event* ev, CO_CANrxMsg
     }
     return false;
 }
+
+#ifdef CO_USE_ARENA
+/* Length of the mapping is stored in front of the arena, which is then aligned to CO_ARENA_ALIGN */
+void*
+CO_LinuxArena_alloc(size_t size) {
+    size_t len = size + CO_ARENA_ALIGN;
+    uint8_t* map = MAP_FAILED;
+
+#if CO_ARENA_HUGEPAGE > 0
+    const size_t hugePage = (size_t)2U * 1024U * 1024U;
+    size_t hugeLen = (len + hugePage - 1U) & ~(hugePage - 1U);
+    map = mmap(NULL, hugeLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (map != MAP_FAILED) {
+        len = hugeLen;
+    }
+#endif
+    if (map == MAP_FAILED) {
+        map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (map == MAP_FAILED) {
+            return NULL;
+        }
+    }
+#if CO_ARENA_MLOCK > 0
+    if (mlock(map, len) != 0) {
+        log_printf(LOG_DEBUG, DBG_ERRNO, "mlock(arena)");
+    }
+#endif
+
+    *(size_t*)map = len;
+    return map + CO_ARENA_ALIGN;
+}
+
+void
+CO_LinuxArena_free(void* ptr) {
+    if (ptr != NULL) {
+        uint8_t* map = (uint8_t*)ptr - CO_ARENA_ALIGN;
+        (void)munmap(map, *(size_t*)map);
+    }
+}
+#endif /* CO_USE_ARENA */
@@ -63,15 +63,18 @@ extern "C" {
 
 #ifndef CO_CONFIG_HB_CONS
 #define CO_CONFIG_HB_CONS                                                                                              \
-    (CO_CONFIG_HB_CONS_ENABLE | CO_CONFIG_HB_CONS_CALLBACK_CHANGE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE                 \
-     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
+    (CO_CONFIG_HB_CONS_ENABLE | CO_CONFIG_HB_CONS_CALLBACK_CHANGE | CO_CONFIG_HB_CONS_NET_TABLE                       \
+     | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
 
 #ifndef CO_CONFIG_EM
 #define CO_CONFIG_EM                                                                                                   \
     (CO_CONFIG_EM_PRODUCER | CO_CONFIG_EM_PROD_CONFIGURABLE | CO_CONFIG_EM_PROD_INHIBIT | CO_CONFIG_EM_HISTORY         \
-     | CO_CONFIG_EM_STATUS_BITS | CO_CONFIG_EM_CONSUMER | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE                           \
-     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
+     | CO_CONFIG_EM_STATUS_BITS | CO_CONFIG_EM_CONSUMER | CO_CONFIG_EM_CONS_AGGREGATE                                  \
+     | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
+#define CO_EM_CONS_RX_SIZE   64U
+#define CO_EM_CONS_ENTRIES   64U
+#define CO_EM_CONS_HIST_SIZE 256U
 #endif
 
 #ifndef CO_CONFIG_SDO_SRV
@@ -87,19 +90,31 @@ extern "C" {
 #ifndef CO_CONFIG_SDO_CLI
 #define CO_CONFIG_SDO_CLI                                                                                              \
     (CO_CONFIG_SDO_CLI_ENABLE | CO_CONFIG_SDO_CLI_SEGMENTED | CO_CONFIG_SDO_CLI_BLOCK | CO_CONFIG_SDO_CLI_LOCAL        \
-     | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
+     | CO_CONFIG_SDO_CLI_BULK | CO_CONFIG_SDO_CLI_ADAPTIVE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE                      \
+     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
+#endif
+
+/* Example OD has CO_CONFIG_GTWA_SESSIONS + CO_CONFIG_SDO_CLI_BULK_COUNT SDO clients */
+#ifndef CO_CONFIG_SDO_CLI_BULK_COUNT
+#define CO_CONFIG_SDO_CLI_BULK_COUNT 4
+#endif
+
+#ifndef CO_CONFIG_SYNC
+#define CO_CONFIG_SYNC                                                                                                 \
+    (CO_CONFIG_SYNC_ENABLE | CO_CONFIG_SYNC_PRODUCER | CO_CONFIG_SYNC_PRODUCER_DEADLINE                               \
+     | CO_CONFIG_GLOBAL_RT_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
 
 #ifndef CO_CONFIG_TIME
 #define CO_CONFIG_TIME                                                                                                 \
-    (CO_CONFIG_TIME_ENABLE | CO_CONFIG_TIME_PRODUCER | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE                              \
+    (CO_CONFIG_TIME_ENABLE | CO_CONFIG_TIME_PRODUCER | CO_CONFIG_TIME_DISCIPLINE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE  \
      | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
 #endif
 
 #ifndef CO_CONFIG_LSS
 #define CO_CONFIG_LSS                                                                                                  \
     (CO_CONFIG_LSS_SLAVE | CO_CONFIG_LSS_SLAVE_FASTSCAN_DIRECT_RESPOND | CO_CONFIG_LSS_MASTER                          \
-     | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE)
+     | CO_CONFIG_LSS_MASTER_FASTSCAN_ADAPTIVE | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
 #endif
 
 #ifndef CO_CONFIG_GFC
@@ -108,24 +123,40 @@ extern "C" {
 
 #ifndef CO_CONFIG_SRDO
 #define CO_CONFIG_SRDO                                                                                                 \
-    (CO_CONFIG_SRDO_ENABLE | CO_CONFIG_SRDO_CHECK_TX | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE                              \
-     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
+    (CO_CONFIG_SRDO_ENABLE | CO_CONFIG_SRDO_CHECK_TX | CO_CONFIG_SRDO_DIRECT_MAP                                     \
+     | CO_CONFIG_GLOBAL_RT_FLAG_CALLBACK_PRE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
+#endif
+
+#ifndef CO_CONFIG_STORAGE
+#define CO_CONFIG_STORAGE (CO_CONFIG_STORAGE_ENABLE | CO_CONFIG_STORAGE_DIRTY)
 #endif
 
 #ifndef CO_CONFIG_GTW
 #define CO_CONFIG_GTW                                                                                                  \
     (CO_CONFIG_GTW_ASCII | CO_CONFIG_GTW_ASCII_SDO | CO_CONFIG_GTW_ASCII_NMT | CO_CONFIG_GTW_ASCII_LSS                 \
      | CO_CONFIG_GTW_ASCII_LOG | CO_CONFIG_GTW_ASCII_ERROR_DESC | CO_CONFIG_GTW_ASCII_PRINT_HELP                       \
-     | CO_CONFIG_GTW_ASCII_PRINT_LEDS)
+     | CO_CONFIG_GTW_ASCII_PRINT_LEDS | CO_CONFIG_GTW_BINARY | CO_CONFIG_GTW_ASCII_SUBSCRIBE                          \
+     | CO_CONFIG_GTW_ASCII_NODES | CO_CONFIG_GTW_ASCII_EMCY)
 #define CO_CONFIG_GTW_BLOCK_DL_LOOP  3
 #define CO_CONFIG_GTWA_COMM_BUF_SIZE 2000
 #define CO_CONFIG_GTWA_LOG_BUF_SIZE  10000
+#define CO_CONFIG_GTWA_SESSIONS      10
+#define CO_CONFIG_GTWA_SUBSCRIPTIONS 8
 #endif
 
 #ifndef CO_CONFIG_CRC16
-#define CO_CONFIG_CRC16 (CO_CONFIG_CRC16_ENABLE)
+#define CO_CONFIG_CRC16 (CO_CONFIG_CRC16_ENABLE | CO_CONFIG_CRC16_SLICE8)
 #endif
 
+#ifndef CO_CONFIG_TRACE
+#define CO_CONFIG_TRACE (CO_CONFIG_TRACE_ENABLE | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT)
+#endif
+
+/* Trace ring may be read by other processes from shared memory, so memory barrier is necessary also with
+ * CO_SINGLE_THREAD. */
+#define CO_TRACE_BARRIER()                                                                                             \
+    { __sync_synchronize(); }
+
 #ifndef CO_CONFIG_FIFO
 #define CO_CONFIG_FIFO                                                                                                 \
     (CO_CONFIG_FIFO_ENABLE | CO_CONFIG_FIFO_ALT_READ | CO_CONFIG_FIFO_CRC16_CCITT | CO_CONFIG_FIFO_ASCII_COMMANDS      \
@@ -306,6 +337,21 @@ typedef struct {
 #define CO_STORAGE_PATH_MAX 255
 #endif
 
+/* Data storage: if 1, data are stored on command by background thread (write-behind). OD 1010 command takes only a
+ * snapshot of data, SDO response is sent after file is written, synced, verified and renamed. */
+#ifndef CO_STORAGE_BACKGROUND
+#define CO_STORAGE_BACKGROUND 1
+#endif
+
+/* Data storage: auto storage with CO_CONFIG_STORAGE_DIRTY appends changed pages of data to journal file. When
+ * journal grows over maximum size, data are compacted into the main file. */
+#ifndef CO_STORAGE_PAGE_SIZE
+#define CO_STORAGE_PAGE_SIZE 32
+#endif
+#ifndef CO_STORAGE_JOURNAL_SIZE_MAX
+#define CO_STORAGE_JOURNAL_SIZE_MAX 16384
+#endif
+
 /* Data storage object for one entry */
 typedef struct {
     void* addr;
@@ -314,7 +360,17 @@ typedef struct {
     uint8_t attr;
     char filename[CO_STORAGE_PATH_MAX]; /* Name of the file, where data block is stored */
     uint16_t crc;                       /* CRC checksum of the data stored previously, for auto storage */
-    FILE* fp;                           /* Pointer to opened file, for auto storage */
+    FILE* fp;                           /* Opened file for auto storage, journal file with CO_CONFIG_STORAGE_DIRTY */
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+    uint8_t* dirty;     /* Bitmap of changed pages since last auto storage */
+    size_t journalSize; /* Current size of journal file */
+#endif
+#if CO_STORAGE_BACKGROUND > 0
+    uint8_t* snapshot;   /* Copy of data from store command, written to file by background thread */
+    uint8_t storeState;  /* State of background store: idle, queued or done */
+    uint8_t storeResult; /* ODR_t result of finished background store */
+    void* storeNext;     /* Next entry in queue of background thread */
+#endif
 } CO_storage_entry_t;
 
 #ifdef CO_SINGLE_THREAD
@@ -455,6 +511,58 @@ CO_ReturnError_t CO_CANtxBuffer_setInterface(CO_CANmodule_t* CANmodule, uint16_t
  */
 bool_t CO_CANrxFromEpoll(CO_CANmodule_t* CANmodule, struct epoll_event* ev, CO_CANrxMsg_t* buffer, int32_t* msgIndex);
 
+#if defined CO_USE_ARENA || defined CO_DOXYGEN
+/** Alignment of objects inside arena, cache line size of x86_64 and ARM Cortex-A processors */
+#ifndef CO_ARENA_ALIGN
+#define CO_ARENA_ALIGN 64U
+#endif
+
+/**
+ * Use huge page for arena with CANopenNode objects
+ *
+ * If CO_ARENA_HUGEPAGE is set to 1, then CO_LinuxArena_alloc() first tries to map the arena into one huge page
+ * (MAP_HUGETLB, huge pages must be reserved in /proc/sys/vm/nr_hugepages). Arena is usually much smaller than huge
+ * page, so this is disabled by default.
+ */
+#ifndef CO_ARENA_HUGEPAGE
+#define CO_ARENA_HUGEPAGE 0
+#endif
+
+/**
+ * Lock arena with CANopenNode objects into RAM
+ *
+ * If CO_ARENA_MLOCK is set to 1, then arena is locked with mlock(). All its pages are then present in memory before
+ * the realtime processing starts, which costs some time at startup. Disabled by default, canopend locks all its memory
+ * with mlockall() anyway, if realtime thread runs with priority.
+ */
+#ifndef CO_ARENA_MLOCK
+#define CO_ARENA_MLOCK 0
+#endif
+
+#define CO_arena_alloc(size) CO_LinuxArena_alloc(size)
+#define CO_arena_free(ptr)   CO_LinuxArena_free(ptr)
+
+/**
+ * Allocate arena for CANopenNode objects, see CO_USE_ARENA in CANopen.h
+ *
+ * Memory is mapped anonymously, so it is filled with zeros. Returned pointer is aligned to CO_ARENA_ALIGN, length of
+ * the mapping is stored in front of it. With CO_ARENA_MLOCK it is also locked into RAM, so realtime thread has no page
+ * faults on CANopenNode objects. If mlock() fails (missing privileges), arena is used anyway.
+ *
+ * @param size Size of the arena in bytes.
+ *
+ * @return Pointer to the arena or NULL.
+ */
+void* CO_LinuxArena_alloc(size_t size);
+
+/**
+ * Free arena allocated by CO_LinuxArena_alloc()
+ *
+ * @param ptr Pointer to the arena, may be NULL.
+ */
+void CO_LinuxArena_free(void* ptr);
+#endif /* CO_USE_ARENA */
+
 /** @} */
 
 #ifdef __cplusplus
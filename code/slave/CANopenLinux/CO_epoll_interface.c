@@ -39,12 +39,31 @@
 #include <sys/un.h>
 #include <netinet/in.h>
 #include <signal.h>
+#include <sys/uio.h>
 
 #ifndef LISTEN_BACKLOG
 #define LISTEN_BACKLOG 50
 #endif
 #endif /* (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII */
 
+/* Get number of objects from CO_config_t or from single default OD.h */
+#ifdef CO_MULTIPLE_OD
+#define CO_GET_CNT(obj) co->config->CNT_##obj
+#else
+#include "OD.h"
+#define CO_GET_CNT(obj) (uint8_t)(OD_CNT_##obj)
+#endif
+
+/* Number of gateway-ascii sessions, same as in CANopen.c */
+#if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) != 0
+#ifdef CO_MULTIPLE_OD
+#define CO_GTWA_SESSIONS_CNT(co)                                                                                       \
+    (((co)->config->CNT_GTWA < CO_CONFIG_GTWA_SESSIONS) ? (co)->config->CNT_GTWA : CO_CONFIG_GTWA_SESSIONS)
+#else
+#define CO_GTWA_SESSIONS_CNT(co) CO_CONFIG_GTWA_SESSIONS
+#endif
+#endif
+
 /* delay for recall CANsend(), if CAN TX buffer is full */
 #ifndef CANSEND_DELAY_US
 #define CANSEND_DELAY_US 100
@@ -71,6 +90,11 @@ CO_epoll_create(CO_epoll_t* ep, uint32_t timerInterval_us) {
 
     /* Configure epoll for mainline */
     ep->epoll_new = false;
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+    ep->SRDOstate = CO_SRDO_state_unknown;
+    ep->functSignalSRDOobject = NULL;
+    ep->pFunctSignalSRDO = NULL;
+#endif
     ep->epoll_fd = epoll_create(1);
     if (ep->epoll_fd < 0) {
         log_printf(LOG_CRIT, DBG_ERRNO, "epoll_create()");
@@ -117,6 +141,25 @@ CO_epoll_create(CO_epoll_t* ep, uint32_t timerInterval_us) {
     ep->previousTime_us = clock_gettime_us();
     ep->timeDifference_us = 0;
 
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+    /* Configure disarmed timer for SYNC producer and add it to epoll */
+    ep->syncEvent = false;
+    ep->syncDeadline_us = 0;
+    ep->syncPeriod_us = 0;
+    ep->sync_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    if (ep->sync_fd < 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "timerfd_create(sync)");
+        return CO_ERROR_SYSCALL;
+    }
+    ev.events = EPOLLIN;
+    ev.data.fd = ep->sync_fd;
+    ret = epoll_ctl(ep->epoll_fd, EPOLL_CTL_ADD, ev.data.fd, &ev);
+    if (ret < 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(sync_fd)");
+        return CO_ERROR_SYSCALL;
+    }
+#endif
+
     return CO_ERROR_NO;
 }
 
@@ -134,6 +177,11 @@ CO_epoll_close(CO_epoll_t* ep) {
 
     close(ep->timer_fd);
     ep->timer_fd = -1;
+
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+    close(ep->sync_fd);
+    ep->sync_fd = -1;
+#endif
 }
 
 void
@@ -146,6 +194,9 @@ CO_epoll_wait(CO_epoll_t* ep) {
     int ready = epoll_wait(ep->epoll_fd, &ep->ev, 1, -1);
     ep->epoll_new = true;
     ep->timerEvent = false;
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+    ep->syncEvent = false;
+#endif
 
     /* calculate time difference since last call */
     uint64_t now = clock_gettime_us();
@@ -177,6 +228,17 @@ CO_epoll_wait(CO_epoll_t* ep) {
         ep->epoll_new = false;
         ep->timerEvent = true;
     }
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+    else if ((ep->ev.events & EPOLLIN) != 0 && ep->ev.data.fd == ep->sync_fd) {
+        uint64_t val;
+        ssize_t s = read(ep->sync_fd, &val, sizeof(uint64_t));
+        if (s != sizeof(uint64_t) && errno != EAGAIN) {
+            log_printf(LOG_DEBUG, DBG_ERRNO, "read(sync_fd)");
+        }
+        ep->epoll_new = false;
+        ep->syncEvent = true;
+    }
+#endif
 }
 
 void
@@ -208,10 +270,8 @@ CO_epoll_processLast(CO_epoll_t* ep) {
 }
 
 /* MAINLINE *******************************************************************/
-#ifndef CO_SINGLE_THREAD
-/* Send event to wake CO_epoll_processMain() */
-static void
-wakeupCallback(void* object) {
+void
+CO_epoll_wakeup(void* object) {
     CO_epoll_t* ep = (CO_epoll_t*)object;
     uint64_t u = 1;
     ssize_t s;
@@ -220,7 +280,6 @@ wakeupCallback(void* object) {
         log_printf(LOG_DEBUG, DBG_ERRNO, "write()");
     }
 }
-#endif
 
 void
 CO_epoll_initCANopenMain(CO_epoll_t* ep, CO_t* co) {
@@ -233,7 +292,7 @@ CO_epoll_initCANopenMain(CO_epoll_t* ep, CO_t* co) {
     /* Configure LSS slave callback function */
 #if (CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE
 #if (CO_CONFIG_LSS) & CO_CONFIG_LSS_SLAVE
-    CO_LSSslave_initCallbackPre(co->LSSslave, (void*)ep, wakeupCallback);
+    CO_LSSslave_initCallbackPre(co->LSSslave, (void*)ep, CO_epoll_wakeup);
 #endif
 #endif
 
@@ -243,26 +302,30 @@ CO_epoll_initCANopenMain(CO_epoll_t* ep, CO_t* co) {
 
     /* Configure callback functions */
 #if (CO_CONFIG_NMT) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_NMT_initCallbackPre(co->NMT, (void*)ep, wakeupCallback);
+    CO_NMT_initCallbackPre(co->NMT, (void*)ep, CO_epoll_wakeup);
 #endif
 #if (CO_CONFIG_HB_CONS) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_HBconsumer_initCallbackPre(co->HBcons, (void*)ep, wakeupCallback);
+    CO_HBconsumer_initCallbackPre(co->HBcons, (void*)ep, CO_epoll_wakeup);
 #endif
 #if (CO_CONFIG_EM) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_EM_initCallbackPre(co->em, (void*)ep, wakeupCallback);
+    CO_EM_initCallbackPre(co->em, (void*)ep, CO_epoll_wakeup);
 #endif
 #if (CO_CONFIG_SDO_SRV) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_SDOserver_initCallbackPre(&co->SDOserver[0], (void*)ep, wakeupCallback);
+    for (uint16_t i = 0; i < CO_GET_CNT(SDO_SRV); i++) {
+        CO_SDOserver_initCallbackPre(&co->SDOserver[i], (void*)ep, CO_epoll_wakeup);
+    }
 #endif
 #if (CO_CONFIG_SDO_CLI) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_SDOclient_initCallbackPre(&co->SDOclient[0], (void*)ep, wakeupCallback);
+    for (uint16_t i = 0; i < CO_GET_CNT(SDO_CLI); i++) {
+        CO_SDOclient_initCallbackPre(&co->SDOclient[i], (void*)ep, CO_epoll_wakeup);
+    }
 #endif
 #if (CO_CONFIG_TIME) & CO_CONFIG_FLAG_CALLBACK_PRE
-    CO_TIME_initCallbackPre(co->TIME, (void*)ep, wakeupCallback);
+    CO_TIME_initCallbackPre(co->TIME, (void*)ep, CO_epoll_wakeup);
 #endif
 #if (CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE
 #if (CO_CONFIG_LSS) & CO_CONFIG_LSS_MASTER
-    CO_LSSmaster_initCallbackPre(co->LSSmaster, (void*)ep, wakeupCallback);
+    CO_LSSmaster_initCallbackPre(co->LSSmaster, (void*)ep, CO_epoll_wakeup);
 #endif
 #endif
 
@@ -285,6 +348,81 @@ CO_epoll_processMain(CO_epoll_t* ep, CO_t* co, bool_t enableGateway, CO_NMT_rese
 }
 
 /* CANrx and REALTIME *********************************************************/
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+/* Arm SYNC timer at ep->syncDeadline_us (minus prequeue time) or disarm it, if deadline is 0 */
+static void
+syncTimerSet(CO_epoll_t* ep) {
+    struct itimerspec tm = {0};
+
+    if (ep->syncDeadline_us != 0) {
+        uint64_t wake_us = ep->syncDeadline_us - CO_EPOLL_SYNC_PREQUEUE_US;
+        tm.it_value.tv_sec = wake_us / 1000000;
+        tm.it_value.tv_nsec = (wake_us % 1000000) * 1000;
+    }
+    if (timerfd_settime(ep->sync_fd, TFD_TIMER_ABSTIME, &tm, NULL) < 0) {
+        log_printf(LOG_DEBUG, DBG_ERRNO, "timerfd_settime(sync)");
+    }
+}
+
+/* Wait for the exact SYNC deadline, if timer woke the thread earlier, before CO_LOCK_OD is taken */
+static void
+syncPrequeueWait(CO_epoll_t* ep) {
+    if (CO_EPOLL_SYNC_PREQUEUE_US > 0 && ep->syncEvent && ep->syncDeadline_us != 0) {
+        struct timespec ts;
+        ts.tv_sec = ep->syncDeadline_us / 1000000;
+        ts.tv_nsec = (ep->syncDeadline_us % 1000000) * 1000;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+    }
+}
+
+/* SYNC producer with absolute deadlines. Transmit SYNC, if deadline is reached, and schedule the next one. Schedule
+ * starts with one period delay and restarts on change of the period, producer or NMT state. Must be called inside
+ * CO_LOCK_OD. */
+static void
+syncProcess(CO_epoll_t* ep, CO_t* co) {
+    CO_SYNC_t* SYNC = co->SYNC;
+    uint32_t period = 0;
+
+    if (CO_GET_CNT(SYNC) == 1 && SYNC->isProducer) {
+        CO_NMT_internalState_t NMTstate = CO_NMT_getInternalState(co->NMT);
+        if (NMTstate == CO_NMT_PRE_OPERATIONAL || NMTstate == CO_NMT_OPERATIONAL) {
+            period = *SYNC->OD_1006_period;
+        }
+    }
+
+    if (period == 0) {
+        if (ep->syncDeadline_us != 0) {
+            ep->syncDeadline_us = 0;
+            syncTimerSet(ep);
+        }
+        if (CO_GET_CNT(SYNC) == 1) {
+            CO_SYNC_setExternalTimer(SYNC, false);
+        }
+        return;
+    }
+
+    uint64_t now = clock_gettime_us();
+
+    if (ep->syncDeadline_us == 0 || period != ep->syncPeriod_us || !SYNC->extTimer) {
+        /* (re)start the schedule, SYNC object was reinitialized in communication reset */
+        ep->syncPeriod_us = period;
+        ep->syncDeadline_us = now + period;
+        CO_SYNC_setExternalTimer(SYNC, true);
+    } else if (now >= ep->syncDeadline_us) {
+        (void)CO_SYNC_sendDeadline(SYNC, now);
+        ep->syncDeadline_us += period;
+        if (ep->syncDeadline_us <= now) {
+            /* deadlines were missed, skip them, but keep the phase */
+            ep->syncDeadline_us += ((now - ep->syncDeadline_us) / period + 1) * period;
+        }
+    } else {
+        /* timer is armed and deadline is not reached yet */
+        return;
+    }
+    syncTimerSet(ep);
+}
+#endif
+
 void
 CO_epoll_processRT(CO_epoll_t* ep, CO_t* co, bool_t realtime) {
     if (co == NULL || ep == NULL) {
@@ -298,16 +436,33 @@ CO_epoll_processRT(CO_epoll_t* ep, CO_t* co, bool_t realtime) {
         }
     }
 
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+    syncPrequeueWait(ep);
+    if (!realtime || ep->timerEvent || ep->syncEvent) {
+#else
     if (!realtime || ep->timerEvent) {
+#endif
         uint32_t* pTimerNext_us = realtime ? NULL : &ep->timerNext_us;
 
         CO_LOCK_OD(co->CANmodule);
         if (!co->nodeIdUnconfigured && co->CANmodule->CANnormal) {
             bool_t syncWas = false;
 
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_PRODUCER_DEADLINE
+            syncProcess(ep, co);
+#endif
 #if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_ENABLE
             syncWas = CO_process_SYNC(co, ep->timeDifference_us, pTimerNext_us);
 #endif
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+            CO_SRDO_state_t SRDOstate = CO_process_SRDO(co, ep->timeDifference_us, pTimerNext_us);
+            if (SRDOstate != ep->SRDOstate) {
+                __atomic_store_n(&ep->SRDOstate, SRDOstate, __ATOMIC_RELEASE);
+                if (ep->pFunctSignalSRDO != NULL) {
+                    ep->pFunctSignalSRDO(ep->functSignalSRDOobject, SRDOstate);
+                }
+            }
+#endif
 #if (CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE
             CO_process_RPDO(co, syncWas, ep->timeDifference_us, pTimerNext_us);
 #endif
@@ -321,28 +476,106 @@ CO_epoll_processRT(CO_epoll_t* ep, CO_t* co, bool_t realtime) {
     }
 }
 
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+void
+CO_epoll_initCallbackSRDO(CO_epoll_t* ep, void* object, void (*pFunctSignal)(void* object, CO_SRDO_state_t state)) {
+    if (ep != NULL) {
+        ep->functSignalSRDOobject = object;
+        ep->pFunctSignalSRDO = pFunctSignal;
+    }
+}
+#endif
+
 /* GATEWAY ********************************************************************/
 #if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
-/* write response string from gateway-ascii object */
+/* copy response string from gateway-ascii object into output ring of the connection. It is written to the connection
+ * later, by gtwConnFlush(). */
 static size_t
 gtwa_write_response(void* object, const char* buf, size_t count, uint8_t* connectionOK) {
-    int* fd = (int*)object;
-    /* nWritten = count -> in case of error (non-existing fd) data are purged */
-    size_t nWritten = count;
-
-    if (fd != NULL && *fd >= 0) {
-        ssize_t n = write(*fd, (const void*)buf, count);
-        if (n >= 0) {
-            nWritten = (size_t)n;
+    CO_epoll_gtwConn_t* conn = (CO_epoll_gtwConn_t*)object;
+
+    if (conn == NULL || conn->fd < 0) {
+        /* return count -> in case of error (non-existing fd) data are purged */
+        *connectionOK = 0;
+        return count;
+    }
+
+    size_t space = CO_EPOLL_GTW_OUT_BUF_SIZE - conn->outCount;
+    size_t head = (conn->outStart + conn->outCount) % CO_EPOLL_GTW_OUT_BUF_SIZE;
+    size_t n1;
+
+    if (count > space) {
+        /* ring is full, gateway-ascii session will hold and retry */
+        count = space;
+    }
+    n1 = (count < (CO_EPOLL_GTW_OUT_BUF_SIZE - head)) ? count : (CO_EPOLL_GTW_OUT_BUF_SIZE - head);
+    memcpy(&conn->outBuf[head], buf, n1);
+    memcpy(&conn->outBuf[0], &buf[n1], count - n1);
+    conn->outCount += count;
+
+    return count;
+}
+
+/* enable or disable EPOLLOUT event for the connection */
+static void
+gtwConnWaitOut(CO_epoll_gtw_t* epGtw, CO_epoll_gtwConn_t* conn, bool_t wait) {
+    struct epoll_event ev = {0};
+
+    if (wait == conn->outWait) {
+        return;
+    }
+    ev.events = wait ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    ev.data.fd = conn->fd;
+    if (epoll_ctl(epGtw->epoll_fd, EPOLL_CTL_MOD, ev.data.fd, &ev) < 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(mod, gtwa_fd)");
+    } else {
+        conn->outWait = wait;
+    }
+}
+
+/* write output ring of the connection with single writev(), as much as connection accepts. Return true, if some space
+ * was freed in the ring. */
+static bool_t
+gtwConnFlush(CO_epoll_gtw_t* epGtw, CO_epoll_gtwConn_t* conn) {
+    struct iovec iov[2];
+    int iovcnt = 1;
+    size_t n1 = CO_EPOLL_GTW_OUT_BUF_SIZE - conn->outStart;
+
+    if (conn->outCount == 0) {
+        gtwConnWaitOut(epGtw, conn, false);
+        return false;
+    }
+
+    if (n1 > conn->outCount) {
+        n1 = conn->outCount;
+    }
+    iov[0].iov_base = &conn->outBuf[conn->outStart];
+    iov[0].iov_len = n1;
+    if (n1 < conn->outCount) {
+        iov[1].iov_base = &conn->outBuf[0];
+        iov[1].iov_len = conn->outCount - n1;
+        iovcnt = 2;
+    }
+
+    ssize_t n = writev(conn->fd, iov, iovcnt);
+    if (n < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            /* broken connection, it will be closed on EPOLLHUP or on read */
+            log_printf(LOG_DEBUG, DBG_ERRNO, "writev(gtwa_response)");
+            n = (ssize_t)conn->outCount;
         } else {
-            /* probably EAGAIN - "Resource temporarily unavailable". Retry. */
-            log_printf(LOG_DEBUG, DBG_ERRNO, "write(gtwa_response)");
-            nWritten = 0;
+            n = 0;
         }
-    } else {
-        *connectionOK = 0;
     }
-    return nWritten;
+
+    conn->outCount -= (size_t)n;
+    conn->outStart = (conn->outCount == 0) ? 0 : ((conn->outStart + (size_t)n) % CO_EPOLL_GTW_OUT_BUF_SIZE);
+
+    /* stdio is written on each processing, wait for EPOLLOUT on sockets */
+    if (epGtw->commandInterface != CO_COMMAND_IF_STDIO) {
+        gtwConnWaitOut(epGtw, conn, conn->outCount > 0);
+    }
+    return n > 0;
 }
 
 static inline void
@@ -358,6 +591,25 @@ socketAcceptEnableForEpoll(CO_epoll_gtw_t* epGtw) {
     }
 }
 
+/* close connection, clear its gateway-ascii session and enable socket accepting */
+static void
+socketConnClose(CO_epoll_gtw_t* epGtw, CO_epoll_gtwConn_t* conn, CO_GTWA_t* gtwa) {
+    int ret = epoll_ctl(epGtw->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    if (ret < 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(del, gtwa_fd)");
+    }
+    if (close(conn->fd) < 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "close(gtwa_fd)");
+    }
+    conn->fd = -1;
+    conn->outWait = false;
+    conn->outStart = 0;
+    conn->outCount = 0;
+    /* pending commands and responses must not be passed to the next client */
+    CO_GTWA_process(gtwa, false, 0, NULL);
+    socketAcceptEnableForEpoll(epGtw);
+}
+
 CO_ReturnError_t
 CO_epoll_createGtw(CO_epoll_gtw_t* epGtw, int epoll_fd, int32_t commandInterface, uint32_t socketTimeout_ms,
                    char* localSocketPath) {
@@ -374,10 +626,17 @@ CO_epoll_createGtw(CO_epoll_gtw_t* epGtw, int epoll_fd, int32_t commandInterface
     epGtw->socketTimeout_us = (socketTimeout_ms < (UINT_MAX / 1000 - 1000000)) ? socketTimeout_ms * 1000
                                                                                : (UINT_MAX - 1000000);
     epGtw->gtwa_fdSocket = -1;
-    epGtw->gtwa_fd = -1;
+    for (int i = 0; i < CO_CONFIG_GTWA_SESSIONS; i++) {
+        epGtw->conn[i].fd = -1;
+        epGtw->conn[i].socketTimeoutTmr_us = 0;
+        epGtw->conn[i].freshCommand = true;
+        epGtw->conn[i].outWait = false;
+        epGtw->conn[i].outStart = 0;
+        epGtw->conn[i].outCount = 0;
+    }
 
     if (commandInterface == CO_COMMAND_IF_STDIO) {
-        epGtw->gtwa_fd = STDIN_FILENO;
+        epGtw->conn[0].fd = STDIN_FILENO;
         log_printf(LOG_INFO, DBG_COMMAND_STDIO_INFO);
     } else if (commandInterface == CO_COMMAND_IF_LOCAL_SOCKET) {
         struct sockaddr_un addr;
@@ -457,9 +716,9 @@ CO_epoll_createGtw(CO_epoll_gtw_t* epGtw, int epoll_fd, int32_t commandInterface
         epGtw->commandInterface = CO_COMMAND_IF_DISABLED;
     }
 
-    if (epGtw->gtwa_fd >= 0) {
+    if (epGtw->conn[0].fd >= 0) {
         ev.events = EPOLLIN;
-        ev.data.fd = epGtw->gtwa_fd;
+        ev.data.fd = epGtw->conn[0].fd;
         ret = epoll_ctl(epGtw->epoll_fd, EPOLL_CTL_ADD, ev.data.fd, &ev);
         if (ret < 0) {
             log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(gtwa_fd)");
@@ -487,22 +746,22 @@ CO_epoll_closeGtw(CO_epoll_gtw_t* epGtw) {
         return;
     }
 
-    if (epGtw->commandInterface == CO_COMMAND_IF_LOCAL_SOCKET) {
-        if (epGtw->gtwa_fd > 0) {
-            close(epGtw->gtwa_fd);
+    if (epGtw->commandInterface == CO_COMMAND_IF_LOCAL_SOCKET
+        || epGtw->commandInterface >= CO_COMMAND_IF_TCP_SOCKET_MIN) {
+        for (int i = 0; i < CO_CONFIG_GTWA_SESSIONS; i++) {
+            if (epGtw->conn[i].fd > 0) {
+                close(epGtw->conn[i].fd);
+            }
         }
         close(epGtw->gtwa_fdSocket);
         /* Remove local socket file from filesystem. */
-        if (remove(epGtw->localSocketPath) < 0) {
+        if (epGtw->commandInterface == CO_COMMAND_IF_LOCAL_SOCKET && remove(epGtw->localSocketPath) < 0) {
             log_printf(LOG_CRIT, DBG_ERRNO, "remove(local)");
         }
-    } else if (epGtw->commandInterface >= CO_COMMAND_IF_TCP_SOCKET_MIN) {
-        if (epGtw->gtwa_fd > 0) {
-            close(epGtw->gtwa_fd);
-        }
-        close(epGtw->gtwa_fdSocket);
     }
-    epGtw->gtwa_fd = -1;
+    for (int i = 0; i < CO_CONFIG_GTWA_SESSIONS; i++) {
+        epGtw->conn[i].fd = -1;
+    }
     epGtw->gtwa_fdSocket = -1;
 }
 
@@ -512,8 +771,10 @@ CO_epoll_initCANopenGtw(CO_epoll_gtw_t* epGtw, CO_t* co) {
         return;
     }
 
-    CO_GTWA_initRead(co->gtwa, gtwa_write_response, (void*)&epGtw->gtwa_fd);
-    epGtw->freshCommand = true;
+    for (int i = 0; i < CO_GTWA_SESSIONS_CNT(co); i++) {
+        CO_GTWA_initRead(&co->gtwa[i], gtwa_write_response, (void*)&epGtw->conn[i]);
+        epGtw->conn[i].freshCommand = true;
+    }
 }
 
 void
@@ -522,39 +783,87 @@ CO_epoll_processGtw(CO_epoll_gtw_t* epGtw, CO_t* co, CO_epoll_t* ep) {
         return;
     }
 
+    int connCount = CO_GTWA_SESSIONS_CNT(co);
+    CO_epoll_gtwConn_t* conn = NULL;
+    CO_GTWA_t* gtwa = NULL;
+
+    /* Find connection, which belongs to epoll event */
+    if (ep->epoll_new && ep->ev.data.fd >= 0) {
+        for (int i = 0; i < connCount; i++) {
+            if (ep->ev.data.fd == epGtw->conn[i].fd) {
+                conn = &epGtw->conn[i];
+                gtwa = &co->gtwa[i];
+                break;
+            }
+        }
+    }
+
     /* Verify for epoll events */
-    if (ep->epoll_new && (ep->ev.data.fd == epGtw->gtwa_fdSocket || ep->ev.data.fd == epGtw->gtwa_fd)) {
-        if ((ep->ev.events & EPOLLIN) != 0 && ep->ev.data.fd == epGtw->gtwa_fdSocket) {
+    if (ep->epoll_new && ep->ev.data.fd == epGtw->gtwa_fdSocket && epGtw->gtwa_fdSocket >= 0) {
+        if ((ep->ev.events & EPOLLIN) != 0) {
             bool_t fail = false;
+            bool_t freeSlot = false;
+            int fd;
+
+            /* find free session for new connection */
+            for (int i = 0; i < connCount; i++) {
+                if (epGtw->conn[i].fd < 0) {
+                    conn = &epGtw->conn[i];
+                    break;
+                }
+            }
 
-            epGtw->gtwa_fd = accept4(epGtw->gtwa_fdSocket, NULL, NULL, SOCK_NONBLOCK);
-            if (epGtw->gtwa_fd < 0) {
+            fd = (conn != NULL) ? accept4(epGtw->gtwa_fdSocket, NULL, NULL, SOCK_NONBLOCK) : -1;
+            if (fd < 0) {
                 fail = true;
-                if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                if (conn != NULL && errno != EAGAIN && errno != EWOULDBLOCK) {
                     log_printf(LOG_CRIT, DBG_ERRNO, "accept(gtwa_fdSocket)");
                 }
             } else {
                 /* add fd to epoll */
                 struct epoll_event ev2 = {0};
                 ev2.events = EPOLLIN;
-                ev2.data.fd = epGtw->gtwa_fd;
+                ev2.data.fd = fd;
                 int ret = epoll_ctl(ep->epoll_fd, EPOLL_CTL_ADD, ev2.data.fd, &ev2);
                 if (ret < 0) {
                     fail = true;
                     log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(add, gtwa_fd)");
+                    close(fd);
+                } else {
+                    conn->fd = fd;
+                    conn->socketTimeoutTmr_us = 0;
+                    conn->freshCommand = true;
+                    conn->outWait = false;
+                    conn->outStart = 0;
+                    conn->outCount = 0;
                 }
-                epGtw->socketTimeoutTmr_us = 0;
             }
 
-            if (fail) {
+            /* keep accepting, while there are free sessions */
+            for (int i = 0; i < connCount; i++) {
+                if (epGtw->conn[i].fd < 0) {
+                    freeSlot = true;
+                    break;
+                }
+            }
+            if (fail || freeSlot) {
                 socketAcceptEnableForEpoll(epGtw);
             }
-            ep->epoll_new = false;
-        } else if ((ep->ev.events & EPOLLIN) != 0 && ep->ev.data.fd == epGtw->gtwa_fd) {
+        }
+        ep->epoll_new = false;
+    } else if (conn != NULL) {
+        if ((ep->ev.events & EPOLLOUT) != 0) {
+            /* connection is ready to accept the rest of the output ring */
+            if (gtwConnFlush(epGtw, conn) && gtwa->respHold) {
+                /* process gateway-ascii session, which waits for space, soon */
+                ep->timerNext_us = 0;
+            }
+        }
+        if ((ep->ev.events & EPOLLIN) != 0) {
             char buf[CO_CONFIG_GTWA_COMM_BUF_SIZE];
-            size_t space = co->nodeIdUnconfigured ? CO_CONFIG_GTWA_COMM_BUF_SIZE : CO_GTWA_write_getSpace(co->gtwa);
+            size_t space = co->nodeIdUnconfigured ? CO_CONFIG_GTWA_COMM_BUF_SIZE : CO_GTWA_write_getSpace(gtwa);
 
-            ssize_t s = read(epGtw->gtwa_fd, buf, space);
+            ssize_t s = read(conn->fd, buf, space);
 
             if (space == 0 || co->nodeIdUnconfigured) {
                 /* continue or purge data */
@@ -568,55 +877,58 @@ CO_epoll_processGtw(CO_epoll_gtw_t* epGtw, CO_t* co, CO_epoll_t* ep) {
                     bool_t closed = (buf[s - 1] == '\n'); /* is command closed? */
 
                     if (buf[0] != '[' && (space - s) >= strlen(sequence) && isgraph(buf[0]) && buf[0] != '#' && closed
-                        && epGtw->freshCommand) {
-                        CO_GTWA_write(co->gtwa, sequence, strlen(sequence));
+                        && conn->freshCommand) {
+                        CO_GTWA_write(gtwa, sequence, strlen(sequence));
                     }
-                    epGtw->freshCommand = closed;
-                    CO_GTWA_write(co->gtwa, buf, s);
+                    conn->freshCommand = closed;
+                    CO_GTWA_write(gtwa, buf, s);
                 } else { /* socket, local or tcp */
                     if (s == 0) {
                         /* EOF received, close connection and enable socket
                          * accepting */
-                        int ret = epoll_ctl(ep->epoll_fd, EPOLL_CTL_DEL, epGtw->gtwa_fd, NULL);
-                        if (ret < 0) {
-                            log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(del, gtwa_fd)");
-                        }
-                        if (close(epGtw->gtwa_fd) < 0) {
-                            log_printf(LOG_CRIT, DBG_ERRNO, "close(gtwa_fd)");
-                        }
-                        epGtw->gtwa_fd = -1;
-                        socketAcceptEnableForEpoll(epGtw);
+                        socketConnClose(epGtw, conn, gtwa);
                     } else {
-                        CO_GTWA_write(co->gtwa, buf, s);
+                        CO_GTWA_write(gtwa, buf, s);
                     }
                 }
+                /* Gateway was already processed in this cycle, don't wait for the timer with the new command */
+                ep->timerNext_us = 0;
             }
-            epGtw->socketTimeoutTmr_us = 0;
-
-            ep->epoll_new = false;
+            conn->socketTimeoutTmr_us = 0;
         } else if ((ep->ev.events & (EPOLLERR | EPOLLHUP)) != 0) {
             log_printf(LOG_DEBUG, DBG_GENERAL, "socket error or hangup, event=", ep->ev.events);
-            if (close(epGtw->gtwa_fd) < 0) {
+            if (epGtw->commandInterface != CO_COMMAND_IF_STDIO) {
+                socketConnClose(epGtw, conn, gtwa);
+            } else if (close(conn->fd) < 0) {
                 log_printf(LOG_CRIT, DBG_ERRNO, "close(gtwa_fd, hangup)");
             }
         }
+        ep->epoll_new = false;
     } /* if (ep->epoll_new) */
 
-    /* if socket connection is established, verify timeout */
-    if (epGtw->socketTimeout_us > 0 && epGtw->gtwa_fdSocket > 0 && epGtw->gtwa_fd > 0) {
-        if (epGtw->socketTimeoutTmr_us > epGtw->socketTimeout_us) {
-            /* timout expired, close current connection and accept next */
-            int ret = epoll_ctl(ep->epoll_fd, EPOLL_CTL_DEL, epGtw->gtwa_fd, NULL);
-            if (ret < 0) {
-                log_printf(LOG_CRIT, DBG_ERRNO, "epoll_ctl(del, gtwa_fd), tmo");
+    /* write responses, collected in the last processing, each connection with single writev() */
+    for (int i = 0; i < connCount; i++) {
+        CO_epoll_gtwConn_t* c = &epGtw->conn[i];
+        if (c->fd >= 0 && c->outCount > 0 && !c->outWait) {
+            if (gtwConnFlush(epGtw, c) && co->gtwa[i].respHold) {
+                ep->timerNext_us = 0;
+            }
+        }
+    }
+
+    /* if socket connections are established, verify timeouts */
+    if (epGtw->socketTimeout_us > 0 && epGtw->gtwa_fdSocket > 0) {
+        for (int i = 0; i < connCount; i++) {
+            CO_epoll_gtwConn_t* c = &epGtw->conn[i];
+            if (c->fd <= 0) {
+                continue;
             }
-            if (close(epGtw->gtwa_fd) < 0) {
-                log_printf(LOG_CRIT, DBG_ERRNO, "close(gtwa_fd), tmo");
+            if (c->socketTimeoutTmr_us > epGtw->socketTimeout_us) {
+                /* timout expired, close current connection and accept next */
+                socketConnClose(epGtw, c, &co->gtwa[i]);
+            } else {
+                c->socketTimeoutTmr_us += ep->timeDifference_us;
             }
-            epGtw->gtwa_fd = -1;
-            socketAcceptEnableForEpoll(epGtw);
-        } else {
-            epGtw->socketTimeoutTmr_us += ep->timeDifference_us;
         }
     }
 }
@@ -70,6 +70,16 @@ extern "C" {
  * processing. It can also trigger notification events in case of multi-thread operation.
  */
 
+#if (((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0) || defined CO_DOXYGEN
+#ifndef CO_EPOLL_SYNC_PREQUEUE_US
+/**
+ * SYNC producer timer wakes realtime thread so many microseconds before the deadline. Thread then prepares and waits
+ * for the exact deadline with clock_nanosleep(), so wakeup latency of epoll does not delay the SYNC. Zero disables.
+ */
+#define CO_EPOLL_SYNC_PREQUEUE_US 0
+#endif
+#endif
+
 /**
  * Object for epoll, timer and event API.
  */
@@ -86,6 +96,18 @@ typedef struct {
     struct itimerspec tm;       /**< Structure for timerfd */
     struct epoll_event ev;      /**< Structure for epoll_wait */
     bool_t epoll_new;           /**< true, if new epoll event is necessary to process */
+#if (((CO_CONFIG_SYNC)&CO_CONFIG_SYNC_PRODUCER_DEADLINE) != 0) || defined CO_DOXYGEN
+    int sync_fd;              /**< Timer file descriptor for SYNC producer, armed at absolute deadlines */
+    bool_t syncEvent;         /**< True, if SYNC timer event is inside @ref CO_epoll_wait() */
+    uint64_t syncDeadline_us; /**< Next SYNC deadline on CLOCK_MONOTONIC in microseconds, 0 if not scheduled */
+    uint32_t syncPeriod_us;   /**< Communication cycle period, from which syncDeadline_us is calculated */
+#endif
+#if (((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_ENABLE) != 0) || defined CO_DOXYGEN
+    CO_SRDO_state_t SRDOstate; /**< Lowest state of all SRDO objects from the last @ref CO_epoll_processRT(), written
+                                  atomically. Read it with @ref CO_epoll_getSRDOstate() from other threads. */
+    void* functSignalSRDOobject; /**< From CO_epoll_initCallbackSRDO() or NULL */
+    void (*pFunctSignalSRDO)(void* object, CO_SRDO_state_t state); /**< From CO_epoll_initCallbackSRDO() or NULL */
+#endif
 } CO_epoll_t;
 
 /**
@@ -109,6 +131,16 @@ CO_ReturnError_t CO_epoll_create(CO_epoll_t* ep, uint32_t timerInterval_us);
  */
 void CO_epoll_close(CO_epoll_t* ep);
 
+/**
+ * Wake the thread, which waits in @ref CO_epoll_wait()
+ *
+ * Function triggers eventfd, so the next processing of the epoll object is without delay. It may be called from any
+ * thread and is usable as a signal callback, for example with CO_xxx_initCallbackPre() functions.
+ *
+ * @param object Pointer to CO_epoll_t object
+ */
+void CO_epoll_wakeup(void* object);
+
 /**
  * Wait for an epoll event
  *
@@ -157,14 +189,19 @@ void CO_epoll_processMain(CO_epoll_t* ep, CO_t* co, bool_t enableGateway, CO_NMT
  * Process CAN receive and realtime functions
  *
  * This function checks epoll for CAN receive event and processes CANopen realtime functions: @ref CO_process_SYNC(),
- * @ref CO_process_RPDO() and @ref CO_process_TPDO().  It is non-blocking and should execute cyclically. It should be
- * between @ref CO_epoll_wait() and @ref CO_epoll_processLast() functions.
+ * @ref CO_process_SRDO(), @ref CO_process_RPDO() and @ref CO_process_TPDO(). It is non-blocking and should execute
+ * cyclically. It should be between @ref CO_epoll_wait() and @ref CO_epoll_processLast() functions.
  *
  * Function can be used in the mainline thread or in own realtime thread.
  *
  * Processing of CANopen realtime functions is protected with @ref CO_LOCK_OD. Also Node-Id must be configured and
  * CANmodule must be in CANnormal for processing.
  *
+ * If device is SYNC producer and CO_CONFIG_SYNC_PRODUCER_DEADLINE is enabled, SYNC messages are transmitted at
+ * absolute deadlines from own timerfd (TFD_TIMER_ABSTIME), see @ref CO_SYNC_sendDeadline(). Deadlines are multiples of
+ * _Communication cycle period_ from the start of the schedule, so period does not drift with scheduling latency of this
+ * function. Only one @ref CO_epoll_t object should process SYNC.
+ *
  * @param ep Pointer to @ref CO_epoll_t object.
  * @param co CANopen object
  * @param realtime Set to true, if function is called from the own realtime thread, and is executed at short constant
@@ -172,7 +209,42 @@ void CO_epoll_processMain(CO_epoll_t* ep, CO_t* co, bool_t enableGateway, CO_NMT
  */
 void CO_epoll_processRT(CO_epoll_t* ep, CO_t* co, bool_t realtime);
 
+#if (((CO_CONFIG_SRDO)&CO_CONFIG_SRDO_ENABLE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize callback, which is called, when state of SRDO objects changes
+ *
+ * Callback is called from @ref CO_epoll_processRT(), inside @ref CO_LOCK_OD, in the same cycle, in which SRDO state
+ * changed. If state is lower than @ref CO_SRDO_state_communicationEstablished, device must be in safe state, see
+ * @ref CO_SRDO. So safety reaction is bounded by the interval of the realtime thread. Callback must be fast.
+ *
+ * @param ep This object
+ * @param object Pointer to object, which will be passed to pFunctSignal(). Can be NULL.
+ * @param pFunctSignal Pointer to the callback function. Argument is the lowest state of all SRDO objects. Not called if
+ * NULL.
+ */
+void CO_epoll_initCallbackSRDO(CO_epoll_t* ep, void* object, void (*pFunctSignal)(void* object, CO_SRDO_state_t state));
+
+/**
+ * Get the lowest state of all SRDO objects from the last @ref CO_epoll_processRT()
+ *
+ * Function may be called from any thread.
+ *
+ * @param ep This object
+ *
+ * @return @ref CO_SRDO_state_t
+ */
+static inline CO_SRDO_state_t
+CO_epoll_getSRDOstate(const CO_epoll_t* ep) {
+    return __atomic_load_n(&ep->SRDOstate, __ATOMIC_ACQUIRE);
+}
+#endif
+
 #if ((CO_CONFIG_GTW)&CO_CONFIG_GTW_ASCII) || defined CO_DOXYGEN
+#ifndef CO_EPOLL_GTW_OUT_BUF_SIZE
+/** Size of the output ring buffer of each gateway connection in bytes, see @ref CO_epoll_gtwConn_t */
+#define CO_EPOLL_GTW_OUT_BUF_SIZE 16384
+#endif
+
 /**
  * Command interface type for gateway-ascii
  */
@@ -185,17 +257,37 @@ typedef enum {
 } CO_commandInterface_t;
 
 /**
- * Object for gateway
+ * Connection to gateway, one per gateway-ascii session
+ *
+ * Responses from gateway-ascii session are collected in output ring buffer and written to the connection with single
+ * writev() after the processing. If connection doesn't accept all data, EPOLLOUT event is enabled and remaining data
+ * are written when connection is ready. So slow client delays only own responses. Gateway-ascii session holds its
+ * state (respHold) only when its output ring is full.
  */
 typedef struct {
-    int epoll_fd;                 /**< Epoll file descriptor, from @ref CO_epoll_createGtw() */
-    int32_t commandInterface;     /**< Command interface type or tcp port number, see @ref CO_commandInterface_t */
-    uint32_t socketTimeout_us;    /**< Socket timeout in microseconds */
+    int fd;                       /**< Gateway io stream file descriptor, -1 if not connected */
     uint32_t socketTimeoutTmr_us; /**< Socket timeout timer in microseconds */
-    char* localSocketPath;        /**< Path in case of local socket */
-    int gtwa_fdSocket;            /**< Gateway socket file descriptor */
-    int gtwa_fd;                  /**< Gateway io stream file descriptor */
     bool_t freshCommand;          /**< Indication of fresh command */
+    bool_t outWait;               /**< True, if waiting for EPOLLOUT event to write the rest of outBuf */
+    size_t outStart;              /**< Index of the first byte in outBuf */
+    size_t outCount;              /**< Number of bytes in outBuf */
+    char outBuf[CO_EPOLL_GTW_OUT_BUF_SIZE]; /**< Output ring buffer, responses not yet written to the connection */
+} CO_epoll_gtwConn_t;
+
+/**
+ * Object for gateway
+ *
+ * In case of socket command interface each accepted connection is served by own gateway-ascii session (co->gtwa[i]),
+ * so up to @ref CO_CONFIG_GTWA_SESSIONS clients may be connected concurrently. New connections are accepted while
+ * there is a free session. Stdio command interface uses only the first session.
+ */
+typedef struct {
+    int epoll_fd;              /**< Epoll file descriptor, from @ref CO_epoll_createGtw() */
+    int32_t commandInterface;  /**< Command interface type or tcp port number, see @ref CO_commandInterface_t */
+    uint32_t socketTimeout_us; /**< Socket timeout in microseconds */
+    char* localSocketPath;     /**< Path in case of local socket */
+    int gtwa_fdSocket;         /**< Gateway socket file descriptor */
+    CO_epoll_gtwConn_t conn[CO_CONFIG_GTWA_SESSIONS]; /**< Connections, index matches gateway-ascii session */
 } CO_epoll_gtw_t;
 
 /**
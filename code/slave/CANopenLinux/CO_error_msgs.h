@@ -69,15 +69,19 @@ extern "C" {
     "infoCode=0x%08X"
 #define DBG_NMT_CHANGE         "CANopen NMT state changed to: \"%s\" (%d)"
 #define DBG_HB_CONS_NMT_CHANGE "CANopen Remote node ID = 0x%02X (index = %d): NMT state changed to: \"%s\" (%d)"
+#define DBG_SRDO_STATE         "CANopen SRDO %s state (%d)"
 #define DBG_ARGUMENT_UNKNOWN   "(%s) Unknown %s argument: \"%s\"", __func__
 #define DBG_NOT_TCP_PORT       "(%s) -c argument \"%s\" is not a valid tcp port", __func__
 #define DBG_WRONG_NODE_ID      "(%s) Wrong node ID \"%d\"", __func__
 #define DBG_WRONG_PRIORITY     "(%s) Wrong RT priority \"%d\"", __func__
 #define DBG_NO_CAN_DEVICE      "(%s) Can't find CAN device \"%s\"", __func__
 #define DBG_STORAGE            "(%s) Error with storage \"%s\"", __func__
+#define DBG_TRACE              "(%s) Error with trace \"%s\", err=%d", __func__
 #define DBG_OD_ENTRY           "(%s) Error in Object Dictionary entry: 0x%X", __func__
 #define DBG_CAN_OPEN           "(%s) CANopen error in %s, err=%d", __func__
 #define DBG_CAN_OPEN_INFO      "CANopen device, Node ID = 0x%02X, %s"
+#define DBG_ARENA_INFO         "CANopen objects in arena at %p: %u objects, %u bytes, %u bytes used"
+#define DBG_ARENA_ENTRY        "CANopen arena +0x%05X %7u bytes %s"
 
 /* CO_epoll_interface */
 #define DBG_EPOLL_UNKNOWN      "(%s) CAN Epoll error, events=0x%02x, fd=%d", __func__
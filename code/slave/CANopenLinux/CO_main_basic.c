@@ -20,8 +20,11 @@
 #include <linux/reboot.h>
 #include <sys/reboot.h>
 #include <fcntl.h>
+#include <sys/ioctl.h>
 #include <linux/i2c-dev.h>
 #include <linux/i2c.h>
+#include <sys/mman.h>
+#include <pthread.h>
 
 #include "CANopen.h"
 #include "OD.h"
@@ -34,7 +37,7 @@
 #endif
 
 #if (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE
-#include "CO_time_trace.h"
+#include "CO_traceLinux.h"
 #endif
 
 #ifndef MAIN_THREAD_INTERVAL_US
@@ -43,6 +46,9 @@
 #ifndef TMR_THREAD_INTERVAL_US
 #define TMR_THREAD_INTERVAL_US 1000
 #endif
+#ifndef NODE_ID_DEFAULT
+#define NODE_ID_DEFAULT 1
+#endif
 
 #ifndef NMT_CONTROL
 #define NMT_CONTROL \
@@ -58,7 +64,7 @@
 #define SDO_CLI_TIMEOUT_TIME 500
 #endif
 #ifndef SDO_CLI_BLOCK
-#define SDO_CLI_BLOCK false
+#define SDO_CLI_BLOCK true
 #endif
 #ifndef OD_STATUS_BITS
 #define OD_STATUS_BITS NULL
@@ -69,15 +75,31 @@
 #ifndef TIME_STAMP_INTERVAL_MS
 #define TIME_STAMP_INTERVAL_MS 10000
 #endif
+#ifndef CO_TIME_RX_DELAY_US
+#define CO_TIME_RX_DELAY_US 0
+#endif
 #ifndef CO_STORAGE_APPLICATION
 #define CO_STORAGE_APPLICATION
 #endif
+#ifndef CO_TRACE_FILE
+#define CO_TRACE_FILE "/dev/shm/CO_trace"
+#endif
+#ifndef CO_TRACE_BUFFER_SIZE
+#define CO_TRACE_BUFFER_SIZE 0x100000
+#endif
+#ifndef CO_NODES_FILE
+#define CO_NODES_FILE "/dev/shm/CO_nodes"
+#endif
 #ifndef CO_STORAGE_AUTO_INTERVAL
 #define CO_STORAGE_AUTO_INTERVAL 60000000
 #endif
 
 CO_t* CO = NULL;
 static uint8_t CO_activeNodeId = CO_LSS_NODE_ID_ASSIGNMENT;
+static uint8_t CO_pendingNodeId = NODE_ID_DEFAULT;
+#if (CO_CONFIG_LSS) & CO_CONFIG_LSS_SLAVE
+static uint16_t CO_pendingBitRate = 0; /* not used, bitrate is configured outside the program */
+#endif
 
 volatile sig_atomic_t CO_endProgram = 0;
 
@@ -127,11 +149,71 @@ static void sigHandler(int sig) {
     CO_endProgram = 1;
 }
 
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LOG
+/* Thread, which processes gateway, only this thread may write into the gateway log */
+static pthread_t mainlineThread;
+#endif
+
 void log_printf(int priority, const char* format, ...) {
     va_list ap;
     va_start(ap, format);
     vsyslog(priority, format, ap);
     va_end(ap);
+
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LOG
+    /* copy message also into the log of the first gateway session, readable with "log" command. Log fifo has no lock,
+     * so messages from other threads are only in syslog. */
+    if (CO != NULL && CO->gtwa != NULL && pthread_equal(pthread_self(), mainlineThread)) {
+        char buf[200];
+        time_t timer = time(NULL);
+        struct tm* tm_info = localtime(&timer);
+        size_t len = strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S: ", tm_info);
+
+        va_start(ap, format);
+        vsnprintf(buf + len, sizeof(buf) - len - 2, format, ap);
+        va_end(ap);
+        strcat(buf, "\r\n");
+        CO_GTWA_log_print(CO->gtwa, buf);
+    }
+#endif
+}
+
+static void printUsage(char* progName) {
+    printf("Usage: %s <CAN device name> [options]\n", progName);
+    printf("\n"
+           "Options:\n"
+           "  -i <Node ID>        CANopen Node-id (1..127) or 0xFF (LSS unconfigured).\n"
+           "                      Default is %d.\n", NODE_ID_DEFAULT);
+    printf("  -m <interval>       Interval of the mainline processing in microseconds.\n"
+           "                      Default is %d.\n", MAIN_THREAD_INTERVAL_US);
+#ifndef CO_SINGLE_THREAD
+    printf("  -t <interval>       Interval of the realtime thread in microseconds.\n"
+           "                      Default is %d.\n", TMR_THREAD_INTERVAL_US);
+    printf("  -p <RT priority>    Real-time priority of RT thread (1 .. 99). If not set or\n"
+           "                      set to -1, then normal scheduler is used for RT thread.\n"
+           "                      With priority all memory is locked into RAM.\n");
+#endif
+    printf("  -r                  Enable reboot on CANopen NMT reset_node command.\n");
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+    printf("  -s <storage path>   Path and filename prefix for data storage files.\n"
+           "                      By default files are stored in current directory.\n");
+#endif
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+    printf("  -c <interface>      Enable command interface for master functionality.\n"
+           "                      One of three types of interfaces can be specified as:\n"
+           "                   1. \"stdio\" - Standard IO of a program (terminal).\n"
+           "                   2. \"local-<file path>\" - Local socket interface on file\n"
+           "                      path, for example \"local-/tmp/CO_command_socket\".\n"
+           "                   3. \"tcp-<port>\" - Tcp socket interface on specified\n"
+           "                      port, for example \"tcp-60000\".\n"
+           "                      Socket interfaces accept up to %d concurrent clients.\n"
+           "                      Note that this option may affect security of the CAN.\n"
+           "  -T <timeout_time>   If -c is specified as local or tcp socket, then this\n"
+           "                      parameter specifies socket timeout time in milliseconds.\n"
+           "                      Default is 0 - no timeout on established connection.\n",
+           CO_CONFIG_GTWA_SESSIONS);
+#endif
+    printf("\n");
 }
 
 #ifndef CO_SINGLE_THREAD
@@ -139,6 +221,133 @@ CO_epoll_t epRT;
 static void* rt_thread(void* arg);
 #endif
 
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+/* SRDO state changed, called from CO_epoll_processRT() in the same realtime cycle. This device has no own safety
+ * related outputs, so safe state is driven on the network: on SRDO error Global fail-safe command puts all safety
+ * related devices into safe state. */
+static void SRDOsignal(void* object, CO_SRDO_state_t state) {
+    static bool_t errorPrev = false;
+    bool_t error = state < CO_SRDO_state_unknown;
+
+    (void)object;
+#if (CO_CONFIG_GFC) & CO_CONFIG_GFC_PRODUCER
+    if (error && !errorPrev && CO->GFC != NULL) {
+        (void)CO_GFCsend(CO->GFC);
+    }
+#endif
+    errorPrev = error;
+}
+
+/* Log change of SRDO between working and safe state, and each SRDO error, from mainline */
+static void SRDOstateLog(const CO_epoll_t* ep) {
+    static CO_SRDO_state_t statePrev = CO_SRDO_state_unknown;
+    static bool_t safePrev = false;
+    CO_SRDO_state_t state = CO_epoll_getSRDOstate(ep);
+    bool_t safe = state < CO_SRDO_state_communicationEstablished;
+
+    if (state == CO_SRDO_state_unknown || state == statePrev) {
+        return;
+    }
+    if (safe != safePrev || state < CO_SRDO_state_unknown) {
+        log_printf(state < CO_SRDO_state_unknown ? LOG_ERR : LOG_NOTICE, DBG_SRDO_STATE, safe ? "safe" : "working",
+                   state);
+    }
+    statePrev = state;
+    safePrev = safe;
+}
+#endif
+
+#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) && (OD_CNT_TRACE > 0)
+/* Sample OD variables into trace ring buffers, called after realtime processing */
+static void traceProcess(CO_epoll_t* ep, uint32_t* timerNext_us) {
+    for (uint16_t i = 0; i < OD_CNT_TRACE; i++) {
+        CO_trace_process(&CO->trace[i], ep->previousTime_us, timerNext_us);
+    }
+}
+#endif
+
+#if (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE
+/* Emergency messages, called from CO_EM_process(), repeated messages are rate limited */
+static void EmergencyRxCallback(const uint16_t ident, const uint16_t errorCode, const uint8_t errorRegister,
+                                const uint8_t errorBit, const uint32_t infoCode) {
+    int16_t nodeIdRx = ident ? (ident & 0x7F) : CO_activeNodeId;
+
+    log_printf(LOG_NOTICE, DBG_EMERGENCY_RX, nodeIdRx, errorCode, errorRegister, errorBit, infoCode);
+}
+#endif
+
+#if ((CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE) && (OD_CNT_HB_CONS > 0)
+/* Copy of the network state table in memory mapped file, for other programs on the same machine */
+static CO_HBconsumer_netTable_t* nodesShm = NULL;
+
+static void nodesShmInit(void) {
+    int fd = open(CO_NODES_FILE, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        log_printf(LOG_ERR, DBG_ERRNO, CO_NODES_FILE);
+        return;
+    }
+    if (ftruncate(fd, (off_t)sizeof(CO_HBconsumer_netTable_t)) == 0) {
+        void* buffer = mmap(NULL, sizeof(CO_HBconsumer_netTable_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (buffer != MAP_FAILED) {
+            nodesShm = (CO_HBconsumer_netTable_t*)buffer;
+            nodesShm->magic = CO_HBCONS_NET_MAGIC;
+            nodesShm->version = CO_HBCONS_NET_VERSION;
+            nodesShm->logSize = CO_HBCONS_NET_LOG_SIZE;
+        }
+    }
+    if (nodesShm == NULL) {
+        log_printf(LOG_ERR, DBG_ERRNO, CO_NODES_FILE);
+    }
+    close(fd);
+}
+
+/* Copy the table, if it was changed. Table is written by CO_process() from the same thread, so it is consistent here.
+ * Copy is protected by own sequence number, readers use it in the same way as with the original table. */
+static void nodesShmProcess(void) {
+    const CO_HBconsumer_netTable_t* table = CO->HBconsNetTable;
+    if ((nodesShm == NULL) || (table == NULL)) {
+        return;
+    }
+
+    uint32_t sequence = table->sequence;
+    if (nodesShm->sequence != sequence) {
+        nodesShm->sequence = sequence - 1U;
+        CO_MemoryBarrier();
+        nodesShm->logCount = table->logCount;
+        memcpy(nodesShm->nodes, table->nodes, sizeof(nodesShm->nodes));
+        memcpy(nodesShm->log, table->log, sizeof(nodesShm->log));
+        CO_MemoryBarrier();
+        nodesShm->sequence = sequence;
+    }
+    nodesShm->time_ms = table->time_ms;
+}
+#endif
+
+#if ((CO_CONFIG_TIME) & CO_CONFIG_TIME_DISCIPLINE) && (OD_CNT_TIME > 0)
+/* Seconds from January 1, 1970 (CLOCK_REALTIME) to January 1, 1984 (CANopen TIME) */
+#define TIME_EPOCH_OFFSET_S 441763200ULL
+
+/* Local clock for TIME producer and consumer, CLOCK_REALTIME in microseconds since January 1, 1984 */
+static uint64_t timeClock_us(void* object) {
+    struct timespec ts;
+
+    (void)object;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return ((uint64_t)ts.tv_sec - TIME_EPOCH_OFFSET_S) * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+#endif
+
+#if ((CO_CONFIG_NODE_GUARDING) & CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS)
+/* Clock for round-trip time of Node guarding master, CLOCK_MONOTONIC in microseconds */
+static uint64_t ngmClock_us(void* object) {
+    struct timespec ts;
+
+    (void)object;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+#endif
+
 /* ---------- NOVO: DEFINICIJE ZA PROSJEK TEMPERATURE ---------- */
 #define AVG_INTERVAL_SEC 3
 static float temp_sum = 0;
@@ -150,52 +359,201 @@ int main(int argc, char* argv[]) {
     CO_epoll_t epMain;
 #ifndef CO_SINGLE_THREAD
     pthread_t rt_thread_id;
+    bool_t rtThreadStarted = false;
+    int rtPriority = -1;
+    uint32_t rtInterval_us = TMR_THREAD_INTERVAL_US;
 #endif
+    uint32_t mainInterval_us = MAIN_THREAD_INTERVAL_US;
     CO_NMT_reset_cmd_t reset = CO_RESET_NOT;
     CO_ReturnError_t err;
     CO_CANptrSocketCan_t CANptr = {0};
+    int opt;
     bool_t firstRun = true;
 
     char* CANdevice = NULL;
+    bool_t rebootEnable = false;
+
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+    CO_storage_t storage;
+    CO_storage_entry_t storageEntries[] = {{.addr = &OD_PERSIST_COMM,
+                                            .len = sizeof(OD_PERSIST_COMM),
+                                            .subIndexOD = 2,
+                                            .attr = CO_storage_cmd | CO_storage_restore,
+                                            .filename = "od_comm.persist"},
+                                           CO_STORAGE_APPLICATION};
+    uint8_t storageEntriesCount = sizeof(storageEntries) / sizeof(storageEntries[0]);
+    uint32_t storageInitError = 0;
+    uint32_t storageErrorPrev = 0;
+    uint32_t storageIntervalTimer = 0;
+#endif
+
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+    CO_epoll_gtw_t epGtw;
+    int32_t commandInterface = CO_COMMAND_IF_DISABLED; /* values from CO_commandInterface_t */
+    char* localSocketPath = NULL;                      /* if commandInterface == CO_COMMAND_IF_LOCAL_SOCKET */
+    uint32_t socketTimeout_ms = 0;
+#endif
 
     /* configure system log */
     setlogmask(LOG_UPTO(LOG_DEBUG));
     openlog(argv[0], LOG_PID | LOG_PERROR, LOG_USER);
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII_LOG
+    mainlineThread = pthread_self();
+#endif
 
+    /* get program options */
     if (argc < 2 || strcmp(argv[1], "--help") == 0) {
-        printf("Usage: %s <CAN device name>\n", argv[0]);
+        printUsage(argv[0]);
         exit(EXIT_SUCCESS);
     }
+    while ((opt = getopt(argc, argv, "i:m:t:p:rc:T:s:")) != -1) {
+        switch (opt) {
+            case 'i': {
+                long int nodeIdLong = strtol(optarg, NULL, 0);
+                if (!((nodeIdLong >= 1 && nodeIdLong <= 127) || nodeIdLong == CO_LSS_NODE_ID_ASSIGNMENT)) {
+                    log_printf(LOG_CRIT, DBG_WRONG_NODE_ID, (int)nodeIdLong);
+                    exit(EXIT_FAILURE);
+                }
+                CO_pendingNodeId = (uint8_t)nodeIdLong;
+                break;
+            }
+            case 'm': mainInterval_us = strtoul(optarg, NULL, 0); break;
+#ifndef CO_SINGLE_THREAD
+            case 't': rtInterval_us = strtoul(optarg, NULL, 0); break;
+            case 'p': {
+                rtPriority = strtol(optarg, NULL, 0);
+                if (rtPriority != -1 && (rtPriority < sched_get_priority_min(SCHED_FIFO)
+                                         || rtPriority > sched_get_priority_max(SCHED_FIFO))) {
+                    log_printf(LOG_CRIT, DBG_WRONG_PRIORITY, rtPriority);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            }
+#endif
+            case 'r': rebootEnable = true; break;
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+            case 'c': {
+                const char* comm_stdio = "stdio";
+                const char* comm_local = "local-";
+                const char* comm_tcp = "tcp-";
+                if (strcmp(optarg, comm_stdio) == 0) {
+                    commandInterface = CO_COMMAND_IF_STDIO;
+                } else if (strncmp(optarg, comm_local, strlen(comm_local)) == 0) {
+                    commandInterface = CO_COMMAND_IF_LOCAL_SOCKET;
+                    localSocketPath = &optarg[strlen(comm_local)];
+                } else if (strncmp(optarg, comm_tcp, strlen(comm_tcp)) == 0) {
+                    const char* portStr = &optarg[strlen(comm_tcp)];
+                    uint16_t port;
+                    if (sscanf(portStr, "%hu", &port) != 1) {
+                        log_printf(LOG_CRIT, DBG_NOT_TCP_PORT, portStr);
+                        exit(EXIT_FAILURE);
+                    }
+                    commandInterface = port;
+                } else {
+                    log_printf(LOG_CRIT, DBG_ARGUMENT_UNKNOWN, "-c", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            }
+            case 'T': socketTimeout_ms = strtoul(optarg, NULL, 0); break;
+#endif
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+            case 's': {
+                /* add prefix to each storageEntries[i].filename */
+                size_t filePrefixLen = strlen(optarg);
+                for (uint8_t i = 0; i < storageEntriesCount; i++) {
+                    char* file = storageEntries[i].filename;
+                    size_t fileLen = strlen(file);
+                    if (fileLen + filePrefixLen < CO_STORAGE_PATH_MAX) {
+                        memmove(&file[filePrefixLen], &file[0], fileLen + 1);
+                        memcpy(&file[0], optarg, filePrefixLen);
+                    }
+                }
+                break;
+            }
+#endif
+            default: printUsage(argv[0]); exit(EXIT_FAILURE);
+        }
+    }
 
-    CANdevice = argv[1];
-    CANptr.can_ifindex = if_nametoindex(CANdevice);
+    if (optind < argc) {
+        CANdevice = argv[optind];
+        CANptr.can_ifindex = if_nametoindex(CANdevice);
+    }
     if (CANptr.can_ifindex == 0) {
-        printf("No CAN device: %s\n", CANdevice);
+        log_printf(LOG_CRIT, DBG_NO_CAN_DEVICE, CANdevice != NULL ? CANdevice : "");
         exit(EXIT_FAILURE);
     }
 
-    err = CO_epoll_create(&epMain, MAIN_THREAD_INTERVAL_US);
+    log_printf(LOG_INFO, DBG_CAN_OPEN_INFO, CO_pendingNodeId, "starting");
+
+    err = CO_epoll_create(&epMain, mainInterval_us);
     if (err != CO_ERROR_NO) {
-        printf("CO_epoll_create failed\n");
+        log_printf(LOG_CRIT, DBG_GENERAL, "CO_epoll_create(main), err=", err);
         exit(EXIT_FAILURE);
     }
 #ifdef CO_SINGLE_THREAD
     CANptr.epoll_fd = epMain.epoll_fd;
 #else
-    err = CO_epoll_create(&epRT, TMR_THREAD_INTERVAL_US);
+    err = CO_epoll_create(&epRT, rtInterval_us);
     if (err != CO_ERROR_NO) {
-        printf("CO_epoll_create(RT) failed\n");
+        log_printf(LOG_CRIT, DBG_GENERAL, "CO_epoll_create(RT), err=", err);
         exit(EXIT_FAILURE);
     }
     CANptr.epoll_fd = epRT.epoll_fd;
 #endif
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+    /* gateway sockets are served by the mainline epoll, together with its timer */
+    err = CO_epoll_createGtw(&epGtw, epMain.epoll_fd, commandInterface, socketTimeout_ms, localSocketPath);
+    if (err != CO_ERROR_NO) {
+        log_printf(LOG_CRIT, DBG_GENERAL, "CO_epoll_createGtw(), err=", err);
+        exit(EXIT_FAILURE);
+    }
+#endif
 
     uint32_t heapMemoryUsed = 0;
     CO = CO_new(NULL, &heapMemoryUsed);
     if (CO == NULL) {
-        printf("CO_new failed\n");
+        log_printf(LOG_CRIT, DBG_GENERAL, "CO_new(), heapMemoryUsed=", heapMemoryUsed);
+        exit(EXIT_FAILURE);
+    }
+#ifdef CO_USE_ARENA
+    /* layout of CANopenNode objects, realtime objects are at the beginning */
+    uint32_t arenaUsed = 0;
+    for (uint8_t i = 0; i < CO->arenaEntries; i++) {
+        const CO_arenaEntry_t* entry = &CO->arenaLayout[i];
+        log_printf(LOG_DEBUG, DBG_ARENA_ENTRY, entry->offset, entry->size, entry->name);
+        arenaUsed += entry->size;
+    }
+    log_printf(LOG_INFO, DBG_ARENA_INFO, CO->arena, CO->arenaEntries, CO->arenaSize, arenaUsed);
+#endif
+
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+    err = CO_storageLinux_init(&storage, CO->CANmodule, OD_ENTRY_H1010_storeParameters,
+                               OD_ENTRY_H1011_restoreDefaultParameters, storageEntries, storageEntriesCount,
+                               &storageInitError);
+    if (err != CO_ERROR_NO && err != CO_ERROR_DATA_CORRUPT) {
+        char* filename = err == CO_ERROR_ILLEGAL_ARGUMENT ? "" : storageEntries[storageInitError].filename;
+        log_printf(LOG_CRIT, DBG_STORAGE, filename);
         exit(EXIT_FAILURE);
     }
+#endif
+#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) && (OD_CNT_TRACE > 0)
+    for (uint16_t i = 0; i < OD_CNT_TRACE; i++) {
+        char traceFile[64];
+        uint32_t traceErrInfo = 0;
+        snprintf(traceFile, sizeof(traceFile), "%s%u", CO_TRACE_FILE, i);
+        err = CO_traceLinux_init(&CO->trace[i], OD, OD_find(OD, OD_INDEX_TRACE_CONFIG + i),
+                                 OD_find(OD, OD_INDEX_TRACE + i), traceFile, CO_TRACE_BUFFER_SIZE, &traceErrInfo);
+        if (err != CO_ERROR_NO) {
+            /* trace is not essential, continue without it */
+            log_printf(LOG_ERR, DBG_TRACE, traceFile, err);
+        }
+    }
+#endif
+#if ((CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE) && (OD_CNT_HB_CONS > 0)
+    nodesShmInit();
+#endif
 
     signal(SIGINT, sigHandler);
     signal(SIGTERM, sigHandler);
@@ -224,6 +582,8 @@ int main(int argc, char* argv[]) {
     /* -------------------------------------- */
 
     while (reset != CO_RESET_APP && reset != CO_RESET_QUIT && CO_endProgram == 0) {
+        uint32_t errInfo = 0;
+
         if (!firstRun) {
             CO_LOCK_OD(CO->CANmodule);
             CO->CANmodule->CANnormal = false;
@@ -234,75 +594,258 @@ int main(int argc, char* argv[]) {
         CO_CANmodule_disable(CO->CANmodule);
 
         err = CO_CANinit(CO, (void*)&CANptr, 0);
-        if (err != CO_ERROR_NO) { printf("CO_CANinit failed\n"); exit(EXIT_FAILURE); }
+        if (err != CO_ERROR_NO) {
+            log_printf(LOG_CRIT, DBG_CAN_OPEN, "CO_CANinit()", err);
+            programExit = EXIT_FAILURE;
+            break;
+        }
+
+#if (CO_CONFIG_LSS) & CO_CONFIG_LSS_SLAVE
+        CO_LSS_address_t lssAddress = {.identity = {.vendorID = OD_PERSIST_COMM.x1018_identity.vendor_ID,
+                                                    .productCode = OD_PERSIST_COMM.x1018_identity.productCode,
+                                                    .revisionNumber = OD_PERSIST_COMM.x1018_identity.revisionNumber,
+                                                    .serialNumber = OD_PERSIST_COMM.x1018_identity.serialNumber}};
+        err = CO_LSSinit(CO, &lssAddress, &CO_pendingNodeId, &CO_pendingBitRate);
+        if (err != CO_ERROR_NO) {
+            log_printf(LOG_CRIT, DBG_CAN_OPEN, "CO_LSSinit()", err);
+            programExit = EXIT_FAILURE;
+            break;
+        }
+#endif
+
+        CO_activeNodeId = CO_pendingNodeId;
 
         err = CO_CANopenInit(CO, NULL, NULL, OD, OD_STATUS_BITS, NMT_CONTROL,
                              FIRST_HB_TIME, SDO_SRV_TIMEOUT_TIME,
                              SDO_CLI_TIMEOUT_TIME, SDO_CLI_BLOCK,
-                             1, NULL);
-        if (err != CO_ERROR_NO) { printf("CO_CANopenInit failed\n"); exit(EXIT_FAILURE); }
+                             CO_activeNodeId, &errInfo);
+        if (err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS) {
+            if (err == CO_ERROR_OD_PARAMETERS) {
+                log_printf(LOG_CRIT, DBG_OD_ENTRY, errInfo);
+            } else {
+                log_printf(LOG_CRIT, DBG_CAN_OPEN, "CO_CANopenInit()", err);
+            }
+            programExit = EXIT_FAILURE;
+            break;
+        }
 
         CO_epoll_initCANopenMain(&epMain, CO);
+#if ((CO_CONFIG_TIME) & CO_CONFIG_TIME_DISCIPLINE) && (OD_CNT_TIME > 0)
+        /* TIME producer sends realtime clock, consumer disciplines it, depending on 0x1012 */
+        CO_TIME_initClock(CO->TIME, NULL, timeClock_us, CO_TIME_RX_DELAY_US);
+        CO_TIME_set(CO->TIME, 0, 0, TIME_STAMP_INTERVAL_MS);
+#endif
+#if ((CO_CONFIG_NODE_GUARDING) & CO_CONFIG_NODE_GUARDING_MASTER_STATISTICS)
+        CO_nodeGuardingMaster_initClock(CO->NGmaster, NULL, ngmClock_us);
+#endif
+#if (CO_CONFIG_EM) & CO_CONFIG_EM_CONS_AGGREGATE
+        CO_EM_initCallbackRx(CO->em, EmergencyRxCallback);
+#endif
+#if ((CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE) && (CO_STORAGE_BACKGROUND > 0)
+        CO_storageLinux_initCallbackPre(&storage, (void*)&epMain, CO_epoll_wakeup);
+#endif
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+        CO_epoll_initCANopenGtw(&epGtw, CO);
+#endif
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+#ifdef CO_SINGLE_THREAD
+        CO_epoll_initCallbackSRDO(&epMain, NULL, SRDOsignal);
+#else
+        CO_epoll_initCallbackSRDO(&epRT, NULL, SRDOsignal);
+#endif
+#endif
+
+        if (!CO->nodeIdUnconfigured) {
+            if (errInfo != 0) {
+                CO_errorReport(CO->em, CO_EM_INCONSISTENT_OBJECT_DICT, CO_EMC_DATA_SET, errInfo);
+            }
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+            if (storageInitError != 0) {
+                CO_errorReport(CO->em, CO_EM_NON_VOLATILE_MEMORY, CO_EMC_HARDWARE, storageInitError);
+            }
+#endif
+        } else {
+            log_printf(LOG_INFO, DBG_CAN_OPEN_INFO, CO_activeNodeId, "node-id not initialized");
+        }
 
         if (firstRun) {
             firstRun = false;
 #ifndef CO_SINGLE_THREAD
+            if (rtPriority > 0 && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+                /* page faults may delay realtime thread, but it still works */
+                log_printf(LOG_WARNING, DBG_ERRNO, "mlockall()");
+            }
             if (pthread_create(&rt_thread_id, NULL, rt_thread, NULL) != 0) {
-                printf("pthread_create failed\n");
-                exit(EXIT_FAILURE);
+                log_printf(LOG_CRIT, DBG_ERRNO, "pthread_create(rt_thread)");
+                programExit = EXIT_FAILURE;
+                CO_endProgram = 1;
+                break;
+            }
+            rtThreadStarted = true;
+            if (rtPriority > 0) {
+                struct sched_param param;
+
+                param.sched_priority = rtPriority;
+                if (pthread_setschedparam(rt_thread_id, SCHED_FIFO, &param) != 0) {
+                    log_printf(LOG_CRIT, DBG_ERRNO, "pthread_setschedparam()");
+                    programExit = EXIT_FAILURE;
+                    CO_endProgram = 1;
+                    break;
+                }
             }
 #endif
         }
 
-        err = CO_CANopenInitPDO(CO, CO->em, OD, 1, NULL);
-        if (err != CO_ERROR_NO) { printf("CO_CANopenInitPDO failed\n"); exit(EXIT_FAILURE); }
+        errInfo = 0;
+        err = CO_CANopenInitPDO(CO, CO->em, OD, CO_activeNodeId, &errInfo);
+        if (err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS) {
+            if (err == CO_ERROR_OD_PARAMETERS) {
+                log_printf(LOG_CRIT, DBG_OD_ENTRY, errInfo);
+            } else {
+                log_printf(LOG_CRIT, DBG_CAN_OPEN, "CO_CANopenInitPDO()", err);
+            }
+            programExit = EXIT_FAILURE;
+            break;
+        }
 
         CO_CANsetNormalMode(CO->CANmodule);
 
         reset = CO_RESET_NOT;
-        printf("CANopenNode running...\n");
+        log_printf(LOG_INFO, DBG_CAN_OPEN_INFO, CO_activeNodeId, "running ...");
 
+        uint32_t sensorTimer_us = mainInterval_us;
         while (reset == CO_RESET_NOT && CO_endProgram == 0) {
             CO_epoll_wait(&epMain);
 #ifdef CO_SINGLE_THREAD
             CO_epoll_processRT(&epMain, CO, false);
+#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) && (OD_CNT_TRACE > 0)
+            traceProcess(&epMain, &epMain.timerNext_us);
+#endif
 #endif
             CO_epoll_processMain(&epMain, CO, GATEWAY_ENABLE, &reset);
-            CO_epoll_processLast(&epMain);
-
-            /* ---- ČITANJE SENZORA ---- */
-            float temp = read_temperature();
-            OD_RAM.x2000_temperature = (int16_t) temp;
-
-            /* ---- AKUMULACIJA ZA PROSJEK ---- */
-            temp_sum += temp;
-            temp_count++;
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+            CO_epoll_processGtw(&epGtw, CO, &epMain);
+#endif
+#if ((CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE) && (OD_CNT_HB_CONS > 0)
+            nodesShmProcess();
+#endif
+#if (CO_CONFIG_SRDO) & CO_CONFIG_SRDO_ENABLE
+#ifdef CO_SINGLE_THREAD
+            SRDOstateLog(&epMain);
+#else
+            SRDOstateLog(&epRT);
+#endif
+#endif
 
-            time_t now = time(NULL);
-            if (now - last_avg_time >= AVG_INTERVAL_SEC) {
-                float avrg = temp_count ? temp_sum / temp_count : 0.0;
-                printf("Prosjecna temperatura (%d sec) = %.2f C\n", AVG_INTERVAL_SEC, avrg);
-                fflush(stdout);
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+            /* don't save more often than interval */
+            if (storageIntervalTimer < CO_STORAGE_AUTO_INTERVAL) {
+                storageIntervalTimer += epMain.timeDifference_us;
+            } else {
+                uint32_t mask = CO_storageLinux_auto_process(&storage, false);
+                if (mask != storageErrorPrev && !CO->nodeIdUnconfigured) {
+                    if (mask != 0) {
+                        CO_errorReport(CO->em, CO_EM_NON_VOLATILE_AUTO_SAVE, CO_EMC_HARDWARE, mask);
+                    } else {
+                        CO_errorReset(CO->em, CO_EM_NON_VOLATILE_AUTO_SAVE, 0);
+                    }
+                }
+                storageErrorPrev = mask;
+                storageIntervalTimer = 0;
+            }
+#endif
 
-                /* Reset za sljedeći interval */
-                temp_sum = 0;
-                temp_count = 0;
-                last_avg_time = now;
+            /* ---- ČITANJE SENZORA ----
+             * Čitanje traje ~20 ms (konverzija), zato najviše jednom po intervalu glavne petlje, a ne na svaki
+             * događaj (CAN, gateway socket). */
+            sensorTimer_us += epMain.timeDifference_us;
+            if (sensorTimer_us >= mainInterval_us) {
+                sensorTimer_us = 0;
+
+                float temp = read_temperature();
+                OD_RAM.x2000_temperature = (int16_t) temp;
+
+                /* ---- AKUMULACIJA ZA PROSJEK ---- */
+                temp_sum += temp;
+                temp_count++;
+
+                time_t now = time(NULL);
+                bool_t avgDone = now - last_avg_time >= AVG_INTERVAL_SEC;
+#if ((CO_CONFIG_TIME) & CO_CONFIG_TIME_DISCIPLINE) && (OD_CNT_TIME > 0)
+                /* Mrežno vrijeme (TIME) je zajedničko svim čvorovima, pa su granice intervala poravnate na
+                 * višekratnike AVG_INTERVAL_SEC i čvorovi usrednjavaju iste intervale. */
+                uint64_t netTime_us;
+                if (CO_TIME_getNetworkTime(CO->TIME, &netTime_us)) {
+                    now = (time_t)(netTime_us / 1000000 + TIME_EPOCH_OFFSET_S);
+                    avgDone = now / AVG_INTERVAL_SEC != last_avg_time / AVG_INTERVAL_SEC;
+                }
+#endif
+                if (avgDone) {
+                    float avrg = temp_count ? temp_sum / temp_count : 0.0;
+                    char timeStr[32];
+                    struct tm tmNow;
+                    strftime(timeStr, sizeof(timeStr), "%Y-%m-%dT%H:%M:%SZ", gmtime_r(&now, &tmNow));
+                    printf("Prosjecna temperatura (%d sec) = %.2f C, %s\n", AVG_INTERVAL_SEC, avrg, timeStr);
+                    fflush(stdout);
+
+                    /* Reset za sljedeći interval */
+                    temp_sum = 0;
+                    temp_count = 0;
+                    last_avg_time = now;
+                }
             }
+
+            CO_epoll_processLast(&epMain);
         }
     }
 
     CO_endProgram = 1;
 #ifndef CO_SINGLE_THREAD
-    pthread_join(rt_thread_id, NULL);
+    if (rtThreadStarted && pthread_join(rt_thread_id, NULL) != 0) {
+        log_printf(LOG_CRIT, DBG_ERRNO, "pthread_join()");
+    }
+#endif
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
+    CO_storageLinux_auto_process(&storage, true);
+#endif
+#ifndef CO_SINGLE_THREAD
     CO_epoll_close(&epRT);
 #endif
     CO_epoll_close(&epMain);
-    CO_delete(CO);
+#if (CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+    CO_epoll_closeGtw(&epGtw);
+#endif
+#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) && (OD_CNT_TRACE > 0)
+    for (uint16_t i = 0; i < OD_CNT_TRACE; i++) {
+        CO_traceLinux_close(&CO->trace[i]);
+    }
+#endif
+#if ((CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_NET_TABLE) && (OD_CNT_HB_CONS > 0)
+    if (nodesShm != NULL) {
+        /* file is not removed, so the last state remains readable */
+        munmap(nodesShm, sizeof(CO_HBconsumer_netTable_t));
+        nodesShm = NULL;
+    }
+#endif
+    CO_CANsetConfigurationMode((void*)&CANptr);
+    /* log_printf() must not access CANopen objects any more */
+    CO_t* co = CO;
+    CO = NULL;
+    CO_delete(co);
 
     close(i2c_fd);
 
-    printf("CANopenNode finished\n");
+    log_printf(LOG_INFO, DBG_CAN_OPEN_INFO, CO_activeNodeId, "finished");
+
+    /* flush all buffers (and reboot) */
+    if (rebootEnable && reset == CO_RESET_APP) {
+        sync();
+        if (reboot(LINUX_REBOOT_CMD_RESTART) != 0) {
+            log_printf(LOG_CRIT, DBG_ERRNO, "reboot()");
+            exit(EXIT_FAILURE);
+        }
+    }
+
     exit(programExit);
 }
 
@@ -312,6 +855,9 @@ static void* rt_thread(void* arg) {
     while (CO_endProgram == 0) {
         CO_epoll_wait(&epRT);
         CO_epoll_processRT(&epRT, CO, true);
+#if ((CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE) && (OD_CNT_TRACE > 0)
+        traceProcess(&epRT, NULL);
+#endif
         CO_epoll_processLast(&epRT);
     }
     return NULL;
@@ -23,97 +23,391 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if CO_STORAGE_BACKGROUND > 0
+#include <pthread.h>
+#endif
 
 #if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
 
 /*
- * Function for writing data on "Store parameters" command - OD object 1010
+ * Write data with CRC into file safely
  *
- * For more information see file CO_storage.h, CO_storage_entry_t.
+ * Data are written into temporary file, synced, verified and then atomically renamed to filename. Previous file is
+ * renamed to *.old.
+ *
+ * @param filename Name of the file
+ * @param data Data to write, must not change during the function call.
+ * @param len Length of data
+ *
+ * @return ODR_OK, ODR_OUT_OF_MEM or ODR_HW
  */
 static ODR_t
-storeLinux(CO_storage_entry_t* entry, CO_CANmodule_t* CANmodule) {
-    (void)CANmodule;
+writeFileSafe(const char* filename, const void* data, size_t len) {
     ODR_t ret = ODR_OK;
-    uint16_t crc_store;
+    uint16_t crc_store = crc16_ccitt(data, len, 0);
 
     /* Create names for temporary and old file */
-    size_t fn_len = strlen(entry->filename) + 5;
-    char* filename_tmp = malloc(fn_len);
-    char* filename_old = malloc(fn_len);
-    if (filename_tmp == NULL || filename_old == NULL) {
-        if (filename_tmp != NULL) {
-            free(filename_tmp);
-        }
-        if (filename_old != NULL) {
-            free(filename_old);
-        }
-        ret = ODR_OUT_OF_MEM;
+    char filename_tmp[CO_STORAGE_PATH_MAX + 4];
+    char filename_old[CO_STORAGE_PATH_MAX + 4];
+    snprintf(filename_tmp, sizeof(filename_tmp), "%s.tmp", filename);
+    snprintf(filename_old, sizeof(filename_old), "%s.old", filename);
+
+    /* Open a temporary file, write data to it and flush it to the disk */
+    FILE* fp = fopen(filename_tmp, "w");
+    if (fp == NULL) {
+        ret = ODR_HW;
     } else {
-        strcpy(filename_tmp, entry->filename);
-        strcpy(filename_old, entry->filename);
-        strcat(filename_tmp, ".tmp");
-        strcat(filename_old, ".old");
-    }
-
-    /* Open a temporary file and write data to it */
-    if (ret == ODR_OK) {
-        FILE* fp = fopen(filename_tmp, "w");
-        if (fp == NULL) {
+        size_t cnt = fwrite(data, 1, len, fp);
+        cnt += fwrite(&crc_store, 1, sizeof(crc_store), fp);
+        if (fflush(fp) != 0 || fsync(fileno(fp)) != 0) {
+            ret = ODR_HW;
+        }
+        fclose(fp);
+        if (cnt != (len + sizeof(crc_store))) {
             ret = ODR_HW;
-        } else {
-            /* following two lines are subject to race conditions. This function is called only by SDO server
-             * and so it is already protected by CO_LOCK_OD. */
-            size_t cnt = fwrite(entry->addr, 1, entry->len, fp);
-            crc_store = crc16_ccitt(entry->addr, entry->len, 0);
-            cnt += fwrite(&crc_store, 1, sizeof(crc_store), fp);
-            fclose(fp);
-            if (cnt != (entry->len + sizeof(crc_store))) {
-                ret = ODR_HW;
-            }
         }
     }
 
     /* Verify data */
     if (ret == ODR_OK) {
         uint8_t* buf = NULL;
-        FILE* fp = NULL;
         size_t cnt = 0;
-        uint16_t crc_verify, crc_read;
+        uint16_t crc_verify = 0, crc_read = 0;
 
-        buf = malloc(entry->len + 4);
+        fp = NULL;
+        buf = malloc(len + 4);
         if (buf != NULL) {
             fp = fopen(filename_tmp, "r");
             if (fp != NULL) {
-                cnt = fread(buf, 1, entry->len + 4, fp);
-                crc_verify = crc16_ccitt(buf, entry->len, 0);
+                cnt = fread(buf, 1, len + 4, fp);
+                crc_verify = crc16_ccitt(buf, len, 0);
                 fclose(fp);
-                memcpy(&crc_read, &buf[entry->len], sizeof(crc_read));
+                memcpy(&crc_read, &buf[len], sizeof(crc_read));
             }
             free(buf);
         }
         /* If size or CRC differs, report error */
-        if (buf == NULL || fp == NULL || cnt != (entry->len + sizeof(crc_verify)) || crc_store != crc_verify
-            || crc_store != crc_read) {
+        if (buf == NULL) {
+            ret = ODR_OUT_OF_MEM;
+        } else if (fp == NULL || cnt != (len + sizeof(crc_verify)) || crc_store != crc_verify
+                   || crc_store != crc_read) {
             ret = ODR_HW;
         }
     }
 
-    /* rename existing file to *.old and *.tmp to existing */
+    /* rename existing file to *.old and *.tmp to existing, then sync the directory, so renames are durable */
     if (ret == ODR_OK) {
-        rename(entry->filename, filename_old);
-        if (rename(filename_tmp, entry->filename) != 0) {
+        rename(filename, filename_old);
+        if (rename(filename_tmp, filename) != 0) {
             ret = ODR_HW;
+        } else {
+            char dirname[CO_STORAGE_PATH_MAX];
+            char* slash;
+            strncpy(dirname, filename, sizeof(dirname) - 1);
+            dirname[sizeof(dirname) - 1] = 0;
+            slash = strrchr(dirname, '/');
+            if (slash == NULL) {
+                strcpy(dirname, ".");
+            } else if (slash == dirname) {
+                slash[1] = 0;
+            } else {
+                *slash = 0;
+            }
+            int fd = open(dirname, O_RDONLY | O_DIRECTORY);
+            if (fd >= 0) {
+                (void)fsync(fd);
+                close(fd);
+            }
         }
     }
 
-    if (ret != ODR_OUT_OF_MEM) {
-        free(filename_tmp);
-        free(filename_old);
+    return ret;
+}
+
+#if CO_STORAGE_BACKGROUND > 0
+/* States of background store for one entry */
+#define STORE_IDLE   0U
+#define STORE_QUEUED 1U
+#define STORE_DONE   2U
+
+/* Background thread, which writes data files for all storage entries. Entries to write are in single linked queue. */
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;     /* signals new entry in queue or stop request */
+    pthread_cond_t condDone; /* signals finished entry */
+    pthread_t thread;
+    bool_t started;
+    bool_t stop;
+    CO_storage_entry_t* first;
+    CO_storage_entry_t* last;
+    void (*pFunctSignal)(void* object);
+    void* functSignalObject;
+} storeThread = {.mutex = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER,
+                 .condDone = PTHREAD_COND_INITIALIZER};
+
+static void*
+storeThreadFunction(void* arg) {
+    (void)arg;
+
+    pthread_mutex_lock(&storeThread.mutex);
+    for (;;) {
+        CO_storage_entry_t* entry = storeThread.first;
+        if (entry != NULL) {
+            storeThread.first = entry->storeNext;
+            if (storeThread.first == NULL) {
+                storeThread.last = NULL;
+            }
+
+            /* Snapshot does not change while entry is queued */
+            pthread_mutex_unlock(&storeThread.mutex);
+            ODR_t ret = writeFileSafe(entry->filename, entry->snapshot, entry->len);
+            pthread_mutex_lock(&storeThread.mutex);
+
+            entry->storeResult = (uint8_t)ret;
+            entry->storeState = STORE_DONE;
+            pthread_cond_broadcast(&storeThread.condDone);
+            if (storeThread.pFunctSignal != NULL) {
+                storeThread.pFunctSignal(storeThread.functSignalObject);
+            }
+        } else if (storeThread.stop) {
+            break;
+        } else {
+            pthread_cond_wait(&storeThread.cond, &storeThread.mutex);
+        }
     }
+    pthread_mutex_unlock(&storeThread.mutex);
 
-    return ret;
+    return NULL;
+}
+
+/* Wait, until background thread finishes with entry */
+static void
+storeThreadWait(CO_storage_entry_t* entry) {
+    pthread_mutex_lock(&storeThread.mutex);
+    while (entry->storeState == STORE_QUEUED) {
+        pthread_cond_wait(&storeThread.condDone, &storeThread.mutex);
+    }
+    entry->storeState = STORE_IDLE;
+    pthread_mutex_unlock(&storeThread.mutex);
+}
+#endif /* CO_STORAGE_BACKGROUND > 0 */
+
+/*
+ * Function for writing data on "Store parameters" command - OD object 1010
+ *
+ * It is called only by SDO server and so it is already protected by CO_LOCK_OD. With background storage it only takes
+ * a snapshot of data and returns ODR_PARTIAL, until background thread finishes. Then it returns the result. If data
+ * were changed meanwhile (or result is from aborted SDO command), new snapshot is stored.
+ *
+ * For more information see file CO_storage.h, CO_storage_entry_t.
+ */
+static ODR_t
+storeLinux(CO_storage_entry_t* entry, CO_CANmodule_t* CANmodule) {
+    (void)CANmodule;
+
+#if CO_STORAGE_BACKGROUND > 0
+    if (storeThread.started && entry->snapshot != NULL) {
+        ODR_t ret = ODR_PARTIAL;
+
+        pthread_mutex_lock(&storeThread.mutex);
+        if (entry->storeState == STORE_DONE && memcmp(entry->snapshot, entry->addr, entry->len) == 0) {
+            entry->storeState = STORE_IDLE;
+            ret = (ODR_t)entry->storeResult;
+        } else if (entry->storeState != STORE_QUEUED) {
+            memcpy(entry->snapshot, entry->addr, entry->len);
+            entry->storeState = STORE_QUEUED;
+            entry->storeNext = NULL;
+            if (storeThread.last == NULL) {
+                storeThread.first = entry;
+            } else {
+                storeThread.last->storeNext = entry;
+            }
+            storeThread.last = entry;
+            pthread_cond_signal(&storeThread.cond);
+        } else { /* MISRA C 2004 14.10 */
+        }
+        pthread_mutex_unlock(&storeThread.mutex);
+
+        return ret;
+    }
+#endif
+
+    return writeFileSafe(entry->filename, entry->addr, entry->len);
+}
+
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+/* Header of the record in journal file. Header is followed by data and CRC16 of header and data. */
+typedef struct {
+    uint32_t offset; /* Offset of data inside entry */
+    uint32_t len;    /* Length of data */
+} journalRecord_t;
+
+static void
+journalName(char* name, size_t size, const char* filename) {
+    snprintf(name, size, "%s.jnl", filename);
+}
+
+/* Mark pages of entries, which contain written data, as dirty. Called from OD_writeOriginal(), inside CO_LOCK_OD. */
+static void
+storageWritten(void* object, const void* addr, OD_size_t len) {
+    CO_storage_t* storage = (CO_storage_t*)object;
+    uintptr_t a = (uintptr_t)addr;
+
+    if (storage == NULL || len == 0) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < storage->entriesCount; i++) {
+        CO_storage_entry_t* entry = &storage->entries[i];
+        uintptr_t start = (uintptr_t)entry->addr;
+
+        if (entry->dirty != NULL && a >= start && a < (start + entry->len)) {
+            size_t end = (size_t)(a - start) + len;
+            if (end > entry->len) {
+                end = entry->len;
+            }
+            for (size_t p = (size_t)(a - start) / CO_STORAGE_PAGE_SIZE; p <= (end - 1) / CO_STORAGE_PAGE_SIZE; p++) {
+                entry->dirty[p >> 3] |= (uint8_t)(1U << (p & 7U));
+            }
+            break;
+        }
+    }
+}
+
+/*
+ * Apply records from journal file to data, which were loaded from main file. Replay stops on first incomplete or
+ * corrupt record (write was interrupted).
+ *
+ * @return Number of applied records.
+ */
+static uint32_t
+journalReplay(CO_storage_entry_t* entry) {
+    char name[CO_STORAGE_PATH_MAX + 4];
+    uint32_t records = 0;
+
+    journalName(name, sizeof(name), entry->filename);
+    FILE* fp = fopen(name, "r");
+    if (fp == NULL) {
+        return 0;
+    }
+
+    uint8_t* buf = malloc(entry->len);
+    if (buf != NULL) {
+        journalRecord_t rec;
+        uint16_t crc;
+
+        while (fread(&rec, sizeof(rec), 1, fp) == 1 && rec.len > 0 && rec.len <= entry->len
+               && rec.offset <= (entry->len - rec.len) && fread(buf, 1, rec.len, fp) == rec.len
+               && fread(&crc, sizeof(crc), 1, fp) == 1
+               && crc == crc16_ccitt(buf, rec.len, crc16_ccitt((const uint8_t*)&rec, sizeof(rec), 0))) {
+            memcpy((uint8_t*)entry->addr + rec.offset, buf, rec.len);
+            records++;
+        }
+        free(buf);
+    }
+    fclose(fp);
+
+    return records;
+}
+
+/* Write all data into main file and truncate the journal */
+static bool_t
+journalCompact(CO_storage_t* storage, CO_storage_entry_t* entry) {
+#if CO_STORAGE_BACKGROUND > 0
+    /* Don't write main file concurrently with background thread, try next time */
+    bool_t busy;
+    pthread_mutex_lock(&storeThread.mutex);
+    busy = entry->storeState == STORE_QUEUED;
+    pthread_mutex_unlock(&storeThread.mutex);
+    if (busy) {
+        return true;
+    }
+#endif
+
+    uint8_t* buf = malloc(entry->len);
+    if (buf == NULL) {
+        return false;
+    }
+    CO_LOCK_OD(storage->CANmodule);
+    memcpy(buf, entry->addr, entry->len);
+    CO_UNLOCK_OD(storage->CANmodule);
+
+    /* Changes after the copy are still marked as dirty and will be appended to the empty journal */
+    bool_t ok = writeFileSafe(entry->filename, buf, entry->len) == ODR_OK;
+    if (ok) {
+        entry->crc = crc16_ccitt(buf, entry->len, 0);
+        ok = ftruncate(fileno(entry->fp), 0) == 0;
+        entry->journalSize = 0;
+    }
+    free(buf);
+
+    return ok;
+}
+
+/* Append dirty pages of data to journal file */
+static bool_t
+journalAppend(CO_storage_t* storage, CO_storage_entry_t* entry) {
+    size_t pages = (entry->len + CO_STORAGE_PAGE_SIZE - 1) / CO_STORAGE_PAGE_SIZE;
+    size_t written = 0;
+    bool_t ok = true;
+
+    CO_LOCK_OD(storage->CANmodule);
+    for (size_t p = 0; p < pages;) {
+        if (entry->dirty[p >> 3] == 0) {
+            p = (p | 7U) + 1;
+            continue;
+        }
+        if ((entry->dirty[p >> 3] & (1U << (p & 7U))) == 0) {
+            p++;
+            continue;
+        }
+
+        /* join consecutive dirty pages into one record */
+        size_t pEnd = p;
+        while (pEnd < pages && (entry->dirty[pEnd >> 3] & (1U << (pEnd & 7U))) != 0) {
+            entry->dirty[pEnd >> 3] &= (uint8_t)~(1U << (pEnd & 7U));
+            pEnd++;
+        }
+
+        journalRecord_t rec;
+        rec.offset = (uint32_t)(p * CO_STORAGE_PAGE_SIZE);
+        rec.len = (uint32_t)((pEnd * CO_STORAGE_PAGE_SIZE < entry->len) ? pEnd * CO_STORAGE_PAGE_SIZE : entry->len)
+                  - rec.offset;
+        const uint8_t* data = (const uint8_t*)entry->addr + rec.offset;
+        uint16_t crc = crc16_ccitt(data, rec.len, crc16_ccitt((const uint8_t*)&rec, sizeof(rec), 0));
+
+        size_t cnt = fwrite(&rec, 1, sizeof(rec), entry->fp);
+        cnt += fwrite(data, 1, rec.len, entry->fp);
+        cnt += fwrite(&crc, 1, sizeof(crc), entry->fp);
+        if (cnt != (sizeof(rec) + rec.len + sizeof(crc))) {
+            ok = false;
+        }
+        written += cnt;
+        p = pEnd;
+    }
+    CO_UNLOCK_OD(storage->CANmodule);
+
+    if (written > 0) {
+        if (fflush(entry->fp) != 0) {
+            ok = false;
+        }
+        entry->journalSize += written;
+    }
+    if (ok && entry->journalSize > CO_STORAGE_JOURNAL_SIZE_MAX) {
+        ok = journalCompact(storage, entry);
+    }
+    if (!ok) {
+        /* write all data next time */
+        CO_LOCK_OD(storage->CANmodule);
+        memset(entry->dirty, 0xFF, (pages + 7) / 8);
+        CO_UNLOCK_OD(storage->CANmodule);
+    }
+
+    return ok;
 }
+#endif /* (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY */
 
 /*
  * Function for restoring data on "Restore default parameters" command - OD 1011
@@ -125,10 +419,23 @@ restoreLinux(CO_storage_entry_t* entry, CO_CANmodule_t* CANmodule) {
     (void)CANmodule;
     ODR_t ret = ODR_OK;
 
+#if CO_STORAGE_BACKGROUND > 0
+    /* pending store must not overwrite restored file */
+    if (storeThread.started && entry->snapshot != NULL) {
+        storeThreadWait(entry);
+    }
+#endif
+
     /* close the file first, if auto storage */
     if ((entry->attr & CO_storage_auto) != 0 && entry->fp != NULL) {
         fclose(entry->fp);
         entry->fp = NULL;
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+        /* journal must not be applied to default data */
+        char name[CO_STORAGE_PATH_MAX + 4];
+        journalName(name, sizeof(name), entry->filename);
+        remove(name);
+#endif
     }
 
     /* Rename existing filename to *.old. */
@@ -240,18 +547,100 @@ CO_storageLinux_init(CO_storage_t* storage, CO_CANmodule_t* CANmodule, OD_entry_
 
         /* open file for auto storage, if set so */
         if ((entry->attr & CO_storage_auto) != 0) {
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+            size_t pages = (entry->len + CO_STORAGE_PAGE_SIZE - 1) / CO_STORAGE_PAGE_SIZE;
+            char name[CO_STORAGE_PATH_MAX + 4];
+            bool_t compacted = true;
+            (void)writeFileAccess;
+
+            entry->dirty = calloc((pages + 7) / 8, 1);
+            if (entry->dirty == NULL) {
+                *storageInitError = i;
+                return CO_ERROR_OUT_OF_MEMORY;
+            }
+            entry->journalSize = 0;
+
+            /* Apply journal to loaded data and compact all into main file. If data are corrupt, journal is
+             * discarded and default data are written into main file. */
+            if (dataCorrupt || journalReplay(entry) > 0) {
+                compacted = writeFileSafe(entry->filename, entry->addr, entry->len) == ODR_OK;
+                if (compacted) {
+                    entry->crc = crc16_ccitt(entry->addr, entry->len, 0);
+                }
+            }
+            /* journal is opened in append mode, so it can be truncated after later compactions */
+            journalName(name, sizeof(name), entry->filename);
+            entry->fp = fopen(name, "a");
+            if (entry->fp != NULL) {
+                if (compacted && ftruncate(fileno(entry->fp), 0) != 0) {
+                    compacted = false;
+                }
+                fseek(entry->fp, 0, SEEK_END);
+                entry->journalSize = (size_t)ftell(entry->fp);
+            }
+#else
             entry->fp = fopen(entry->filename, writeFileAccess);
+#endif
             if (entry->fp == NULL) {
                 *storageInitError = i;
                 return CO_ERROR_ILLEGAL_ARGUMENT;
             }
         }
+
+#if CO_STORAGE_BACKGROUND > 0
+        /* buffer for snapshot of data, which is stored by background thread */
+        entry->snapshot = NULL;
+        entry->storeState = STORE_IDLE;
+        entry->storeNext = NULL;
+        if ((entry->attr & CO_storage_cmd) != 0) {
+            entry->snapshot = malloc(entry->len);
+            if (entry->snapshot == NULL) {
+                *storageInitError = i;
+                return CO_ERROR_OUT_OF_MEMORY;
+            }
+        }
+#endif
     } /* for (entries) */
 
+#if CO_STORAGE_BACKGROUND > 0
+    /* If thread can not be started, data will be stored directly */
+    if (!storeThread.started) {
+        storeThread.stop = false;
+        storeThread.started = pthread_create(&storeThread.thread, NULL, storeThreadFunction, NULL) == 0;
+    }
+#endif
+
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+    OD_initCallbackWritten(storage, storageWritten);
+#endif
+
     storage->enabled = true;
     return ret;
 }
 
+#if CO_STORAGE_BACKGROUND > 0
+void
+CO_storageLinux_initCallbackPre(CO_storage_t* storage, void* object, void (*pFunctSignal)(void* object)) {
+    if (storage != NULL) {
+        pthread_mutex_lock(&storeThread.mutex);
+        storeThread.functSignalObject = object;
+        storeThread.pFunctSignal = pFunctSignal;
+        pthread_mutex_unlock(&storeThread.mutex);
+    }
+}
+#endif
+
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+void
+CO_storageLinux_markDirty(CO_storage_t* storage, const void* addr, size_t len) {
+    if (storage != NULL) {
+        CO_LOCK_OD(storage->CANmodule);
+        storageWritten(storage, addr, (OD_size_t)len);
+        CO_UNLOCK_OD(storage->CANmodule);
+    }
+}
+#endif
+
 uint32_t
 CO_storageLinux_auto_process(CO_storage_t* storage, bool_t closeFiles) {
     uint32_t storageError = 0;
@@ -269,6 +658,21 @@ CO_storageLinux_auto_process(CO_storage_t* storage, bool_t closeFiles) {
             continue;
         }
 
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+        /* Append changed pages to the journal. On close also catch direct writes to data, which were not marked dirty:
+         * if data differ from last compaction, write them all into the main file. */
+        bool_t ok = journalAppend(storage, entry);
+        if (ok && closeFiles && crc16_ccitt(entry->addr, entry->len, 0) != entry->crc) {
+            ok = journalCompact(storage, entry);
+        }
+        if (!ok) {
+            uint32_t errorBit = entry->subIndexOD;
+            if (errorBit > 31) {
+                errorBit = 31;
+            }
+            storageError |= ((uint32_t)1) << errorBit;
+        }
+#else
         /* If CRC of the current data differs, save the file */
         uint16_t crc = crc16_ccitt(entry->addr, entry->len, 0);
         if (crc != entry->crc) {
@@ -290,12 +694,43 @@ CO_storageLinux_auto_process(CO_storage_t* storage, bool_t closeFiles) {
                 storageError |= ((uint32_t)1) << errorBit;
             }
         }
+#endif
 
         if (closeFiles) {
             fclose(entry->fp);
             entry->fp = NULL;
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+            free(entry->dirty);
+            entry->dirty = NULL;
+#endif
+        }
+    }
+
+#if ((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0
+    if (closeFiles) {
+        OD_initCallbackWritten(NULL, NULL);
+    }
+#endif
+
+#if CO_STORAGE_BACKGROUND > 0
+    /* finish background stores and stop the thread */
+    if (closeFiles && storeThread.started) {
+        pthread_mutex_lock(&storeThread.mutex);
+        storeThread.stop = true;
+        storeThread.pFunctSignal = NULL;
+        pthread_cond_signal(&storeThread.cond);
+        pthread_mutex_unlock(&storeThread.mutex);
+        pthread_join(storeThread.thread, NULL);
+        storeThread.started = false;
+
+        for (uint8_t i = 0; i < storage->entriesCount; i++) {
+            CO_storage_entry_t* entry = &storage->entries[i];
+            free(entry->snapshot);
+            entry->snapshot = NULL;
+            entry->storeState = STORE_IDLE;
         }
     }
+#endif
 
     return storageError;
 }
@@ -62,14 +62,50 @@ CO_ReturnError_t CO_storageLinux_init(CO_storage_t* storage, CO_CANmodule_t* CAN
                                       OD_entry_t* OD_1010_StoreParameters, OD_entry_t* OD_1011_RestoreDefaultParam,
                                       CO_storage_entry_t* entries, uint8_t entriesCount, uint32_t* storageInitError);
 
+#if (CO_STORAGE_BACKGROUND > 0) || defined CO_DOXYGEN
+/**
+ * Initialize signal callback for background storage.
+ *
+ * Data on "Store parameters" command are written to files by background thread. SDO server repeats the OD 1010 write
+ * until data are stored, so it must be processed again, when background thread finishes. Callback is common for all
+ * storage objects, it is called from background thread.
+ *
+ * @param storage This object
+ * @param object Pointer to object, which will be passed to pFunctSignal(). Can be NULL.
+ * @param pFunctSignal Pointer to the callback function, for example @ref CO_epoll_wakeup(). Not called if NULL.
+ */
+void CO_storageLinux_initCallbackPre(CO_storage_t* storage, void* object, void (*pFunctSignal)(void* object));
+#endif
+
+#if (((CO_CONFIG_STORAGE)&CO_CONFIG_STORAGE_DIRTY) != 0) || defined CO_DOXYGEN
+/**
+ * Mark data of auto storage as changed.
+ *
+ * Writes through Object Dictionary (SDO, RPDO, OD_set_xx()) are tracked automatically. If application writes OD
+ * variables, which are auto stored, directly, it should call this function, otherwise change is saved only on
+ * @ref CO_storageLinux_auto_process() with closeFiles set. Do not call it inside @ref CO_LOCK_OD().
+ *
+ * @param storage This object
+ * @param addr Address of changed data
+ * @param len Length of changed data
+ */
+void CO_storageLinux_markDirty(CO_storage_t* storage, const void* addr, size_t len);
+#endif
+
 /**
  * Automatically save data if differs from previous call.
  *
  * Should be called cyclically by program. Each interval it verifies, if crc checksum of data differs from previous
  * checksum. If it does, data are saved into pre-opened file.
  *
+ * With CO_CONFIG_STORAGE_DIRTY only changed pages of data (#CO_STORAGE_PAGE_SIZE) are appended to the journal file
+ * (filename + ".jnl"), no checksum over all data is calculated. On startup, @ref CO_storageLinux_init() applies journal
+ * to the data and compacts everything into the main file. Compaction is also done, when journal grows over
+ * #CO_STORAGE_JOURNAL_SIZE_MAX and on closeFiles, if checksum of data differs from the main file (for direct writes,
+ * which were not marked with @ref CO_storageLinux_markDirty()).
+ *
  * @param storage This object
- * @param closeFiles If true, then all files will be closed. Use on end of the program.
+ * @param closeFiles If true, then all files will be closed and background stores finished. Use on end of the program.
  *
  * @return 0 on success or bit mask from subIndexOD values, where data was not able to be saved.
  */
@@ -0,0 +1,67 @@
+/*
+ * CANopen trace object with ring buffer in shared memory for Linux
+ *
+ * @file        CO_traceLinux.c
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#include "CO_traceLinux.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#if (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE
+
+CO_ReturnError_t
+CO_traceLinux_init(CO_trace_t* trace, OD_t* OD, OD_entry_t* OD_traceConfig, OD_entry_t* OD_trace,
+                   const char* filename, size_t bufferSize, uint32_t* errInfo) {
+    if ((trace == NULL) || (filename == NULL) || (bufferSize <= sizeof(CO_trace_ring_t))) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return CO_ERROR_SYSCALL;
+    }
+    if (ftruncate(fd, (off_t)bufferSize) != 0) {
+        close(fd);
+        return CO_ERROR_SYSCALL;
+    }
+    /* mapping is page aligned and stays valid after the file descriptor is closed */
+    void* buffer = mmap(NULL, bufferSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (buffer == MAP_FAILED) {
+        return CO_ERROR_SYSCALL;
+    }
+
+    CO_ReturnError_t ret = CO_trace_init(trace, OD, OD_traceConfig, OD_trace, buffer, bufferSize, errInfo);
+    if (ret != CO_ERROR_NO) {
+        munmap(buffer, bufferSize);
+        trace->ring = NULL;
+    }
+    return ret;
+}
+
+void
+CO_traceLinux_close(CO_trace_t* trace) {
+    if ((trace == NULL) || (trace->ring == NULL)) {
+        return;
+    }
+    trace->running = false;
+    trace->ring->running = 0;
+    munmap(trace->ring, trace->bufferSize);
+    trace->ring = NULL;
+}
+
+#endif /* (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE */
@@ -0,0 +1,77 @@
+/**
+ * CANopen trace object with ring buffer in shared memory for Linux
+ *
+ * @file        CO_traceLinux.h
+ * @ingroup     CO_traceLinux
+ *
+ * This file is part of <https://github.com/CANopenNode/CANopenNode>, a CANopen Stack.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is
+ * distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and limitations under the License.
+ */
+
+#ifndef CO_TRACE_LINUX_H
+#define CO_TRACE_LINUX_H
+
+#include "extra/CO_trace.h"
+
+#if ((CO_CONFIG_TRACE)&CO_CONFIG_TRACE_ENABLE) || defined CO_DOXYGEN
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup CO_traceLinux Trace with Linux
+ * Trace ring buffer in memory mapped file.
+ *
+ * @ingroup CO_socketCAN
+ * @{
+ * Ring buffer of the trace is memory mapped file, usually inside /dev/shm. Other programs can map the same file
+ * read-only and read records directly, see @ref CO_trace_ring_t. For example in Python:
+ *
+ *     m = mmap.mmap(os.open("/dev/shm/CO_trace0", os.O_RDONLY), 0, prot=mmap.PROT_READ)
+ *
+ * See also @ref CO_trace.
+ */
+
+/**
+ * Initialize trace object with ring buffer in memory mapped file (Linux specific)
+ *
+ * This function creates (or truncates) the file, maps it into memory and calls @ref CO_trace_init().
+ *
+ * @param trace This object will be initialized. It must exist permanently.
+ * @param OD Object Dictionary.
+ * @param OD_traceConfig OD entry for "Trace configuration".
+ * @param OD_trace OD entry for "Trace".
+ * @param filename Name of the file, for example "/dev/shm/CO_trace0".
+ * @param bufferSize Size of the file in bytes.
+ * @param [out] errInfo Additional information in case of error, may be NULL.
+ *
+ * @return CO_ERROR_NO, CO_ERROR_ILLEGAL_ARGUMENT, CO_ERROR_OD_PARAMETERS or CO_ERROR_SYSCALL.
+ */
+CO_ReturnError_t CO_traceLinux_init(CO_trace_t* trace, OD_t* OD, OD_entry_t* OD_traceConfig, OD_entry_t* OD_trace,
+                                    const char* filename, size_t bufferSize, uint32_t* errInfo);
+
+/**
+ * Release memory mapped file of the trace object. File is not removed, so the last records remain readable.
+ *
+ * @param trace This object.
+ */
+void CO_traceLinux_close(CO_trace_t* trace);
+
+/** @} */ /* CO_traceLinux */
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /* (CO_CONFIG_TRACE) & CO_CONFIG_TRACE_ENABLE */
+
+#endif /* CO_TRACE_LINUX_H */
@@ -31,11 +31,17 @@
 #include <sys/un.h>
 #include <linux/can.h>
 #include <signal.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <ctype.h>
 
 #ifndef BUF_SIZE
 #define BUF_SIZE 1000
 #endif
 #define BUF_LAG 100 /* max size of error response */
+#define WINDOW_MAX 1024 /* max number of commands in flight in pipelined mode */
+#define WINDOW_CSV 16   /* default number of commands in flight for CSV import */
 
 /* colors and stream for printing status */
 char *greenC, *redC, *resetC;
@@ -65,6 +71,16 @@ printUsage(char* progName) {
             "                   'export cocomm_port=<port>'. Default is 60000.\n"
             "  -i               If set, then standard input will be read after each command\n"
             "                   string from arguments. Useful with write commands.\n"
+            "  -w <window>      Pipelined mode. Up to <window> commands (1..%d) are written\n"
+            "                   ahead, without waiting for the responses, which are matched\n"
+            "                   by sequence number. Sequence numbers are assigned by cocomm:\n"
+            "                   input line number or argument number. Set also with\n"
+            "                   'export cocomm_window=<window>'. Not used by default.\n"
+            "  -c <csv file>    Bulk import of write commands from CSV file, pipelined.\n"
+            "                   Line format: '<node>,<index>,<subindex>,<datatype>,<value>'.\n"
+            "                   Empty <node> means default node, value is the rest of the\n"
+            "                   line. Lines starting with '#' and a header line are skipped.\n"
+            "                   Default window is %d.\n"
             "  -o all|data|flat By defult (setting 'all') outupt is split to colored stderr\n"
             "                   and stdout. 'data' prints data only to stdout. 'flat' prints\n"
             "                   all to stdout, set also with 'export cocomm_flat=<0|1>'.\n"
@@ -81,7 +97,7 @@ printUsage(char* progName) {
             "\n"
             "See also: https://github.com/CANopenNode/CANopenLinux\n"
             "\n",
-            progName, progName);
+            progName, WINDOW_MAX, WINDOW_CSV, progName);
 }
 
 /* print reply, status to errStream (red or green), value to stdout */
@@ -185,12 +201,299 @@ printReply(int fd_gtw) {
     return ret;
 }
 
+/* Source of commands for pipelined mode, one of: file (or stdin), CSV file or arguments */
+typedef struct {
+    FILE* fp;
+    int csv;
+    char** argv;
+    int argc;
+    int argi;
+    unsigned long line; /* line number in file or argument number, used as sequence */
+} cmdSource_t;
+
+/* Commands in flight, ring buffer in order of sending */
+typedef struct {
+    unsigned long seq[WINDOW_MAX];
+    int first;
+    int count;
+} inFlight_t;
+
+/* Convert CSV line '<node>,<index>,<subindex>,<datatype>,<value>' into 'node w index subindex datatype value'. Value
+ * is the rest of the line, so it may also be a quoted visible string with commas. Return 0 on success. */
+static int
+csvToCommand(char* line, char* comm, size_t commSize) {
+    char* field[4];
+    char* value = line;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        char* comma = strchr(value, ',');
+        if (comma == NULL) {
+            return -1;
+        }
+        *comma = 0;
+        field[i] = value;
+        value = comma + 1;
+    }
+    /* trim spaces */
+    for (i = 0; i < 4; i++) {
+        char* end = field[i] + strlen(field[i]);
+        while (isspace((unsigned char)*field[i])) {
+            field[i]++;
+        }
+        while (end > field[i] && isspace((unsigned char)end[-1])) {
+            *--end = 0;
+        }
+    }
+    while (isspace((unsigned char)*value)) {
+        value++;
+    }
+    if (field[1][0] == 0 || field[2][0] == 0 || field[3][0] == 0 || value[0] == 0) {
+        return -1;
+    }
+
+    int len = snprintf(comm, commSize, "%s%sw %s %s %s %s", field[0], field[0][0] != 0 ? " " : "", field[1],
+                       field[2], field[3], value);
+    return (len > 0 && (size_t)len < commSize) ? 0 : -1;
+}
+
+/* Get next command from source and write it into commBuf with sequence number prepended. Empty lines and comments
+ * are skipped. Return length of the command, 0 at the end of input or -1 on invalid line, which is skipped. */
+static int
+nextCommand(cmdSource_t* src, char* commBuf, unsigned long* seq) {
+    char line[BUF_SIZE];
+    char comm[BUF_SIZE];
+    char* c;
+    size_t len;
+
+    for (;;) {
+        if (src->fp != NULL) {
+            if (fgets(line, sizeof(line), src->fp) == NULL) {
+                return 0;
+            }
+            src->line++;
+            len = strlen(line);
+            if (line[len - 1] != '\n' && !feof(src->fp)) {
+                int ch;
+                while ((ch = fgetc(src->fp)) != EOF && ch != '\n') {}
+                fprintf(errStream, "%sLine %lu: command string too long!%s\n", redC, src->line, resetC);
+                return -1;
+            }
+        } else if (src->argi < src->argc) {
+            strncpy(line, src->argv[src->argi++], sizeof(line) - 1);
+            line[sizeof(line) - 1] = 0;
+            src->line++;
+        } else {
+            return 0;
+        }
+
+        /* remove line ending and leading spaces, skip empty lines and comments */
+        line[strcspn(line, "\r\n")] = 0;
+        c = line;
+        while (isspace((unsigned char)*c)) {
+            c++;
+        }
+        if (*c == 0 || *c == '#') {
+            continue;
+        }
+
+        if (src->csv) {
+            /* skip header line */
+            if (src->line == 1 && isalpha((unsigned char)*c)) {
+                continue;
+            }
+            if (csvToCommand(c, comm, sizeof(comm)) != 0) {
+                fprintf(errStream, "%sLine %lu: invalid CSV line!%s\n", redC, src->line, resetC);
+                return -1;
+            }
+            c = comm;
+        } else if (*c == '[') {
+            /* sequence is assigned by cocomm, remove the one from the input */
+            char* end = strchr(c, ']');
+            if (end != NULL) {
+                c = end + 1;
+                while (isspace((unsigned char)*c)) {
+                    c++;
+                }
+            }
+        }
+
+        int n = snprintf(commBuf, BUF_SIZE, "[%lu] %s\n", src->line, c);
+        if (n <= 0 || n >= BUF_SIZE) {
+            fprintf(errStream, "%sLine %lu: command string too long!%s\n", redC, src->line, resetC);
+            return -1;
+        }
+        *seq = src->line;
+        return n;
+    }
+}
+
+/* Print one response line (without "\r\n") in pipelined mode and remove its sequence from inFlight. Return
+ * EXIT_FAILURE, if response is error. */
+static int
+printPipelinedReply(char* resp, inFlight_t* inFlight) {
+    char* seqEnd;
+    unsigned long seq;
+    int i;
+
+    if (resp[0] != '[') {
+        /* not response to command, for example subscription notification */
+        puts(resp);
+        fflush(stdout);
+        return EXIT_SUCCESS;
+    }
+
+    seq = strtoul(&resp[1], &seqEnd, 10);
+    for (i = 0; i < inFlight->count; i++) {
+        if (inFlight->seq[(inFlight->first + i) % WINDOW_MAX] == seq) {
+            break;
+        }
+    }
+    if (*seqEnd != ']' || i == inFlight->count) {
+        fprintf(errStream, "%sUnexpected response: %s%s\r\n", redC, resp, resetC);
+        return EXIT_FAILURE;
+    }
+    /* responses usually come in order, so this is the first one */
+    for (; i > 0; i--) {
+        inFlight->seq[(inFlight->first + i) % WINDOW_MAX] = inFlight->seq[(inFlight->first + i - 1) % WINDOW_MAX];
+    }
+    inFlight->first = (inFlight->first + 1) % WINDOW_MAX;
+    inFlight->count--;
+
+    char* value = seqEnd[1] == ' ' ? &seqEnd[2] : &seqEnd[1];
+    char* errResp = strstr(value, "\n...ERROR:0x");
+    seqEnd[1] = 0;
+    if (strncmp(value, "ERROR:", 6) == 0) {
+        fprintf(errStream, "%s%s %s%s\r\n", redC, resp, value, resetC);
+        return EXIT_FAILURE;
+    } else if (strcmp(value, "OK") == 0) {
+        fprintf(errStream, "%s%s %s%s\r\n", greenC, resp, value, resetC);
+    } else {
+        fprintf(errStream, "%s%s%s ", greenC, resp, resetC);
+        if (errResp != NULL) {
+            errResp[0] = 0;
+            fputs(value, stdout);
+            fflush(stdout);
+            fprintf(errStream, "\n%s%s%s\r\n", redC, &errResp[1], resetC);
+            return EXIT_FAILURE;
+        }
+        fputs(value, stdout);
+        fflush(stdout);
+        fputs("\r\n", errStream);
+    }
+    return EXIT_SUCCESS;
+}
+
+/* Pipelined mode: keep up to window commands in flight and match responses by sequence number */
+static int
+pipeline(int fd_gtw, cmdSource_t* src, int window) {
+    static inFlight_t inFlight;
+    char* commBuf = malloc(BUF_SIZE);
+    size_t commLen = 0, commSent = 0;
+    char* replyBuf = malloc(BUF_SIZE + 1);
+    size_t replySize = BUF_SIZE, replyCount = 0;
+    int inputEnd = 0;
+    int ret = EXIT_SUCCESS;
+
+    if (commBuf == NULL || replyBuf == NULL) {
+        perror("pipeline malloc");
+        exit(EXIT_FAILURE);
+    }
+    if (fcntl(fd_gtw, F_SETFL, fcntl(fd_gtw, F_GETFL) | O_NONBLOCK) < 0) {
+        perror("fcntl");
+        exit(EXIT_FAILURE);
+    }
+
+    while (!inputEnd || commSent < commLen || inFlight.count > 0) {
+        struct pollfd pfd = {.fd = fd_gtw, .events = POLLIN};
+
+        /* prepare next command, if there is space in the window */
+        while (commSent == commLen && !inputEnd && inFlight.count < window) {
+            unsigned long seq;
+            int n = nextCommand(src, commBuf, &seq);
+            if (n > 0) {
+                commLen = n;
+                commSent = 0;
+                inFlight.seq[(inFlight.first + inFlight.count) % WINDOW_MAX] = seq;
+                inFlight.count++;
+            } else if (n == 0) {
+                inputEnd = 1;
+            } else {
+                ret = EXIT_FAILURE;
+            }
+        }
+        if (commSent < commLen) {
+            pfd.events |= POLLOUT;
+        } else if (inputEnd && inFlight.count == 0) {
+            break;
+        }
+
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("poll");
+            exit(EXIT_FAILURE);
+        }
+
+        if ((pfd.revents & POLLOUT) != 0) {
+            ssize_t n = write(fd_gtw, &commBuf[commSent], commLen - commSent);
+            if (n > 0) {
+                commSent += n;
+            } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+                perror("Socket write failed");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        if ((pfd.revents & (POLLIN | POLLHUP | POLLERR)) != 0) {
+            ssize_t n = read(fd_gtw, &replyBuf[replyCount], replySize - replyCount);
+            if (n > 0) {
+                char* line = replyBuf;
+                char* end;
+
+                replyCount += n;
+                replyBuf[replyCount] = 0;
+                while ((end = strstr(line, "\r\n")) != NULL) {
+                    end[0] = 0;
+                    if (printPipelinedReply(line, &inFlight) == EXIT_FAILURE) {
+                        ret = EXIT_FAILURE;
+                    }
+                    line = end + 2;
+                }
+                replyCount -= line - replyBuf;
+                memmove(replyBuf, line, replyCount);
+                /* long response, for example domain, enlarge buffer */
+                if (replyCount == replySize) {
+                    replySize *= 2;
+                    replyBuf = realloc(replyBuf, replySize + 1);
+                    if (replyBuf == NULL) {
+                        perror("replyBuf realloc");
+                        exit(EXIT_FAILURE);
+                    }
+                }
+            } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+                fprintf(errStream, "%sError, connection closed, %d response(s) missing%s\n", redC,
+                        inFlight.count, resetC);
+                ret = EXIT_FAILURE;
+                break;
+            }
+        }
+    }
+
+    free(replyBuf);
+    free(commBuf);
+    return ret;
+}
+
 int
 main(int argc, char* argv[]) {
     /* configurable options */
     enum { out_all, out_data, out_flat } outputType = out_all;
 
     char* inputFilePath = NULL;
+    char* csvFilePath = NULL;
+    int window = 0;
     char* socketPath = "/tmp/CO_command_socket"; /* Name of the local domain socket */
     char hostname[HOST_NAME_MAX];                /* name of the remote TCP host */
     char tcpPort[20] = "60000";                  /* default port when used in tcp mode */
@@ -241,9 +544,12 @@ main(int argc, char* argv[]) {
     if ((env = getenv("cocomm_candump_timeout")) != NULL) {
         candumpTmo = atol(env);
     }
+    if ((env = getenv("cocomm_window")) != NULL) {
+        window = atoi(env);
+    }
 
     /* Get program options from arguments */
-    while ((opt = getopt(argc, argv, "f:s:t:p:io:d:n:T:")) != -1) {
+    while ((opt = getopt(argc, argv, "f:s:t:p:io:d:n:T:w:c:")) != -1) {
         switch (opt) {
             case 'f': inputFilePath = optarg; break;
             case 's':
@@ -266,10 +572,20 @@ main(int argc, char* argv[]) {
             case 'd': candump = optarg; break;
             case 'n': candumpCount = atol(optarg); break;
             case 'T': candumpTmo = atol(optarg); break;
+            case 'w': window = atoi(optarg); break;
+            case 'c': csvFilePath = optarg; break;
             default: printUsage(argv[0]); exit(EXIT_FAILURE);
         }
     }
 
+    if (csvFilePath != NULL && window == 0) {
+        window = WINDOW_CSV;
+    }
+    if (window < 0 || window > WINDOW_MAX || (window > 0 && additionalReadStdin != 0)) {
+        printUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
     switch (outputType) {
         default:
         case out_all:
@@ -390,7 +706,32 @@ main(int argc, char* argv[]) {
         exit(EXIT_FAILURE);
     }
 
-    if (inputFilePath != NULL) {
+    if (window > 0) {
+        cmdSource_t src = {.fp = stdin};
+        char* path = csvFilePath != NULL ? csvFilePath : inputFilePath;
+
+        if (path != NULL) {
+            src.fp = fopen(path, "r");
+            if (src.fp == NULL) {
+                perror("Can't open input file");
+                free(commBuf);
+                exit(EXIT_FAILURE);
+            }
+            src.csv = csvFilePath != NULL;
+        } else if (optind < argc) {
+            src.fp = NULL;
+            src.argv = &argv[optind];
+            src.argc = argc - optind;
+        }
+
+        ret = pipeline(fd_gtw, &src, window);
+
+        if (src.fp != NULL && src.fp != stdin) {
+            fclose(src.fp);
+        }
+    }
+
+    else if (inputFilePath != NULL) {
         FILE* fp = fopen(inputFilePath, "r");
         if (fp == NULL) {
             perror("Can't open input file");